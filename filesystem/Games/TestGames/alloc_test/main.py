@@ -0,0 +1,78 @@
+import engine_main
+
+import engine
+import engine_debug
+import engine_nodes
+import time
+from engine_math import Vector2
+from engine_nodes import Rectangle2DNode, PhysicsRectangle2DNode, PhysicsCircle2DNode, CameraNode
+
+# Runs a scene with tick callbacks (some every few frames), collisions
+# and `global_position` reads with frames taking varying amounts of
+# time and checks that the frame loop doesn't allocate once warmed up
+
+class Ticker(Rectangle2DNode):
+    def __init__(self):
+        super().__init__(self)
+        self.ticks = 0
+
+    def tick(self, dt):
+        self.ticks += 1
+        self.global_position
+
+
+class Collider(PhysicsCircle2DNode):
+    def __init__(self, position):
+        super().__init__(self, position=position)
+        self.collisions = 0
+
+    def on_collide(self, contact):
+        self.collisions += 1
+
+
+cam = CameraNode()
+parent = Ticker()
+child = Ticker()
+parent.add_child(child)
+
+# These get the time of several frames added up as their `dt`
+intervals = []
+for interval in range(2, 6):
+    ticker = Ticker()
+    ticker.tick_policy = engine_nodes.TICK_INTERVAL
+    ticker.tick_interval = interval
+    intervals.append(ticker)
+
+ground = PhysicsRectangle2DNode(width=128, height=16, position=Vector2(0, 40), dynamic=False)
+colliders = [Collider(Vector2(-20 + x * 10, 20)) for x in range(5)]
+
+engine.disable_fps_limit()
+
+WARMUP_FRAMES = 30
+TEST_FRAMES = 120
+
+# Frames take 0 ~ 12ms on top of whatever the frame itself takes
+# so that `dt` is a different value from frame to frame
+SLEEP_PATTERN = [0, 3, 7, 1, 12, 5, 9, 2]
+
+for i in range(WARMUP_FRAMES):
+    engine.tick()
+
+worst = 0
+for i in range(TEST_FRAMES):
+    time.sleep_ms(SLEEP_PATTERN[i % len(SLEEP_PATTERN)])
+    engine.tick()
+    allocations = engine_debug.get_frame_allocations()
+    if allocations > worst:
+        worst = allocations
+
+collisions = 0
+for collider in colliders:
+    collisions += collider.collisions
+
+print("Ticks:", parent.ticks, "Interval ticks:", [ticker.ticks for ticker in intervals], "Collisions:", collisions)
+
+if worst == 0:
+    print("PASS: no allocations per frame")
+else:
+    print("FAIL: up to", worst, "heap blocks allocated in a frame")
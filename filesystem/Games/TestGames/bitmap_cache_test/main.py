@@ -0,0 +1,109 @@
+import engine_main
+
+import engine
+import engine_debug
+import engine_draw
+from engine_math import Vector2, Rectangle
+from engine_nodes import EmptyNode, Rectangle2DNode, Text2DNode, Circle2DNode, CameraNode
+
+# Builds a HUD out of many rectangles and text nodes under one node with
+# `cache_as_bitmap` set. Checks that it is copied from its cache while
+# nothing in it changes, drawn again when something does and that it
+# looks the same either way, then times drawing it with and without
+# the cache
+
+ROWS = 6
+FRAMES = 60
+
+cam = CameraNode()
+engine.disable_fps_limit()
+
+# Something outside of the HUD that changes every frame
+ball = Circle2DNode(position=Vector2(0, 30), radius=6, color=engine_draw.green)
+
+hud = EmptyNode(position=Vector2(-20, -20))
+labels = []
+for i in range(ROWS):
+    row = Rectangle2DNode(position=Vector2(0, i * 10 - 25), width=80, height=9, color=engine_draw.blue)
+    hud.add_child(row)
+
+    bar = Rectangle2DNode(position=Vector2(10, i * 10 - 25), width=40, height=5, color=engine_draw.red, outline=True)
+    hud.add_child(bar)
+
+    label = Text2DNode(position=Vector2(-25, i * 10 - 25), text="ROW " + str(i), color=engine_draw.white)
+    hud.add_child(label)
+    labels.append(label)
+
+
+failed = False
+
+
+def check(name, result):
+    global failed
+    if result:
+        print("PASS:", name)
+    else:
+        print("FAIL:", name)
+        failed = True
+
+
+def draw_frame():
+    ball.position.x = (ball.position.x + 1) % 40
+    engine.tick()
+
+
+# What the HUD looks like drawn normally
+draw_frame()
+uncached = bytes(engine_draw.front_fb_data())
+
+hud.cache_as_bitmap = True
+check("cache_as_bitmap reads back", hud.cache_as_bitmap)
+
+ball.position.x -= 1
+draw_frame()
+check("first frame draws into the cache", engine_debug.get_bitmap_cache_counts() == (0, 1))
+check("cached frame looks the same", bytes(engine_draw.front_fb_data()) == uncached)
+
+draw_frame()
+check("copied when nothing in it changed", engine_debug.get_bitmap_cache_counts() == (1, 0))
+
+labels[2].text = "CHANGED"
+draw_frame()
+check("drawn again when a child changed", engine_debug.get_bitmap_cache_counts() == (0, 1))
+
+hud.position.x += 3
+draw_frame()
+check("drawn again when it moved", engine_debug.get_bitmap_cache_counts() == (0, 1))
+
+draw_frame()
+check("copied again after that", engine_debug.get_bitmap_cache_counts() == (1, 0))
+
+# Each camera keeps its own copy, so drawing for two doesn't make either miss
+cam.viewport = Rectangle(0, 0, 64, 128)
+second_cam = CameraNode(viewport=Rectangle(64, 0, 64, 128))
+draw_frame()
+draw_frame()
+check("copied for each of two cameras", engine_debug.get_bitmap_cache_counts() == (2, 0))
+
+second_cam.mark_destroy()
+cam.viewport = Rectangle(0, 0, 128, 128)
+draw_frame()
+
+
+# Speed, drawing the HUD every frame against copying it
+def benchmark():
+    engine_debug.clear_profile()
+    for i in range(FRAMES):
+        draw_frame()
+    return engine_debug.get_profile()["draw"]
+
+
+engine_debug.set_profiling(True)
+print("draw ms (min, avg, max, p99) cached:", benchmark())
+
+hud.cache_as_bitmap = False
+print("draw ms (min, avg, max, p99) drawn every frame:", benchmark())
+engine_debug.set_profiling(False)
+
+if not failed:
+    print("PASS: bitmap cache test")
@@ -0,0 +1,98 @@
+import engine_main
+
+import engine
+import engine_debug
+import engine_draw
+import math
+from engine_math import Vector2
+from engine_nodes import Sprite2DNode, CameraNode
+from engine_resources import TextureResource
+
+# Draws rotated and scaled sprites with the fixed-point blitter and the
+# floating-point one and checks they pick (nearly) the same pixels, then
+# times drawing with each. The two only differ where the float path's
+# rounding lands a texture coordinate just the other side of a texel edge
+
+SPRITE_COUNT = 24
+FRAMES = 120
+
+# Allowed fraction of pixels that differ between the two
+MAX_DIFFERENT = 0.01
+
+# Checkerboard with a different color per quadrant so
+# that picking the wrong texel shows up as a difference
+texture = TextureResource(16, 16)
+colors = [engine_draw.red.value, engine_draw.green.value, engine_draw.blue.value, engine_draw.yellow.value]
+data = texture.data
+for y in range(16):
+    for x in range(16):
+        color = colors[(y // 8) * 2 + (x // 8)] if (x + y) % 2 == 0 else engine_draw.white.value
+        index = (y * 16 + x) * 2
+        data[index] = color & 0xFF
+        data[index + 1] = color >> 8
+
+cam = CameraNode()
+engine.disable_fps_limit()
+
+sprites = []
+for i in range(SPRITE_COUNT):
+    sprite = Sprite2DNode(texture=texture, position=Vector2((i % 6) * 24 - 60, (i // 6) * 28 - 42))
+    sprite.scale = Vector2(0.5 + (i % 5) * 0.4, 0.5 + (i % 3) * 0.6)
+    sprite.rotation = i * 0.37
+    sprites.append(sprite)
+
+
+def draw_frame(fixed_point):
+    engine_debug.set_fixed_point_blit(fixed_point)
+    engine.tick()
+    return bytes(engine_draw.front_fb_data())
+
+
+def turn(amount):
+    for sprite in sprites:
+        sprite.rotation += amount
+
+
+# Accuracy, same scene drawn both ways at a few rotations
+different = 0
+drawn = 0
+for step in range(16):
+    fixed = draw_frame(True)
+    floating = draw_frame(False)
+    background = engine_draw.black.value
+
+    for i in range(0, len(fixed), 2):
+        fixed_pixel = fixed[i] | (fixed[i + 1] << 8)
+        floating_pixel = floating[i] | (floating[i + 1] << 8)
+
+        if fixed_pixel != background or floating_pixel != background:
+            drawn += 1
+            if fixed_pixel != floating_pixel:
+                different += 1
+
+    turn(math.pi / 16 + 0.01)
+
+print("Different pixels:", different, "of", drawn)
+
+if drawn > 0 and different / drawn <= MAX_DIFFERENT:
+    print("PASS: fixed-point blit matches the float blit")
+else:
+    print("FAIL: fixed-point blit differs from the float blit")
+
+
+# Speed, time spent drawing with each
+def benchmark(fixed_point):
+    engine_debug.set_fixed_point_blit(fixed_point)
+    engine_debug.clear_profile()
+    for i in range(FRAMES):
+        turn(0.02)
+        engine.tick()
+    return engine_debug.get_profile()["draw"]
+
+
+engine_debug.set_profiling(True)
+print("draw ms (min, avg, max, p99) fixed-point:", benchmark(True))
+print("draw ms (min, avg, max, p99) float:", benchmark(False))
+engine_debug.set_profiling(False)
+
+engine_debug.set_fixed_point_blit(True)
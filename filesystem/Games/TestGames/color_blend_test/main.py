@@ -0,0 +1,24 @@
+import engine_main
+
+import engine_debug
+
+# Checks that the integer color blending used while drawing stays within
+# one step of each channel of the floating-point math it replaced, then
+# times both in blended pixels per second
+
+PIXELS = 100000
+
+alpha_blend_difference, blend_difference = engine_debug.check_color_blending()
+print("Largest channel difference, alpha blend:", alpha_blend_difference, "interpolate:", blend_difference)
+
+if alpha_blend_difference <= 1 and blend_difference <= 1:
+    print("PASS: integer blending matches float blending")
+else:
+    print("FAIL: integer blending differs from float blending")
+
+results = engine_debug.benchmark_color_blending(PIXELS)
+print("alpha blend pixels/s, integer:", results["alpha_blend"], "float:", results["alpha_blend_float"])
+print("interpolate pixels/s, integer:", results["blend"], "float:", results["blend_float"])
+
+results = engine_debug.benchmark_shader(PIXELS)
+print("text shader pixels/s, compiled:", results["compiled"], "interpreted:", results["interpreted"])
@@ -0,0 +1,65 @@
+import engine_main
+
+import engine
+import engine_debug
+import gc
+import time
+from engine_nodes import EmptyNode, CameraNode
+
+# Times how fast nodes can be made, parented, destroyed and walked.
+# Making or destroying a node shouldn't allocate more than the node
+# itself now that it is linked into the engine's lists in place
+
+NODE_COUNTS = [100, 500, 1000]
+FRAMES = 60
+
+cam = CameraNode()
+engine.disable_fps_limit()
+
+
+def run(count):
+    gc.collect()
+    free_before = gc.mem_free()
+
+    start = time.ticks_us()
+    nodes = [EmptyNode() for i in range(count)]
+    add_us = time.ticks_diff(time.ticks_us(), start)
+
+    bytes_per_node = (free_before - gc.mem_free()) / count
+
+    # Each node the child of the one before it, then unparent again
+    start = time.ticks_us()
+    for i in range(1, count):
+        nodes[i-1].add_child(nodes[i])
+    for i in range(1, count):
+        nodes[i-1].remove_child(nodes[i])
+    parent_us = time.ticks_diff(time.ticks_us(), start)
+
+    # Walking the layers happens in the tick and draw stages
+    engine_debug.clear_profile()
+    for i in range(FRAMES):
+        engine.tick()
+    profile = engine_debug.get_profile()
+
+    start = time.ticks_us()
+    for node in nodes:
+        node.mark_destroy()
+    engine.tick()
+    remove_us = time.ticks_diff(time.ticks_us(), start)
+
+    nodes = None
+    gc.collect()
+
+    print(count, "nodes:")
+    print("    add:", add_us / count, "us/node,", bytes_per_node, "bytes/node")
+    print("    parent + unparent:", parent_us / count, "us/node")
+    print("    destroy:", remove_us / count, "us/node")
+    print("    layer walk ms (min, avg, max, p99): tick", profile["tick"], "draw", profile["draw"])
+
+
+engine_debug.set_profiling(True)
+
+for count in NODE_COUNTS:
+    run(count)
+
+engine_debug.set_profiling(False)
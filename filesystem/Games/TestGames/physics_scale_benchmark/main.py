@@ -0,0 +1,61 @@
+import engine_main
+
+import engine
+import engine_debug
+import engine_physics
+import gc
+from engine_math import Vector2
+from engine_nodes import PhysicsCircle2DNode, CameraNode
+
+# Times the physics step with 50, 500 and 5000 bodies. Bodies are laid
+# out in a grid where each one touches its neighbours so the number of
+# touching pairs grows with the number of bodies. 5000 bodies needs
+# more memory than the device has, run that one on the unix port
+
+BODY_COUNTS = [50, 500, 5000]
+FRAMES = 60
+SPACING = 7
+
+cam = CameraNode()
+engine.disable_fps_limit()
+engine_physics.set_gravity(0.0, 0.0)
+
+
+def run(count):
+    columns = int(count ** 0.5) + 1
+    bodies = []
+
+    try:
+        for i in range(count):
+            x = (i % columns) * SPACING
+            y = (i // columns) * SPACING
+            bodies.append(PhysicsCircle2DNode(position=Vector2(x, y), radius=4, dynamic=False))
+    except MemoryError:
+        print(count, "bodies: not enough memory, made", len(bodies))
+        bodies = None
+        gc.collect()
+        return
+
+    engine.tick()
+    engine_debug.clear_profile()
+
+    for i in range(FRAMES):
+        engine.tick()
+
+    physics = engine_debug.get_profile()["physics"]
+    print(count, "bodies:", engine_physics.get_pairs_tested(), "pairs, physics ms (min, avg, max, p99):", physics)
+
+    for body in bodies:
+        body.mark_destroy()
+
+    bodies = None
+    engine.tick()
+    gc.collect()
+
+
+engine_debug.set_profiling(True)
+
+for count in BODY_COUNTS:
+    run(count)
+
+engine_debug.set_profiling(False)
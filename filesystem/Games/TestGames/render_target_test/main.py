@@ -0,0 +1,133 @@
+import engine_main
+
+import engine
+import engine_debug
+import engine_draw
+import engine_nodes
+from engine_math import Vector2, Vector3
+from engine_nodes import Circle2DNode, Sprite2DNode, CameraNode
+from engine_resources import TextureResource
+
+# Renders a busy scene into a texture with a camera and shows it on the
+# screen with a sprite. Checks that the texture is only drawn into again
+# when something in it changed (or `render()` is called), then times
+# drawing the scene straight to the screen against showing the texture
+
+CIRCLE_COUNT = 60
+FRAMES = 60
+
+# The scene is far away from the screen camera so that only
+# the render target camera sees it (and not the sprite)
+SCENE_X = 1000
+
+texture = TextureResource(64, 64)
+target_cam = CameraNode(render_target=texture, position=Vector3(SCENE_X, 0, 0))
+screen_cam = CameraNode()
+engine.disable_fps_limit()
+
+circles = []
+for i in range(CIRCLE_COUNT):
+    circle = Circle2DNode(position=Vector2(SCENE_X + (i % 8) * 8 - 28, (i // 8) * 8 - 28), radius=5, color=engine_draw.green)
+    circle.outline = i % 2 == 0
+    circles.append(circle)
+
+sprite = Sprite2DNode(texture=texture)
+
+
+# Only the render target camera sees this one
+class VisibleTicker(Circle2DNode):
+    def __init__(self):
+        super().__init__(self, position=Vector2(SCENE_X, 0), radius=2, color=engine_draw.blue)
+        self.tick_policy = engine_nodes.TICK_VISIBLE
+        self.ticks = 0
+
+    def tick(self, dt):
+        self.ticks += 1
+
+
+ticker = VisibleTicker()
+
+MARK = engine_draw.red.value
+
+
+def mark():
+    texture.data[0] = MARK & 0xFF
+    texture.data[1] = MARK >> 8
+
+
+def marked():
+    return (texture.data[0] | (texture.data[1] << 8)) == MARK
+
+
+failed = False
+
+
+def check(name, result):
+    global failed
+    if result:
+        print("PASS:", name)
+    else:
+        print("FAIL:", name)
+        failed = True
+
+
+engine.tick()
+
+ticker.ticks = 0
+engine.tick()
+engine.tick()
+check("ticks when only a render target camera sees it", ticker.ticks == 2)
+ticker.mark_destroy()
+engine.tick()
+
+# Nothing changed, the texture is left alone
+mark()
+engine.tick()
+check("not re-rendered when nothing changed", marked())
+
+# Something in view moved
+circles[0].position.x += 1
+engine.tick()
+check("re-rendered when a node moved", not marked())
+
+# Something out of view moved
+circles[0].position.y += 500
+engine.tick()
+mark()
+circles[0].position.y += 10
+engine.tick()
+check("not re-rendered when an unseen node moved", marked())
+
+# Only by asking
+target_cam.auto_render = False
+circles[0].position.y -= 510
+engine.tick()
+check("not re-rendered with auto_render off", marked())
+
+target_cam.render()
+engine.tick()
+check("re-rendered after render()", not marked())
+
+
+# Speed, drawing the circles every frame against showing the texture
+def benchmark():
+    engine_debug.clear_profile()
+    for i in range(FRAMES):
+        engine.tick()
+    return engine_debug.get_profile()["draw"]
+
+
+engine_debug.set_profiling(True)
+
+target_cam.auto_render = True
+print("draw ms (min, avg, max, p99) from render target:", benchmark())
+
+target_cam.mark_destroy()
+sprite.mark_destroy()
+screen_cam.position.x = SCENE_X
+print("draw ms (min, avg, max, p99) drawn every frame:", benchmark())
+
+engine_debug.set_profiling(False)
+
+if not failed:
+    print("PASS: render target test")
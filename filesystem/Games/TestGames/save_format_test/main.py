@@ -0,0 +1,136 @@
+import engine_main
+
+import engine_save
+import os
+import struct
+
+# Checks the indexed save format: migrating a version 0 file with every
+# type of entry, overwriting and deleting keys and saving over one key
+# until the file gets compacted, with every live key surviving each step
+
+# Same values as `enum entry_types` in src/save/engine_save.c
+SAVE_STRING = 1
+SAVE_INTEGER = 2
+SAVE_FLOAT = 3
+SAVE_VECTOR2 = 4
+SAVE_VECTOR3 = 5
+SAVE_COLOR = 6
+SAVE_BYTEARRAY = 7
+
+LOCATION = "save_format_test.data"
+
+failed = False
+
+
+def check(name, result):
+    global failed
+    if result:
+        print("PASS:", name)
+    else:
+        print("FAIL:", name)
+        failed = True
+
+
+def path():
+    return engine_save.saves_dir() + "/" + LOCATION
+
+
+def file_version():
+    with open(path(), "rb") as file:
+        return struct.unpack("<H", file.read(6)[4:6])[0]
+
+
+def file_size():
+    return os.stat(path())[6]
+
+
+# A version 0 file: "THSV", the version then key_length,key,data_length,type,data
+# entries, written by hand since the firmware only writes the current version
+def v0_entry(key, entry_type, data):
+    return struct.pack("<H", len(key)) + key + struct.pack("<IB", len(data), entry_type) + data
+
+
+v0 = b"THSV" + struct.pack("<H", 0)
+v0 += v0_entry(b"string", SAVE_STRING, b"Hello there")
+v0 += v0_entry(b"integer", SAVE_INTEGER, struct.pack("<i", -1234))
+v0 += v0_entry(b"float", SAVE_FLOAT, struct.pack("<f", 0.5))
+v0 += v0_entry(b"vector2", SAVE_VECTOR2, struct.pack("<ff", 1.25, -2.5))
+v0 += v0_entry(b"vector3", SAVE_VECTOR3, struct.pack("<fff", 3.0, 4.5, -6.75))
+v0 += v0_entry(b"color", SAVE_COLOR, struct.pack("<H", 0xF81F))
+v0 += v0_entry(b"bytearray", SAVE_BYTEARRAY, bytes(range(20)))
+
+engine_save.set_location(LOCATION)
+engine_save.delete_location()
+
+with open(path(), "wb") as file:
+    file.write(v0)
+
+
+def check_migrated():
+    vector2 = engine_save.load("vector2")
+    vector3 = engine_save.load("vector3")
+
+    return (engine_save.load("string") == "Hello there" and
+            engine_save.load("integer") == -1234 and
+            engine_save.load("float") == 0.5 and
+            vector2.x == 1.25 and vector2.y == -2.5 and
+            vector3.x == 3.0 and vector3.y == 4.5 and vector3.z == -6.75 and
+            engine_save.load("color").value == 0xF81F and
+            engine_save.load("bytearray") == bytearray(range(20)))
+
+
+# Setting the location migrates the file
+engine_save.set_location(LOCATION)
+check("version 0 file migrated", file_version() == 1)
+check("every type of entry kept by migration", check_migrated())
+
+
+# Overwriting, the newest record is the one found
+engine_save.save("integer", 99)
+engine_save.save("string", "Changed")
+check("overwritten key reads back", engine_save.load("integer") == 99 and engine_save.load("string") == "Changed")
+
+engine_save.save("integer", -1234)
+engine_save.save("string", "Hello there")
+check("overwritten again reads back", check_migrated())
+
+
+# Deleting appends a record that hides the older ones
+engine_save.save("deleted", 5)
+engine_save.delete("deleted")
+check("deleted key loads as None", engine_save.load("deleted") is None)
+check("deleted key loads as the default", engine_save.load("deleted", "default") == "default")
+
+engine_save.delete("deleted")
+check("deleting twice is fine", engine_save.load("deleted") is None)
+
+engine_save.save("deleted", 6)
+check("saving a deleted key again", engine_save.load("deleted") == 6)
+engine_save.delete("deleted")
+
+
+# Saving over one key leaves the older records as garbage until there's
+# at least 2KB of it and it is half of the file, then the file is rewritten
+compacted = False
+last_size = file_size()
+
+for i in range(60):
+    engine_save.save("big", bytearray(bytes([i]) * 100))
+    size = file_size()
+
+    if size < last_size:
+        compacted = True
+        break
+
+    last_size = size
+
+check("file compacted after enough garbage", compacted)
+check("newest value kept by compaction", engine_save.load("big") == bytearray(bytes([i]) * 100))
+check("every live key kept by compaction", check_migrated())
+check("deleted key stays deleted after compaction", engine_save.load("deleted") is None)
+check("compacted file is the current version", file_version() == 1)
+
+engine_save.delete_location()
+
+if not failed:
+    print("PASS: save format test")
@@ -0,0 +1,77 @@
+import engine_main
+
+import engine
+from engine_nodes import EmptyNode, CameraNode
+
+# Checks that a tick callback can take its own node out of the tick
+# list (clearing `tick` or moving to another layer) without the nodes
+# after it on the same layer missing their tick that frame
+
+cam = CameraNode()
+engine.disable_fps_limit()
+
+failed = False
+
+
+def check(name, result):
+    global failed
+    if result:
+        print("PASS:", name)
+    else:
+        print("FAIL:", name)
+        failed = True
+
+
+class Counter(EmptyNode):
+    def __init__(self):
+        super().__init__(self)
+        self.ticks = 0
+
+    def tick(self, dt):
+        self.ticks += 1
+
+
+class StopsTicking(EmptyNode):
+    def __init__(self):
+        super().__init__(self)
+        self.ticks = 0
+
+    def tick(self, dt):
+        self.ticks += 1
+        self.tick = None
+
+
+class ChangesLayer(EmptyNode):
+    def __init__(self):
+        super().__init__(self)
+        self.ticks = 0
+
+    def tick(self, dt):
+        self.ticks += 1
+        self.layer = 1
+
+
+# Same layer, made in this order so they tick in this order
+stops = StopsTicking()
+after_stops = Counter()
+
+engine.tick()
+check("node that stopped ticking ticked once", stops.ticks == 1)
+check("node after it still ticked", after_stops.ticks == 1)
+
+engine.tick()
+check("node that stopped ticking stays stopped", stops.ticks == 1)
+check("node after it keeps ticking", after_stops.ticks == 2)
+
+stops.mark_destroy()
+after_stops.mark_destroy()
+engine.tick()
+
+moves = ChangesLayer()
+after_moves = Counter()
+
+engine.tick()
+check("node after one that changed layer still ticked", after_moves.ticks == 1)
+
+if not failed:
+    print("PASS: tick detach test")
@@ -0,0 +1,131 @@
+import engine_main
+
+import engine
+import engine_debug
+import engine_draw
+import engine_nodes
+import time
+from engine_math import Vector2
+from engine_nodes import TileMap2DNode, Sprite2DNode, CameraNode
+from engine_resources import TextureResource
+
+# Draws a map of 16x16 tiles and checks the right tiles (flipped and
+# animated ones too) end up on the screen, then times scrolling a big
+# map against the same map made out of a Sprite2DNode per tile
+
+TILE = 16
+FRAMES = 120
+
+# 4x4 tiles, each a solid color except tile 0 which is
+# red on the left and blue on the right to see flips
+tileset = TextureResource(TILE * 4, TILE * 4)
+colors = [0x0841 * (i + 1) for i in range(16)]
+colors[0] = engine_draw.white.value
+data = tileset.data
+for y in range(TILE * 4):
+    for x in range(TILE * 4):
+        tile = (y // TILE) * 4 + (x // TILE)
+        color = colors[tile]
+        if tile == 0:
+            color = engine_draw.red.value if (x % TILE) < TILE // 2 else engine_draw.blue.value
+        index = (y * TILE * 4 + x) * 2
+        data[index] = color & 0xFF
+        data[index + 1] = color >> 8
+
+cam = CameraNode()
+engine.disable_fps_limit()
+
+# 8x8 tiles covers the screen exactly with the map centered on the camera
+tiles = bytearray((i % 15) + 1 for i in range(64))
+tiles[0] = 0
+tiles[1] = 4
+tiles[2] = engine_nodes.TILE_EMPTY
+flips = bytearray(64)
+
+tile_map = TileMap2DNode(tileset=tileset, map_width=8, tiles=tiles, flips=flips, animations=[(4, 4, 20)])
+
+failed = False
+
+
+def check(name, result):
+    global failed
+    if result:
+        print("PASS:", name)
+    else:
+        print("FAIL:", name)
+        failed = True
+
+
+def pixel(x, y):
+    screen = engine_draw.front_fb_data()
+    index = (y * 128 + x) * 2
+    return screen[index] | (screen[index + 1] << 8)
+
+
+engine.tick()
+
+check("map_height follows from tiles", tile_map.map_height == 8)
+
+matching = True
+for row in range(8):
+    for column in range(3, 8):
+        if pixel(column * TILE + TILE // 2, row * TILE + TILE // 2) != colors[tiles[row * 8 + column]]:
+            matching = False
+check("tiles drawn in the right places", matching)
+
+check("tile drawn unflipped", pixel(2, 8) == engine_draw.red.value and pixel(TILE - 3, 8) == engine_draw.blue.value)
+check("empty tile left empty", pixel(2 * TILE + TILE // 2, TILE // 2) not in colors)
+
+flips[0] = engine_nodes.TILE_FLIP_X
+engine.tick()
+check("tile flipped", pixel(2, 8) == engine_draw.blue.value and pixel(TILE - 3, 8) == engine_draw.red.value)
+
+# Animated tile 4 cycles through tiles 4 ~ 7 every 50ms
+seen = set()
+for i in range(8):
+    engine.tick()
+    seen.add(pixel(TILE + TILE // 2, TILE // 2))
+    time.sleep_ms(50)
+check("animated tile cycles", len(seen) > 1 and seen <= set(colors[4:8]))
+
+tile_map.mark_destroy()
+engine.tick()
+
+
+# Speed, scrolling over a 16x16 map (4x the screen) drawn as one node or as a sprite per tile
+MAP_SIZE = 16
+big_tiles = bytearray((x * 7 + y * 3) % 16 for y in range(MAP_SIZE) for x in range(MAP_SIZE))
+
+
+def benchmark():
+    cam.position.x = 0
+    cam.position.y = 0
+    engine_debug.clear_profile()
+    for i in range(FRAMES):
+        cam.position.x += 0.5
+        cam.position.y += 0.25
+        engine.tick()
+    return engine_debug.get_profile()["draw"]
+
+
+engine_debug.set_profiling(True)
+
+tile_map = TileMap2DNode(tileset=tileset, map_width=MAP_SIZE, tiles=big_tiles)
+print("draw ms (min, avg, max, p99) TileMap2DNode:", benchmark())
+tile_map.mark_destroy()
+
+half = MAP_SIZE * TILE / 2
+sprites = []
+for y in range(MAP_SIZE):
+    for x in range(MAP_SIZE):
+        sprite = Sprite2DNode(texture=tileset, frame_count_x=4, frame_count_y=4, playing=False, position=Vector2(x * TILE + TILE / 2 - half, y * TILE + TILE / 2 - half))
+        tile = big_tiles[y * MAP_SIZE + x]
+        sprite.frame_current_x = tile % 4
+        sprite.frame_current_y = tile // 4
+        sprites.append(sprite)
+print("draw ms (min, avg, max, p99) Sprite2DNode per tile:", benchmark())
+
+engine_debug.set_profiling(False)
+
+if not failed:
+    print("PASS: tile map test")
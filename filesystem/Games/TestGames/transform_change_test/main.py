@@ -0,0 +1,77 @@
+import engine_main
+
+import engine
+from engine_math import Vector2
+from engine_nodes import Rectangle2DNode, CameraNode
+
+# Checks that the cached world transform of a node follows every way its
+# own or a parent's transform can change: storing attributes, changing a
+# Vector2 in place (also when shared by more than one node) and reparenting
+
+cam = CameraNode()
+engine.disable_fps_limit()
+
+failed = False
+
+
+def check(name, result):
+    global failed
+    if result:
+        print("PASS:", name)
+    else:
+        print("FAIL:", name)
+        failed = True
+
+
+def near(a, b):
+    return abs(a - b) < 0.001
+
+
+parent = Rectangle2DNode(position=Vector2(10, 20))
+child = Rectangle2DNode(position=Vector2(1, 2))
+parent.add_child(child)
+
+check("child starts offset from parent", near(child.global_position.x, 11) and near(child.global_position.y, 22))
+
+parent.position.x = 30
+check("parent moved in place moves child", near(child.global_position.x, 31))
+
+parent.position = Vector2(40, 50)
+check("parent position stored moves child", near(child.global_position.x, 41) and near(child.global_position.y, 52))
+
+child.position.y = 5
+check("child moved in place", near(child.global_position.y, 55))
+
+parent.scale = Vector2(2, 2)
+check("parent scale scales child offset", near(child.global_position.x, 42) and near(child.global_position.y, 60))
+
+parent.scale.x = 3
+check("parent scale changed in place", near(child.global_position.x, 43))
+
+engine.tick()
+check("cached transform kept over a frame", near(child.global_position.x, 43) and near(child.global_position.y, 60))
+
+# Same Vector2 used as the position of two parents
+shared = Vector2(100, 0)
+first = Rectangle2DNode(position=shared)
+second = Rectangle2DNode(position=shared)
+first_child = Rectangle2DNode(position=Vector2(1, 0))
+second_child = Rectangle2DNode(position=Vector2(2, 0))
+first.add_child(first_child)
+second.add_child(second_child)
+
+check("shared position starts", near(first_child.global_position.x, 101) and near(second_child.global_position.x, 102))
+
+shared.x = 200
+check("shared position moves first child", near(first_child.global_position.x, 201))
+check("shared position moves second child", near(second_child.global_position.x, 202))
+
+# Taking a node out of its parent puts it back in world space
+parent.remove_child(child)
+check("removed child no longer offset", near(child.global_position.x, 1) and near(child.global_position.y, 5))
+
+first.add_child(child)
+check("child added to new parent", near(child.global_position.x, 201) and near(child.global_position.y, 5))
+
+if not failed:
+    print("PASS: transform change test")
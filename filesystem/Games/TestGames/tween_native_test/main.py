@@ -0,0 +1,68 @@
+import engine_main
+
+import engine
+import time
+from engine_animation import Tween, ONE_SHOT, EASE_LINEAR
+from engine_math import Vector2
+from engine_nodes import Rectangle2DNode, Circle2DNode, CameraNode
+
+# Checks that tweening the floats built-in nodes keep natively (opacity,
+# rotation and camera zoom) ends on the right value and moves children,
+# and that plain Python float attributes can still be tweened
+
+cam = CameraNode()
+engine.disable_fps_limit()
+
+failed = False
+
+
+def check(name, result):
+    global failed
+    if result:
+        print("PASS:", name)
+    else:
+        print("FAIL:", name)
+        failed = True
+
+
+def near(a, b):
+    return abs(a - b) < 0.001
+
+
+class MyCircle(Circle2DNode):
+    def __init__(self):
+        super().__init__(self)
+        self.speed = 0.0
+
+
+parent = Rectangle2DNode(position=Vector2(0, 0), rotation=0.0)
+child = Rectangle2DNode(position=Vector2(10, 0))
+parent.add_child(child)
+
+circle = MyCircle()
+
+rotation_tween = Tween()
+opacity_tween = Tween()
+zoom_tween = Tween()
+speed_tween = Tween()
+
+rotation_tween.start(parent, "rotation", 0.0, 1.0, 10, 1.0, ONE_SHOT, EASE_LINEAR)
+opacity_tween.start(circle, "opacity", 1.0, 0.25, 10, 1.0, ONE_SHOT, EASE_LINEAR)
+zoom_tween.start(cam, "zoom", 1.0, 2.0, 10, 1.0, ONE_SHOT, EASE_LINEAR)
+speed_tween.start(circle, "speed", 0.0, 5.0, 10, 1.0, ONE_SHOT, EASE_LINEAR)
+
+engine.tick()
+x_before = child.global_position.x
+
+for i in range(5):
+    time.sleep_ms(5)
+    engine.tick()
+
+check("node rotation tweened", near(parent.rotation, 1.0))
+check("instance opacity tweened", near(circle.opacity, 0.25))
+check("camera zoom tweened", near(cam.zoom, 2.0))
+check("python attribute tweened", near(circle.speed, 5.0))
+check("child follows tweened rotation", not near(child.global_position.x, x_before))
+
+if not failed:
+    print("PASS: tween native test")
@@ -1,6 +1,7 @@
 #include "engine_animation_module.h"
 #include "py/obj.h"
 #include "engine_main.h"
+#include "utility/engine_mp.h"
 
 
 // Holds a list of Tween and Delay
@@ -30,25 +31,13 @@ void engine_animation_tick(float dt_ms){
         mp_obj_t element = current->object;
 
         if(mp_obj_is_type(element, &tween_class_type)){
-            tween_class_obj_t *tween = current->object;
-
-            if(tween->during != mp_const_none && tween->finished == false){
-                exec[0] = tween->during;
-                exec[1] = tween->self;
-                exec[2] = mp_obj_new_float(dt_ms);
-                mp_call_method_n_kw(1, 0, exec);
-            }
-
-            exec[0] = tween->tick;
-            exec[1] = tween->self;
-            exec[2] = mp_obj_new_float(dt_ms);
-            mp_call_method_n_kw(1, 0, exec);
+            tween_class_update(current->object, dt_ms);
         }else{
             delay_class_obj_t *delay = current->object;
 
             exec[0] = delay->tick;
             exec[1] = delay->self;
-            exec[2] = mp_obj_new_float(dt_ms);
+            exec[2] = engine_mp_float_shared_ms(dt_ms);
 
             mp_call_method_n_kw(1, 0, exec);
         }
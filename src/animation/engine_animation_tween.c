@@ -59,79 +59,81 @@ float (*ease[31])(float) = {
 };
 
 
-enum tween_value_types {tween_type_float, tween_type_vec2, tween_type_vec3, tween_type_color};
 enum tween_direction {forwards, backwards};
 
 
-mp_obj_t get_tweening_value(tween_class_obj_t *tween){
-    // Always load the attribute since a reference might go stale
-    // if the object's attribute is assigned to during tweening
-    mp_obj_t tweening_value;
-    if(tween->attr == 0){
-        tweening_value = tween->object;
-    }else{
-        tweening_value = engine_mp_load_attr_maybe(tween->object, tween->attr);
-    }
+// Built-in nodes keep attributes like `opacity` as a native float,
+// write it and mark the node the same way storing it from Python would
+static void tween_set_node_float(void *tween_in, float value_0, float value_1, float value_2){
+    tween_class_obj_t *tween = tween_in;
+    engine_node_base_t *node_base = tween->target;
 
-    // In case the attr or object is not available anymore, stop tweening
-    if(tweening_value == MP_OBJ_NULL || tweening_value == mp_const_none){
-        tween->finished = true;
-        tween->time = 0.0f;
-        tween->loop_type = engine_animation_loop_none;
-        return mp_const_none;
+    *tween->native_value = value_0;
+
+    // Camera `zoom` doesn't move the camera or its children
+    if(tween->attr != MP_QSTR_zoom){
+        node_base_set_transform_changed(node_base);
     }
 
-    return tweening_value;
+    node_base_set_if_draw_dirty(node_base, true);
 }
 
 
-void set_value_to_end(tween_class_obj_t *tween){
-    // Get tweening value and make sure valid
-    mp_obj_t tweening_value = get_tweening_value(tween);
-    if(tweening_value == mp_const_none){
-        return;
-    }
+// Floats are immutable in Python so a new one has to be stored on
+// the object's attribute every time (plain Python attributes only)
+static void tween_set_float(void *tween_in, float value_0, float value_1, float value_2){
+    tween_class_obj_t *tween = tween_in;
+    mp_store_attr(tween->object, tween->attr, mp_obj_new_float(value_0));
+}
 
-    if(tween->tween_type == tween_type_float){
-        mp_store_attr(tween->object, tween->attr, mp_obj_new_float(tween->end_0));
-    }else if(tween->tween_type == tween_type_vec2){
-        vector2_class_obj_t *value = tweening_value;
-        value->x.value = tween->end_0;
-        value->y.value = tween->end_1;
-    }else if(tween->tween_type == tween_type_vec3){
-        vector3_class_obj_t *value = tweening_value;
-        value->x.value = tween->end_0;
-        value->y.value = tween->end_1;
-        value->z.value = tween->end_2;
-    }else if(tween->tween_type == tween_type_color){
-        color_class_obj_t *value = tweening_value;
-        value->value = engine_color_from_rgb_float(tween->end_0, tween->end_1, tween->end_2);
-    }
+
+static void tween_set_vec2(void *tween_in, float value_0, float value_1, float value_2){
+    tween_class_obj_t *tween = tween_in;
+    vector2_class_obj_t *value = tween->target;
+
+    // Same as assigning `x` and `y` from Python, let anything
+    // watching for changes know (e.g. `Line2DNode` endpoints)
+    if(value->on_changing != NULL) value->on_changing(value->on_change_user_ptr, value_0, value_1);
+    value->x.value = value_0;
+    value->y.value = value_1;
+    if(value->on_changed != NULL) value->on_changed(value->on_change_user_ptr);
 }
 
 
+static void tween_set_vec3(void *tween_in, float value_0, float value_1, float value_2){
+    tween_class_obj_t *tween = tween_in;
+    vector3_class_obj_t *value = tween->target;
 
-/* --- doc ---
-   NAME: after
-   ID: after
-   DESC: Function that can be directly set or defined as a method in a class that is called after the tween completes (only called for ONE_SHOT mode)
-   PARAM: [type=object] [name=tween] [value=object (the tween object that just finished)]
-   RETURN: None
-*/
-static mp_obj_t tween_class_tick(mp_obj_t self_in, mp_obj_t dt_obj){
-    ENGINE_INFO_PRINTF("Tween: tick!");
+    value->x.value = value_0;
+    value->y.value = value_1;
+    value->z.value = value_2;
+    if(value->on_changed != NULL) value->on_changed(value->on_change_user_ptr);
+}
 
-    tween_class_obj_t *tween = self_in;
 
-    // Depending on what the user did and whats in ->self, get the base back
-    if(mp_obj_is_instance_type(((mp_obj_base_t*)self_in)->type)){
-        tween = mp_load_attr(self_in, MP_QSTR_base);
-    }else{
-        tween = self_in;
+static void tween_set_color(void *tween_in, float value_0, float value_1, float value_2){
+    tween_class_obj_t *tween = tween_in;
+    color_class_obj_t *value = tween->target;
+
+    // https://www.alanzucconi.com/2016/01/06/colour-interpolation/#:~:text=can%20be%20done-,as%20such,-%3A
+    // Lame way of interpolating RGB: TODO
+    value->value = engine_color_from_rgb_float(value_0, value_1, value_2);
+}
+
+
+void set_value_to_end(tween_class_obj_t *tween){
+    // Not started yet, nothing to set
+    if(tween->setter == NULL){
+        return;
     }
 
+    tween->setter(tween, tween->end_0, tween->end_1, tween->end_2);
+}
+
+
+static void tween_class_advance(tween_class_obj_t *tween, float dt){
     if(tween->paused == true){
-        return mp_const_none;
+        return;
     }
 
     if(tween->finished){
@@ -151,7 +153,7 @@ static mp_obj_t tween_class_tick(mp_obj_t self_in, mp_obj_t dt_obj){
                     mp_call_method_n_kw(0, 0, exec);
                     tween->after_called = true;
                 }
-                return mp_const_none;
+                return;
             }
             break;
             case engine_animation_loop_ping_pong:
@@ -167,20 +169,13 @@ static mp_obj_t tween_class_tick(mp_obj_t self_in, mp_obj_t dt_obj){
             }
             break;
             default:
-                return mp_const_none;   // By default, if finished (which is true by default) then just stop if no loop type is set, must have been `engine_animation_ease_none`
+                return;   // By default, if finished (which is true by default) then just stop if no loop type is set, must have been `engine_animation_ease_none`
         }
     }
 
-    // Get dt and add to total running time
-    float dt = mp_obj_get_float(dt_obj);
+    // Add dt to total running time
     tween->time += (dt * tween->ping_pong_multiplier * tween->speed);
 
-    // Get tweening value and make sure valid
-    mp_obj_t tweening_value = get_tweening_value(tween);
-    if(tweening_value == mp_const_none){
-        return mp_const_none;
-    }
-
     // If reached end of time, mark as finished
     // and stop. This lets the user catch the
     // `finished` flag for `loop` and `one_shot`
@@ -191,7 +186,7 @@ static mp_obj_t tween_class_tick(mp_obj_t self_in, mp_obj_t dt_obj){
         // Set value exactly equal to the end value
         set_value_to_end(tween);
 
-        return mp_const_none;
+        return;
     }
 
     // Figure out where we are in interpolation (percentage)
@@ -206,60 +201,74 @@ static mp_obj_t tween_class_tick(mp_obj_t self_in, mp_obj_t dt_obj){
     // Ease the factor depending on which ease function was selected
     t = ease[tween->ease_type](t);
 
-    if(tween->tween_type == tween_type_float){
-        mp_store_attr(tween->object, tween->attr, mp_obj_new_float(tween->initial_0 + ((tween->end_0 - tween->initial_0) * t)));
-    }else if(tween->tween_type == tween_type_vec2){
-        vector2_class_obj_t *value = tweening_value;
-
-        float x0 = tween->initial_0;
-        float y0 = tween->initial_1;
-
-        float x1 = tween->end_0;
-        float y1 = tween->end_1;
-
-        // https://stackoverflow.com/a/51067982
-        value->x.value = x0 + t * (x1 - x0);
-        value->y.value = y0 + t * (y1 - y0);
-    }else if(tween->tween_type == tween_type_vec3){
-        vector3_class_obj_t *value = tweening_value;
-
-        float x0 = tween->initial_0;
-        float y0 = tween->initial_1;
-        float z0 = tween->initial_2;
-
-        float x1 = tween->end_0;
-        float y1 = tween->end_1;
-        float z1 = tween->end_2;
-
-        // https://stackoverflow.com/a/51067982
-        value->x.value = x0 + t * (x1 - x0);
-        value->y.value = y0 + t * (y1 - y0);
-        value->z.value = z0 + t * (z1 - z0);
-    }else if(tween->tween_type == tween_type_color){
-        color_class_obj_t *value = tweening_value;
-
-        float r0 = tween->initial_0;
-        float g0 = tween->initial_1;
-        float b0 = tween->initial_2;
-
-        float r1 = tween->end_0;
-        float g1 = tween->end_1;
-        float b1 = tween->end_2;
-
-        // https://www.alanzucconi.com/2016/01/06/colour-interpolation/#:~:text=can%20be%20done-,as%20such,-%3A
-        // Lame way of interpolating RGB: TODO
-        value->value = engine_color_from_rgb_float(r0 + (r1 - r0) * t, g0 + (g1 - g0) * t, b0 + (b1 - b0) * t);
+    // https://stackoverflow.com/a/51067982
+    tween->setter(tween, tween->initial_0 + t * (tween->end_0 - tween->initial_0),
+                         tween->initial_1 + t * (tween->end_1 - tween->initial_1),
+                         tween->initial_2 + t * (tween->end_2 - tween->initial_2));
+}
+
+
+/* --- doc ---
+   NAME: after
+   ID: after
+   DESC: Function that can be directly set or defined as a method in a class that is called after the tween completes (only called for ONE_SHOT mode)
+   PARAM: [type=object] [name=tween] [value=object (the tween object that just finished)]
+   RETURN: None
+*/
+static mp_obj_t tween_class_tick(mp_obj_t self_in, mp_obj_t dt_obj){
+    ENGINE_INFO_PRINTF("Tween: tick!");
+
+    tween_class_obj_t *tween = self_in;
+
+    // Depending on what the user did and whats in ->self, get the base back
+    if(mp_obj_is_instance_type(((mp_obj_base_t*)self_in)->type)){
+        tween = mp_load_attr(self_in, MP_QSTR_base);
+    }else{
+        tween = self_in;
     }
 
+    tween_class_advance(tween, mp_obj_get_float(dt_obj));
+
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_2(tween_class_tick_obj, tween_class_tick);
 
 
+void tween_class_update(tween_class_obj_t *tween, float dt_ms){
+    // Only look up `dt` if something in Python needs it
+    mp_obj_t dt_obj = MP_OBJ_NULL;
+    mp_obj_t exec[3];
+
+    if(tween->during != mp_const_none && tween->finished == false){
+        dt_obj = engine_mp_float_shared_ms(dt_ms);
+
+        exec[0] = tween->during;
+        exec[1] = tween->self;
+        exec[2] = dt_obj;
+        mp_call_method_n_kw(1, 0, exec);
+    }
+
+    // Not overridden, no need to go through Python
+    if(tween->tick == MP_OBJ_FROM_PTR(&tween_class_tick_obj)){
+        tween_class_advance(tween, dt_ms);
+        return;
+    }
+
+    if(dt_obj == MP_OBJ_NULL){
+        dt_obj = engine_mp_float_shared_ms(dt_ms);
+    }
+
+    exec[0] = tween->tick;
+    exec[1] = tween->self;
+    exec[2] = dt_obj;
+    mp_call_method_n_kw(1, 0, exec);
+}
+
+
 /* --- doc ---
    NAME: start
    ID: tween_start
-   DESC: Starts tweening a value. See https://easings.net/ for plots of the various easing functions
+   DESC: Starts tweening a value. See https://easings.net/ for plots of the various easing functions. The attribute is looked up once here, if a new object is assigned to it while tweening (e.g. `node.position = Vector2(...)`) call this again to tween the new one
    PARAM: [type=object]      [name=object]         [value=object (the object that has an attribute to be tweened)]
    PARAM: [type=string]      [name=attribute_name] [value=string]
    PARAM: [type=None|object] [name=start]          [value=None|object (None means the current value, otherwise must be the same type as the attribute from `attribute_name`)]
@@ -276,16 +285,6 @@ mp_obj_t tween_class_start(size_t n_args, const mp_obj_t *args){
     // self, always `tween_class_obj_t` since attr function handles getting base
     tween_class_obj_t *tween = args[0];
 
-    tween->finished = false;
-    tween->paused = false;
-    tween->time = 0.0f;
-    tween->tween_direction = forwards;
-    tween->ping_pong_multiplier = 1.0f;
-    tween->after_called = false;    // Set this to false every time (don't want to clear `after` entry but only want to call it once)
-
-    // The object with the attribute that will be tweened
-    tween->object = args[1];
-
     const char *attr_name = mp_obj_str_get_str(args[2]);
 
     // If the string attribute name is empty, error
@@ -293,10 +292,12 @@ mp_obj_t tween_class_start(size_t n_args, const mp_obj_t *args){
         mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("Tween: ERROR: Trying to tween without an attribute name to lookup!"));
     }
 
-    // Get the qstr for the attribute that should be tweened
-    tween->attr = mp_obj_str_get_qstr(args[2]);
+    // The object with the attribute that will be tweened and
+    // the qstr for the attribute that should be tweened
+    const mp_obj_t object = args[1];
+    const qstr attr = mp_obj_str_get_qstr(args[2]);
 
-    const mp_obj_t start_value = mp_load_attr(tween->object, tween->attr);
+    const mp_obj_t start_value = mp_load_attr(object, attr);
     const mp_obj_type_t *value_type = mp_obj_get_type(start_value);
     const mp_obj_t tween_start_value = args[3] == mp_const_none ? start_value : args[3];
     const mp_obj_t tween_end_value = args[4];
@@ -306,7 +307,21 @@ mp_obj_t tween_class_start(size_t n_args, const mp_obj_t *args){
     if(value_type == &mp_type_float && start_type == &mp_type_float && end_type == &mp_type_float){
         tween->initial_0  = mp_obj_get_float(tween_start_value);
         tween->end_0      = mp_obj_get_float(tween_end_value);
-        tween->tween_type = tween_type_float;
+        tween->initial_1  = 0.0f;
+        tween->end_1      = 0.0f;
+        tween->initial_2  = 0.0f;
+        tween->end_2      = 0.0f;
+
+        engine_node_base_t *node_base = NULL;
+        tween->native_value = node_base_get_float_attr(object, attr, &node_base);
+
+        if(tween->native_value != NULL){
+            tween->target = node_base;
+            tween->setter = &tween_set_node_float;
+        }else{
+            tween->target = mp_const_none;
+            tween->setter = &tween_set_float;
+        }
     }else if(value_type == &vector2_class_type && start_type == &vector2_class_type && end_type == &vector2_class_type){
         vector2_class_obj_t *start = tween_start_value;
         vector2_class_obj_t *end = tween_end_value;
@@ -317,7 +332,11 @@ mp_obj_t tween_class_start(size_t n_args, const mp_obj_t *args){
         tween->end_0 = end->x.value;
         tween->end_1 = end->y.value;
 
-        tween->tween_type = tween_type_vec2;
+        tween->initial_2 = 0.0f;
+        tween->end_2 = 0.0f;
+
+        tween->target = start_value;
+        tween->setter = &tween_set_vec2;
     }else if(value_type == &vector3_class_type && start_type == &vector3_class_type && end_type == &vector3_class_type){
         vector3_class_obj_t *start = tween_start_value;
         vector3_class_obj_t *end = tween_end_value;
@@ -330,7 +349,8 @@ mp_obj_t tween_class_start(size_t n_args, const mp_obj_t *args){
         tween->end_1 = end->y.value;
         tween->end_2 = end->z.value;
 
-        tween->tween_type = tween_type_vec3;
+        tween->target = start_value;
+        tween->setter = &tween_set_vec3;
     }else if(engine_color_is_instance(start_value) &&
             (engine_color_is_instance(tween_start_value) || mp_obj_is_int(tween_start_value)) &&
             (engine_color_is_instance(tween_end_value) || mp_obj_is_int(tween_end_value))){
@@ -345,7 +365,8 @@ mp_obj_t tween_class_start(size_t n_args, const mp_obj_t *args){
         tween->end_1 = engine_color_get_g_float(end);
         tween->end_2 = engine_color_get_b_float(end);
 
-        tween->tween_type = tween_type_color;
+        tween->target = start_value;
+        tween->setter = &tween_set_color;
     }else{
         ENGINE_PRINTF("ERROR: Got types value: %s, start: %s, end %s:\n",
             mp_obj_get_type_str(start_value), mp_obj_get_type_str(tween_start_value), mp_obj_get_type_str(tween_end_value));
@@ -354,6 +375,16 @@ mp_obj_t tween_class_start(size_t n_args, const mp_obj_t *args){
             mp_obj_get_type_str(start_value), mp_obj_get_type_str(tween_start_value), mp_obj_get_type_str(tween_end_value));
     }
 
+    tween->object = object;
+    tween->attr = attr;
+
+    tween->finished = false;
+    tween->paused = false;
+    tween->time = 0.0f;
+    tween->tween_direction = forwards;
+    tween->ping_pong_multiplier = 1.0f;
+    tween->after_called = false;    // Set this to false every time (don't want to clear `after` entry but only want to call it once)
+
     if(n_args >= 6){
         tween->duration = mp_obj_get_float(args[5]);
     }
@@ -666,6 +697,9 @@ mp_obj_t tween_class_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw,
     self->object = mp_const_none;
     self->after_called = false;
     self->attr = 0;
+    self->target = mp_const_none;
+    self->native_value = NULL;
+    self->setter = NULL;
     self->after = mp_const_none;
     self->during = mp_const_none;
 
@@ -11,7 +11,6 @@ typedef struct{
     float duration;
     uint8_t loop_type;
     uint8_t ease_type;
-    uint8_t tween_type;
 
     float time;
     float speed;
@@ -29,6 +28,10 @@ typedef struct{
     float end_1;
     float end_2;
 
+    mp_obj_t target;                                // The Vector2, Vector3, Color or node tweened in place, looked up once in `start()`
+    float *native_value;                            // Float kept by the `target` node for `attr`, written directly when not NULL
+    void (*setter)(void*, float, float, float);     // Writes tweened values to `target` or `attr` on `object`, picked in `start()`
+
     void *self;
     linked_list_node *list_node;
 
@@ -41,4 +44,9 @@ typedef struct{
 
 extern const mp_obj_type_t tween_class_type;
 
+// Calls `during` (if set) and moves the tween forward by `dt_ms`.
+// Unless `tick` is overridden this is done without calling into
+// Python, only `after` is called when a ONE_SHOT tween finishes
+void tween_class_update(tween_class_obj_t *tween, float dt_ms);
+
 #endif  // ENGINE_ANIMATION_TWEEN_H
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "math/engine_math.h"
 #include "debug/debug_print.h"
 #include "audio/engine_audio_module.h"
+#include "audio/engine_audio_mixer.h"
 #include <stdlib.h>
 #include <string.h>
 
@@ -22,8 +23,10 @@ mp_obj_t audio_channel_class_new(const mp_obj_type_t *type, size_t n_args, size_
     self->base.type = &audio_channel_class_type;
 
     self->source = NULL;   // Set to NULL to indicate that source/channel not active
+    self->fetch = NULL;
     self->source_byte_offset = 0;
     self->gain = 1.0f;
+    self->gain_q15 = ENGINE_AUDIO_MIXER_Q15_ONE;
     self->time = 0.0f;
     self->done = true;
     self->loop = false;
@@ -102,6 +105,7 @@ mp_obj_t audio_channel_stop(mp_obj_t self_in){
 
     // Set true, busy adjusting source, don't want the ISR doing
     // anything with this channel when in the middle of it
+    engine_audio_lock();
     channel->busy = true;
 
     // Make sure that if this channel has a source, that
@@ -118,8 +122,10 @@ mp_obj_t audio_channel_stop(mp_obj_t self_in){
     }
 
     channel->source = NULL;
+    channel->fetch = NULL;
     channel->source_byte_offset = 0;
     channel->gain = 1.0f;
+    channel->gain_q15 = ENGINE_AUDIO_MIXER_Q15_ONE;
     channel->time = 0.0f;
     channel->done = true;
     channel->loop = false;
@@ -132,6 +138,7 @@ mp_obj_t audio_channel_stop(mp_obj_t self_in){
 
     // Set back to false now that we're done readjusting the channel
     channel->busy = false;
+    engine_audio_unlock();
 
     ENGINE_INFO_PRINTF("Done stopping!");
 
@@ -188,10 +195,18 @@ static void audio_channel_class_attr(mp_obj_t self_in, qstr attribute, mp_obj_t
     }else if(destination[1] != MP_OBJ_NULL){    // Store
         switch(attribute){
             case MP_QSTR_source:
+            {
+                engine_audio_channel_fetch_t fetch = engine_audio_mixer_get_fetch(destination[1]);
+
+                engine_audio_lock();
                 self->source = destination[1];
+                self->fetch = fetch;
+                engine_audio_unlock();
+            }
             break;
             case MP_QSTR_gain:
                 self->gain = engine_math_clamp(mp_obj_get_float(destination[1]), 0.0f, 1.0f);
+                self->gain_q15 = engine_audio_mixer_gain_to_q15(self->gain);
             break;
             // case MP_QSTR_time:
             //     self->time = mp_obj_get_float(destination[1]);
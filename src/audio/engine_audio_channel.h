@@ -32,11 +32,21 @@
 // and into RAM faster than that
 #define CHANNEL_BUFFER_SIZE 512
 
+// Forward declare since the fetch functions take the channel
+struct audio_channel_class_obj_t;
+
+// Fills `count` Q15 samples from the channel's source into `samples`
+// and sets `complete` when a source that isn't looping runs out. One
+// of these is picked for the type of source when it starts playing
+typedef void (*engine_audio_channel_fetch_t)(struct audio_channel_class_obj_t *channel, int16_t *samples, uint16_t count, bool *complete);
+
 typedef struct audio_channel_class_obj_t{
     mp_obj_base_t base;
     mp_obj_t source;                            // Source of the audio for the channel, currently
+    engine_audio_channel_fetch_t fetch;         // Gets blocks of samples from 'source', set when 'source' is set
     uint32_t source_byte_offset;                // The total byte position inside the source that the ISR is using to start filling from
     float gain;                                 // Multiplier on each sample, 1.0 changes nothing
+    int32_t gain_q15;                           // 'gain' as Q15 for the mixer
     float time;                                 // Where in the 'channel_source' the audio is being played from
     bool loop;                                  // Loop back to the start of the 'channel_source' at the end or set it to mp_const_none
     bool done;                                  // After starting a sound on this channel, this is set to true and then false when the end is reached (never set false in the case of 'looping' being true)
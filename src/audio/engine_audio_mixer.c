@@ -0,0 +1,298 @@
+#include "engine_audio_mixer.h"
+#include "engine_audio_module.h"
+#include "resources/engine_sound_resource_base.h"
+#include "resources/engine_wave_sound_resource.h"
+#include "resources/engine_tone_sound_resource.h"
+#include "resources/engine_rtttl_sound_resource.h"
+#include "debug/debug_print.h"
+#include "math/engine_math.h"
+#include "utility/engine_defines.h"
+#include <string.h>
+
+#if defined(__arm__)
+    #include "hardware/dma.h"
+#endif
+
+
+// The master volume that all mixed samples are scaled by. Kept
+// as given for getting it back and as Q15 for mixing
+static float master_volume = 1.0f;
+static volatile int32_t master_volume_q15 = ENGINE_AUDIO_MIXER_Q15_ONE;
+
+// Each channel's source fills this before it is scaled and summed
+static int16_t channel_samples[ENGINE_AUDIO_MIXER_BLOCK_SIZE];
+
+// Sum of all the channels before it is saturated to 16-bits
+static int32_t mixed_samples[ENGINE_AUDIO_MIXER_BLOCK_SIZE];
+
+
+static inline int16_t engine_audio_mixer_float_to_q15(float sample){
+    return (int16_t)(engine_math_clamp(sample, -1.0f, 1.0f) * (float)INT16_MAX);
+}
+
+
+static void ENGINE_FAST_FUNCTION(engine_audio_mixer_handle_buffer)(audio_channel_class_obj_t *channel, bool *complete){
+    // When 'buffer_byte_offset = 0' that means the buffer hasn't been filled before, fill it (see that after this function it is immediately incremented)
+    // When 'buffer_byte_offset >= channel->buffer_end' that means the index has run out of data, fill it with more
+    if(channel->buffers_byte_offsets[channel->reading_buffer_index] == 0 || channel->buffers_byte_offsets[channel->reading_buffer_index] >= channel->buffers_ends[channel->reading_buffer_index]){
+        // Reset for the second case above
+        channel->buffers_byte_offsets[channel->reading_buffer_index] = 0;
+
+        if(channel->source == NULL){
+            return;
+        }
+
+        // Using the sound resource base, get where the next
+        // chunk of audio data is in the source resource
+        sound_resource_base_class_obj_t *source = channel->source;
+        uint8_t *source_data = source->get_data(channel, CHANNEL_BUFFER_SIZE, &channel->buffers_ends[channel->reading_buffer_index]);
+
+        #if defined(__arm__)
+            // Just in case we were too quick, wait while previous DMA might still be active
+            if(dma_channel_is_busy(channel->dma_channel)){
+                ENGINE_WARNING_PRINTF("AudioMixer: Waiting on previous DMA transfer to complete, this ideally shouldn't happen");
+                dma_channel_wait_for_finish_blocking(channel->dma_channel);
+            }
+        #endif
+
+        channel->reading_buffer_index = 1 - channel->reading_buffer_index;
+        channel->filling_buffer_index = 1 - channel->filling_buffer_index;
+
+        #if defined(__arm__)
+            // Audio stays in flash which is slow to read from, copy the
+            // next chunk into RAM in the background while this one plays
+            // https://github.com/raspberrypi/pico-examples/blob/master/flash/xip_stream/flash_xip_stream.c#L58-L70
+            dma_channel_configure(
+                channel->dma_channel,                                   // Channel to be configured
+                &channel->dma_config,                                   // The configuration we just created
+                channel->buffers[channel->filling_buffer_index],        // The initial write address
+                source_data,                                            // The initial read address
+                channel->buffers_ends[channel->filling_buffer_index],   // Number of transfers; in this case each is 1 byte
+                true                                                    // Start immediately
+            );
+        #else
+            memcpy(channel->buffers[channel->filling_buffer_index], source_data, channel->buffers_ends[channel->filling_buffer_index]);
+        #endif
+
+        // Filled amount will always be equal to or less than to
+        // 0 the 'size' passed to 'fill_buffer'. In the case it was
+        // filled with something, increment to the amount filled
+        // further. In the case it is filled with nothing, that means
+        // the last fill made us reach the end of the source data,
+        // figure out if this channel should stop or loop. If loop,
+        // run again right away to fill with more data after resetting
+        // 'source_byte_offset'
+        if(channel->buffers_ends[channel->filling_buffer_index] > 0){
+            channel->source_byte_offset += channel->buffers_ends[channel->filling_buffer_index];
+        }else{
+            // Gets reset no matter what, whether looping or not
+            channel->source_byte_offset = 0;
+
+            // If not looping, disable/remove the source and stop this
+            // channel from being played, otherwise, fill with start data
+            if(channel->loop == false){
+                *complete = true;
+            }else{
+                // Run right away to fill buffer with starting data since looping
+                engine_audio_mixer_handle_buffer(channel, complete);
+            }
+        }
+
+        // Not the best solution but when these are both 1 that means
+        // no data has been loaded yet, block until data is loaded into
+        // 1 then load the other buffer while not blocking so that it
+        // can be switched to next time for reading
+        if(channel->reading_buffer_index == channel->filling_buffer_index){
+            #if defined(__arm__)
+                dma_channel_wait_for_finish_blocking(channel->dma_channel);
+            #endif
+
+            // Flip only the buffer to fill since we're going to fill it now
+            channel->filling_buffer_index = 1 - channel->filling_buffer_index;
+
+            // Fill the other buffer right now
+            engine_audio_mixer_handle_buffer(channel, complete);
+        }
+    }
+}
+
+
+// Always inlined with a constant `bytes_per_sample`
+// so that each wave format gets its own loop
+static inline __attribute__((always_inline)) void engine_audio_mixer_fetch_wave(audio_channel_class_obj_t *channel, int16_t *samples, uint16_t count, bool *complete, const uint8_t bytes_per_sample){
+    sound_resource_base_class_obj_t *source = channel->source;
+
+    for(uint16_t index=0; index<count; index++){
+        // Keep repeating the current sample until time to get next one
+        if(source->play_counter != 0){
+            if(source->play_counter == source->play_counter_max){
+                source->play_counter = 0;
+            }else{
+                source->play_counter++;
+                samples[index] = source->last_sample;
+                continue;
+            }
+        }
+
+        // Fill buffer with data whether first time or looping
+        engine_audio_mixer_handle_buffer(channel, complete);
+
+        // Reached the end and not looping, the rest is silent
+        if(*complete){
+            memset(samples+index, 0, (count-index) * sizeof(int16_t));
+            break;
+        }
+
+        uint8_t *buffer = channel->buffers[channel->reading_buffer_index];
+        uint16_t buffer_byte_offset = channel->buffers_byte_offsets[channel->reading_buffer_index];
+
+        if(bytes_per_sample == 1){
+            // Unsigned 8-bit from 0 ~ 255, center on 128 and scale up to Q15
+            source->last_sample = (int16_t)((buffer[buffer_byte_offset] - 128) * 256);
+        }else{
+            // Signed 16-bit little-endian, already Q15
+            source->last_sample = (int16_t)((buffer[buffer_byte_offset+1] << 8) | buffer[buffer_byte_offset]);
+        }
+
+        // Set for the next sample
+        channel->buffers_byte_offsets[channel->reading_buffer_index] += bytes_per_sample;
+
+        source->play_counter++;
+        samples[index] = source->last_sample;
+    }
+
+    // Calculate the current time that we're at in the channel's source
+    channel->time = (1.0f / source->sample_rate) * (channel->source_byte_offset / bytes_per_sample);
+}
+
+
+static void ENGINE_FAST_FUNCTION(engine_audio_mixer_fetch_wave_8)(audio_channel_class_obj_t *channel, int16_t *samples, uint16_t count, bool *complete){
+    engine_audio_mixer_fetch_wave(channel, samples, count, complete, 1);
+}
+
+
+static void ENGINE_FAST_FUNCTION(engine_audio_mixer_fetch_wave_16)(audio_channel_class_obj_t *channel, int16_t *samples, uint16_t count, bool *complete){
+    engine_audio_mixer_fetch_wave(channel, samples, count, complete, 2);
+}
+
+
+static void ENGINE_FAST_FUNCTION(engine_audio_mixer_fetch_tone)(audio_channel_class_obj_t *channel, int16_t *samples, uint16_t count, bool *complete){
+    tone_sound_resource_class_obj_t *source = channel->source;
+
+    for(uint16_t index=0; index<count; index++){
+        samples[index] = engine_audio_mixer_float_to_q15(tone_sound_resource_get_sample(source));
+    }
+}
+
+
+static void ENGINE_FAST_FUNCTION(engine_audio_mixer_fetch_rtttl)(audio_channel_class_obj_t *channel, int16_t *samples, uint16_t count, bool *complete){
+    rtttl_sound_resource_class_obj_t *source = channel->source;
+
+    for(uint16_t index=0; index<count; index++){
+        samples[index] = engine_audio_mixer_float_to_q15(rtttl_sound_resource_get_sample(source, complete));
+    }
+}
+
+
+engine_audio_channel_fetch_t engine_audio_mixer_get_fetch(mp_obj_t source){
+    if(mp_obj_is_type(source, &wave_sound_resource_class_type)){
+        uint16_t bytes_per_sample = ((sound_resource_base_class_obj_t*)source)->bytes_per_sample;
+
+        if(bytes_per_sample == 1){
+            return engine_audio_mixer_fetch_wave_8;
+        }else if(bytes_per_sample == 2){
+            return engine_audio_mixer_fetch_wave_16;
+        }
+
+        mp_raise_msg_varg(&mp_type_RuntimeError, MP_ERROR_TEXT("AudioMixer: ERROR: Audio source with %d bytes per sample is not supported"), bytes_per_sample);
+    }else if(mp_obj_is_type(source, &tone_sound_resource_class_type)){
+        return engine_audio_mixer_fetch_tone;
+    }else if(mp_obj_is_type(source, &rtttl_sound_resource_class_type)){
+        return engine_audio_mixer_fetch_rtttl;
+    }
+
+    return NULL;
+}
+
+
+int32_t engine_audio_mixer_gain_to_q15(float gain){
+    return (int32_t)(engine_math_clamp(gain, 0.0f, ENGINE_AUDIO_MIXER_MAX_GAIN) * (float)ENGINE_AUDIO_MIXER_Q15_ONE);
+}
+
+
+void engine_audio_mixer_set_volume(float volume){
+    master_volume = volume;
+    master_volume_q15 = engine_audio_mixer_gain_to_q15(volume);
+}
+
+
+float engine_audio_mixer_get_volume(){
+    return master_volume;
+}
+
+
+bool ENGINE_FAST_FUNCTION(engine_audio_mixer_mix)(int16_t *samples, uint16_t count){
+    bool played = false;
+
+    for(uint8_t icx=0; icx<CHANNEL_COUNT; icx++){
+        audio_channel_class_obj_t *channel = channels[icx];
+
+        if(channel->source == NULL || channel->fetch == NULL || channel->busy){
+            continue;
+        }
+
+        bool complete = false;
+        channel->fetch(channel, channel_samples, count, &complete);
+
+        // Channel gain and master volume only change between blocks,
+        // combine them once and then shift the combined gain down until
+        // it fits in 16-bits so `sample * gain` fits in 32-bits
+        int64_t gain = ((int64_t)channel->gain_q15 * master_volume_q15) >> 15;
+        uint8_t shift = 15;
+
+        while(gain > UINT16_MAX){
+            gain >>= 1;
+            shift--;
+        }
+
+        int32_t gain_16 = (int32_t)gain;
+
+        if(played == false){
+            for(uint16_t index=0; index<count; index++){
+                mixed_samples[index] = (channel_samples[index] * gain_16) >> shift;
+            }
+        }else{
+            for(uint16_t index=0; index<count; index++){
+                mixed_samples[index] += (channel_samples[index] * gain_16) >> shift;
+            }
+        }
+
+        // Playing at least one sample, switch flag
+        played = true;
+
+        if(complete && channel->loop == false){
+            audio_channel_stop(channel);
+        }
+    }
+
+    if(played == false){
+        memset(samples, 0, count * sizeof(int16_t));
+        return false;
+    }
+
+    // Up to the user to make sure all playing channels do not add
+    // up and go out of range, saturate since very likely it could
+    for(uint16_t index=0; index<count; index++){
+        int32_t sample = mixed_samples[index];
+
+        if(sample > INT16_MAX){
+            sample = INT16_MAX;
+        }else if(sample < INT16_MIN){
+            sample = INT16_MIN;
+        }
+
+        samples[index] = (int16_t)sample;
+    }
+
+    return true;
+}
@@ -0,0 +1,40 @@
+#ifndef ENGINE_AUDIO_MIXER_H
+#define ENGINE_AUDIO_MIXER_H
+
+#include "py/obj.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include "engine_audio_channel.h"
+
+// How many samples are mixed at a time. Each channel's source
+// is asked for this many samples at once so that working out
+// what and how to play is done once per block instead of once
+// per sample (128 samples is about 5.8ms at 22050Hz)
+#define ENGINE_AUDIO_MIXER_BLOCK_SIZE 128
+
+// Samples and gains are mixed as Q15 fixed-point
+// numbers where this is 1.0
+#define ENGINE_AUDIO_MIXER_Q15_ONE 32768
+
+// Gains and volumes past this are treated as this
+// so that the mix can't overflow 32-bits
+#define ENGINE_AUDIO_MIXER_MAX_GAIN 256.0f
+
+
+// Mixes the next `count` (at most ENGINE_AUDIO_MIXER_BLOCK_SIZE)
+// samples of all playing channels into `samples` as signed 16-bit
+// values, saturating where the sum goes out of range. Returns false
+// when no channel is playing, `samples` is all zeros in that case
+bool engine_audio_mixer_mix(int16_t *samples, uint16_t count);
+
+// Gets the function that fills blocks of samples for the type
+// of `source`. Looked up once when a source is set on a channel
+engine_audio_channel_fetch_t engine_audio_mixer_get_fetch(mp_obj_t source);
+
+// Converts a gain where 1.0 leaves samples unchanged to Q15
+int32_t engine_audio_mixer_gain_to_q15(float gain);
+
+void engine_audio_mixer_set_volume(float volume);
+float engine_audio_mixer_get_volume();
+
+#endif  // ENGINE_AUDIO_MIXER_H
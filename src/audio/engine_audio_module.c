@@ -1,6 +1,7 @@
 #include "py/obj.h"
 #include "py/mpthread.h"
 #include "engine_audio_module.h"
+#include "engine_audio_mixer.h"
 #include "resources/engine_sound_resource_base.h"
 #include "resources/engine_wave_sound_resource.h"
 #include "resources/engine_tone_sound_resource.h"
@@ -20,16 +21,32 @@
 // when sample retrieval time/latency needs to be small to keep
 // on track at the relatively high sample rate good audio requires.
 // DMA is used to copy data into one of the dual buffer pairs
-// each audio channel gets but there's only 12 channels on RP2040
-// and one is used for the screen
+// each audio channel gets but there's only 12 channels on RP2040,
+// one is used for the screen and two for sending mixed samples
 volatile mp_obj_t channels[CHANNEL_COUNT];
 
-// The master volume that all mixed samples are scaled by (0.0 ~ 1.0)
-volatile float master_volume = 1.0f;
+#if defined(__EMSCRIPTEN__)
+    // Nothing to do
+#elif defined(__unix__)
+    #include <SDL2/SDL.h>
 
+    // Zero when SDL audio could not be opened, audio is silent then
+    static SDL_AudioDeviceID audio_device = 0;
 
-#if defined(__unix__)
-    // Nothing to do
+    // SDL calls this on its own audio thread whenever
+    // it needs more samples, mix them a block at a time
+    static void engine_audio_sdl_callback(void *user_data, uint8_t *stream, int length){
+        int16_t *samples = (int16_t*)stream;
+        uint32_t remaining_sample_count = length / sizeof(int16_t);
+
+        while(remaining_sample_count != 0){
+            uint16_t sample_count = MIN(remaining_sample_count, ENGINE_AUDIO_MIXER_BLOCK_SIZE);
+            engine_audio_mixer_mix(samples, sample_count);
+
+            samples += sample_count;
+            remaining_sample_count -= sample_count;
+        }
+    }
 #elif defined(__arm__)
     #include "pico/stdlib.h"
     #include "hardware/dma.h"
@@ -43,209 +60,78 @@ volatile float master_volume = 1.0f;
     #define AUDIO_CALLBACK_PWM_PIN 24
     #define AUDIO_ENABLE_PIN 20
 
-    // Pin for PWM audio sample wrap callback (faster than repeating timer, by a lot)
+    // Pin for PWM that wraps at the audio sample rate, paces the
+    // DMA that sends samples (faster than repeating timer, by a lot)
     uint audio_callback_pwm_pin_slice;
     pwm_config audio_callback_pwm_pin_config;
 
-    uint8_t *current_source_data = NULL;
-
-    void ENGINE_FAST_FUNCTION(engine_audio_handle_buffer)(audio_channel_class_obj_t *channel, bool *complete){
-        // When 'buffer_byte_offset = 0' that means the buffer hasn't been filled before, fill it (see that after this function it is immediately incremented)
-        // When 'buffer_byte_offset >= channel->buffer_end' that means the index has run out of data, fill it with more
-        if(channel->buffers_byte_offsets[channel->reading_buffer_index] == 0 || channel->buffers_byte_offsets[channel->reading_buffer_index] >= channel->buffers_ends[channel->reading_buffer_index]){
-            // Reset for the second case above
-            channel->buffers_byte_offsets[channel->reading_buffer_index] = 0;
-
-            // Using the sound resource base, fill this channel's
-            // buffer with audio data from the source resource
-            // channel->buffer_end = channel->source->fill_buffer(channel->source, channel->buffer, channel->source_byte_offset, CHANNEL_BUFFER_SIZE);
-
-            if(channel->source == NULL){
-                return;
+    // Two blocks of PWM levels that two DMA channels take turns
+    // writing to the audio PWM pin's level, one per sample rate PWM
+    // wrap. The DMA channels are chained so the other block starts
+    // right away when one finishes, then the finished block is
+    // refilled with newly mixed samples in the DMA interrupt
+    static uint32_t audio_pwm_blocks[2][ENGINE_AUDIO_MIXER_BLOCK_SIZE];
+    static int audio_pwm_dma_channels[2];
+    static int16_t audio_mixed_block[ENGINE_AUDIO_MIXER_BLOCK_SIZE];
+    static uint32_t audio_last_pwm_level = 0;
+
+    static void ENGINE_FAST_FUNCTION(engine_audio_fill_pwm_block)(uint8_t block_index){
+        uint32_t *block = audio_pwm_blocks[block_index];
+
+        if(engine_audio_mixer_mix(audio_mixed_block, ENGINE_AUDIO_MIXER_BLOCK_SIZE)){
+            for(uint16_t index=0; index<ENGINE_AUDIO_MIXER_BLOCK_SIZE; index++){
+                // Map -32768 ~ 32767 to PWM levels 0 ~ 511 (PWM wrap is set
+                // to 512 levels). The audio pin is PWM channel B, the upper
+                // 16-bits of the slice's counter compare register
+                audio_last_pwm_level = (uint32_t)(audio_mixed_block[index] + 32768) >> 7;
+                block[index] = audio_last_pwm_level << 16;
             }
-
-            sound_resource_base_class_obj_t *source = channel->source;
-
-            current_source_data = source->get_data(channel, CHANNEL_BUFFER_SIZE, &channel->buffers_ends[channel->reading_buffer_index]);
-
-            // memcpy((uint8_t*)channel->buffer, (uint8_t*)current_source_data, channel->buffer_end);
-
-            // https://github.com/raspberrypi/pico-examples/blob/eca13acf57916a0bd5961028314006983894fc84/flash/xip_stream/flash_xip_stream.c#L45-L48
-            // while (!(xip_ctrl_hw->stat & XIP_STAT_FIFO_EMPTY))
-            //     (void) xip_ctrl_hw->stream_fifo;
-            // xip_ctrl_hw->stream_addr = (uint32_t)current_source_data;
-            // xip_ctrl_hw->stream_ctr = channel->buffer_end;
-
-            // Just in case we were too quick, wait while previous DMA might still be active
-            if(dma_channel_is_busy(channel->dma_channel)){
-                ENGINE_WARNING_PRINTF("AudioModule: Waiting on previous DMA transfer to complete, this ideally shouldn't happen");
-                dma_channel_wait_for_finish_blocking(channel->dma_channel);
-            }
-
-            channel->reading_buffer_index = 1 - channel->reading_buffer_index;
-            channel->filling_buffer_index = 1 - channel->filling_buffer_index;
-
-            // https://github.com/raspberrypi/pico-examples/blob/master/flash/xip_stream/flash_xip_stream.c#L58-L70
-            dma_channel_configure(
-                channel->dma_channel,                                   // Channel to be configured
-                &channel->dma_config,                                   // The configuration we just created
-                channel->buffers[channel->filling_buffer_index],        // The initial write address
-                current_source_data,                                    // The initial read address
-                channel->buffers_ends[channel->filling_buffer_index],   // Number of transfers; in this case each is 1 byte
-                true                                                    // Start immediately
-            );
-
-            // Filled amount will always be equal to or less than to
-            // 0 the 'size' passed to 'fill_buffer'. In the case it was
-            // filled with something, increment to the amount filled
-            // further. In the case it is filled with nothing, that means
-            // the last fill made us reach the end of the source data,
-            // figure out if this channel should stop or loop. If loop,
-            // run again right away to fill with more data after resetting
-            // 'source_byte_offset'
-            if(channel->buffers_ends[channel->filling_buffer_index] > 0){
-                channel->source_byte_offset += channel->buffers_ends[channel->filling_buffer_index];
-            }else{
-                // Gets reset no matter what, whether looping or not
-                channel->source_byte_offset = 0;
-
-                // If not looping, disable/remove the source and stop this
-                // channel from being played, otherwise, fill with start data
-                if(channel->loop == false){
-                    *complete = true;
-                }else{
-                    // Run right away to fill buffer with starting data since looping
-                    engine_audio_handle_buffer(channel, complete);
-                }
-            }
-
-            // Not the best solution but when these are both 1 that means
-            // no data has been loaded yet, block until data is loaded into
-            // 1 then load the other buffer while not blocking so that it
-            // can be switched to next time for reading
-            if(channel->reading_buffer_index == channel->filling_buffer_index){
-                dma_channel_wait_for_finish_blocking(channel->dma_channel);
-
-                // Flip only the buffer to fill since we're going to fill it now
-                channel->filling_buffer_index = 1 - channel->filling_buffer_index;
-
-                // Fill the other buffer right now
-                engine_audio_handle_buffer(channel, complete);
+        }else{
+            // Nothing playing, hold the last level so there's no pop
+            for(uint16_t index=0; index<ENGINE_AUDIO_MIXER_BLOCK_SIZE; index++){
+                block[index] = audio_last_pwm_level << 16;
             }
         }
     }
 
+    static void ENGINE_FAST_FUNCTION(engine_audio_dma_irq_handler)(){
+        for(uint8_t block_index=0; block_index<2; block_index++){
+            int dma_channel = audio_pwm_dma_channels[block_index];
 
-    float ENGINE_FAST_FUNCTION(get_wave_sample)(audio_channel_class_obj_t *channel, bool *complete){
-        sound_resource_base_class_obj_t *source = channel->source;
-
-        // Keep returning current sample until time to get next one
-        if(source->play_counter != 0){
-            if(source->play_counter == source->play_counter_max){
-                source->play_counter = 0;
-            }else{
-                source->play_counter++;
-                return source->last_sample;
-            }
-        }
-
-        // Fill buffer with data whether first time or looping
-        engine_audio_handle_buffer(channel, complete);
-
-        uint8_t buffer_index = channel->reading_buffer_index;
-        uint16_t buffer_byte_offset = channel->buffers_byte_offsets[buffer_index];
+            if(dma_channel_get_irq1_status(dma_channel)){
+                dma_channel_acknowledge_irq1(dma_channel);
 
-        // Add samples to total
-        switch(source->bytes_per_sample){
-            case 1:
-            {
-                uint8_t sample_byte = channel->buffers[buffer_index][buffer_byte_offset];       // Get sample as unsigned 8-bit value from 0 to 255
-                source->last_sample = (int8_t)(sample_byte - 128);                              // Center sample in preparation for scaling to -1.0 ~ 1.0. Subtract 128 so that 0 -> -128 and 255 -> 127
-                source->last_sample = source->last_sample / (float)INT8_MAX;                    // Scale from -128 ~ 127 to -1.0078 ~ 1.0 (will clamp later)
+                // The other block is being sent now, point this channel back
+                // at the start of its block (transfer count reloads on its
+                // own) for when it is chained to next and refill the block
+                dma_channel_set_read_addr(dma_channel, audio_pwm_blocks[block_index], false);
+                engine_audio_fill_pwm_block(block_index);
             }
-            break;
-            case 2:
-            {
-                uint8_t sample_byte_lsb = channel->buffers[buffer_index][buffer_byte_offset];   // Get the right-most 8-bits as unsigned 8-bit (really is signed 16-bit byte, bits will still exist in same pattern)
-                uint8_t sample_byte_msb = channel->buffers[buffer_index][buffer_byte_offset+1]; // Get the left-most 8-bits as unsigned 8-bit (really is signed 16-bit byte, bits will still exist in same pattern)
-                source->last_sample = (int16_t)((sample_byte_msb << 8) + sample_byte_lsb);      // Combine bytes to make signed 16-bit value from -32768 ~ 32767
-                source->last_sample = source->last_sample / (float)INT16_MAX;                   // Scale from -32768 ~ 32767 to -1.000031 ~ 1.0 (will clamp later)
-            }
-            break;
-            default:
-                ENGINE_ERROR_PRINTF("AudioModule: Audio source with %d bytes per sample is not supported!", source->bytes_per_sample);
         }
-
-        // Set for the next sample
-        channel->buffers_byte_offsets[buffer_index] += source->bytes_per_sample;
-
-        // Calculate the current time that we're at in the channel's source
-        channel->time = (1.0f / source->sample_rate) * (channel->source_byte_offset / source->bytes_per_sample);
-
-        source->play_counter++;
-
-        return source->last_sample;
-    }
-
-
-    float ENGINE_FAST_FUNCTION(get_tone_sample)(audio_channel_class_obj_t *channel){
-        return tone_sound_resource_get_sample(channel->source);
     }
+#endif
 
 
-    float ENGINE_FAST_FUNCTION(get_rtttl_sample)(audio_channel_class_obj_t *channel, bool *complete){
-        return rtttl_sound_resource_get_sample(channel->source, complete);
-    }
-
-
-    // Samples each channel, adds, normalizes, and sets PWM
-    void ENGINE_FAST_FUNCTION(repeating_audio_callback)(void){
-        float total_sample = 0;
-        bool play_sample = false;
-
-        for(uint8_t icx=0; icx<CHANNEL_COUNT; icx++){
-            bool complete = false;
-            audio_channel_class_obj_t *channel = channels[icx];
-
-            if(channel->source == NULL || channel->busy){
-                continue;
-            }
-
-            // Playing at least one sample, switch flag
-            play_sample = true;
-            float sample = 0.0f;
-
-            if(mp_obj_is_type(channel->source, &wave_sound_resource_class_type)){
-                sample = get_wave_sample(channel, &complete);
-            }else if(mp_obj_is_type(channel->source, &tone_sound_resource_class_type)){
-                sample = get_tone_sample(channel);
-            }else if(mp_obj_is_type(channel->source, &rtttl_sound_resource_class_type)){
-                sample = get_rtttl_sample(channel, &complete);
-            }
-
-            total_sample += sample * channel->gain * master_volume;
-
-            if(complete && channel->loop == false){
-                audio_channel_stop(channel);
-            }
+void engine_audio_lock(){
+    #if defined(__EMSCRIPTEN__)
+        // Nothing to do
+    #elif defined(__unix__)
+        if(audio_device != 0){
+            SDL_LockAudioDevice(audio_device);
         }
+    #endif
+}
 
-        if(play_sample){
-            // Up to the user to make sure all playing channels do not add up and
-            // go out of -1.0 ~ 1.0 range. Clamp the total sample sum since
-            // very likely it could end of out of bounds, and map to PWM levels
-            // NOTE: Set PWM wrap to 512 levels so it will use values from 0 to 511
-            total_sample = engine_math_map_clamp(total_sample, -1.0f, 1.0f, 0.0f, 511.0f);
 
-            // Actually set the wrap value to play this sample
-            pwm_set_gpio_level(AUDIO_PWM_PIN, (uint32_t)(total_sample));
+void engine_audio_unlock(){
+    #if defined(__EMSCRIPTEN__)
+        // Nothing to do
+    #elif defined(__unix__)
+        if(audio_device != 0){
+            SDL_UnlockAudioDevice(audio_device);
         }
-
-        pwm_clear_irq(audio_callback_pwm_pin_slice);
-
-        return;
-    }
-#endif
+    #endif
+}
 
 
 void engine_audio_setup_playback(){
@@ -292,20 +178,75 @@ void engine_audio_setup(){
         channels[icx] = channel;
     }
 
-    #if defined(__unix__)
+    #if defined(__EMSCRIPTEN__)
         // Nothing to do
+    #elif defined(__unix__)
+        // Play through SDL. Not being able to is not an
+        // error, games still run, just without sound
+        if(SDL_InitSubSystem(SDL_INIT_AUDIO) < 0){
+            ENGINE_WARNING_PRINTF("EngineAudio: Could not initialize SDL audio, sound will not play: %s", SDL_GetError());
+            return;
+        }
+
+        SDL_AudioSpec audio_spec;
+        memset(&audio_spec, 0, sizeof(SDL_AudioSpec));
+        audio_spec.freq = (int)ENGINE_AUDIO_SAMPLE_RATE;
+        audio_spec.format = AUDIO_S16SYS;
+        audio_spec.channels = 1;
+        audio_spec.samples = ENGINE_AUDIO_MIXER_BLOCK_SIZE * 4;
+        audio_spec.callback = engine_audio_sdl_callback;
+
+        audio_device = SDL_OpenAudioDevice(NULL, 0, &audio_spec, NULL, 0);
+
+        if(audio_device == 0){
+            ENGINE_WARNING_PRINTF("EngineAudio: Could not open SDL audio device, sound will not play: %s", SDL_GetError());
+            return;
+        }
+
+        SDL_PauseAudioDevice(audio_device, 0);
     #elif defined(__arm__)
-        //generate the interrupt at the audio sample rate to set the PWM duty cycle
+        // PWM slice that wraps at the audio sample rate, only used to
+        // pace the DMA sending samples to the audio PWM pin
         audio_callback_pwm_pin_slice = pwm_gpio_to_slice_num(AUDIO_CALLBACK_PWM_PIN);
-        pwm_clear_irq(audio_callback_pwm_pin_slice);
-        pwm_set_irq_enabled(audio_callback_pwm_pin_slice, true);
-        irq_set_exclusive_handler(PWM_IRQ_WRAP_0, repeating_audio_callback);
-        irq_set_priority(PWM_IRQ_WRAP_0, 1);
-        irq_set_enabled(PWM_IRQ_WRAP_0, true);
         audio_callback_pwm_pin_config = pwm_get_default_config();
         pwm_config_set_clkdiv_int(&audio_callback_pwm_pin_config, 1);
         engine_audio_adjust_playback_with_freq(150 * 1000 * 1000);
+
+        uint audio_pwm_pin_slice = pwm_gpio_to_slice_num(AUDIO_PWM_PIN);
+
+        audio_pwm_dma_channels[0] = dma_claim_unused_channel(true);
+        audio_pwm_dma_channels[1] = dma_claim_unused_channel(true);
+
+        for(uint8_t block_index=0; block_index<2; block_index++){
+            int dma_channel = audio_pwm_dma_channels[block_index];
+
+            engine_audio_fill_pwm_block(block_index);
+
+            dma_channel_config dma_config = dma_channel_get_default_config(dma_channel);
+            channel_config_set_transfer_data_size(&dma_config, DMA_SIZE_32);
+            channel_config_set_read_increment(&dma_config, true);
+            channel_config_set_write_increment(&dma_config, false);
+            channel_config_set_dreq(&dma_config, pwm_get_dreq(audio_callback_pwm_pin_slice));
+            channel_config_set_chain_to(&dma_config, audio_pwm_dma_channels[1 - block_index]);
+
+            dma_channel_configure(
+                dma_channel,
+                &dma_config,
+                &pwm_hw->slice[audio_pwm_pin_slice].cc,         // Write to the audio pin's PWM level
+                audio_pwm_blocks[block_index],
+                ENGINE_AUDIO_MIXER_BLOCK_SIZE,
+                false                                           // Started below
+            );
+
+            dma_channel_set_irq1_enabled(dma_channel, true);
+        }
+
+        irq_add_shared_handler(DMA_IRQ_1, engine_audio_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+        irq_set_priority(DMA_IRQ_1, 1);
+        irq_set_enabled(DMA_IRQ_1, true);
+
         pwm_init(audio_callback_pwm_pin_slice, &audio_callback_pwm_pin_config, true);
+        dma_channel_start(audio_pwm_dma_channels[0]);
     #endif
 }
 
@@ -328,8 +269,14 @@ void engine_audio_play_on_channel(mp_obj_t sound_resource_obj, audio_channel_cla
     // incase of two `.play(...)` calls in a row
     audio_channel_stop(channel);
 
+    // Figure out how to get samples from this source
+    // now instead of every time samples are mixed
+    engine_audio_channel_fetch_t fetch = engine_audio_mixer_get_fetch(sound_resource_obj);
+    bool loop = mp_obj_get_int(loop_obj);
+
     // Mark the channel as busy so that the interrupt
     // doesn't use it
+    engine_audio_lock();
     channel->busy = true;
 
     if(mp_obj_is_type(sound_resource_obj, &wave_sound_resource_class_type)){
@@ -356,11 +303,13 @@ void engine_audio_play_on_channel(mp_obj_t sound_resource_obj, audio_channel_cla
     }
 
     channel->source = sound_resource_obj;
-    channel->loop = mp_obj_get_int(loop_obj);
+    channel->fetch = fetch;
+    channel->loop = loop;
     channel->done = false;
 
     // Now let the interrupt use it
     channel->busy = false;
+    engine_audio_unlock();
 }
 
 
@@ -418,7 +367,7 @@ static mp_obj_t engine_audio_set_volume(mp_obj_t new_volume){
     // Don't clamp so that users can clip their waveforms
     // which adds more area under the curve and therefore
     // is louder (sounds worse though)
-    master_volume = mp_obj_get_float(new_volume);
+    engine_audio_mixer_set_volume(mp_obj_get_float(new_volume));
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_1(engine_audio_set_volume_obj, engine_audio_set_volume);
@@ -431,7 +380,7 @@ MP_DEFINE_CONST_FUN_OBJ_1(engine_audio_set_volume_obj, engine_audio_set_volume);
     RETURN: None
 */
 static mp_obj_t engine_audio_get_volume(){
-    return mp_obj_new_float(master_volume);
+    return mp_obj_new_float(engine_audio_mixer_get_volume());
 }
 MP_DEFINE_CONST_FUN_OBJ_0(engine_audio_get_volume_obj, engine_audio_get_volume);
 
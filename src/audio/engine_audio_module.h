@@ -13,6 +13,16 @@ void engine_audio_setup_playback();
 // the audio playback interrupt will be adjusted
 void engine_audio_adjust_playback_with_freq(uint32_t core_clock_hz);
 
+// Defined in engine_audio_module.c, the mixer goes through these
+extern volatile mp_obj_t channels[CHANNEL_COUNT];
+
+// Keeps the mixer from running while a channel's source is being
+// changed. On the device the mixer runs in an interrupt that skips
+// channels marked `busy`, on Unix it runs on SDL's audio thread
+// and has to be locked out instead
+void engine_audio_lock();
+void engine_audio_unlock();
+
 void engine_audio_play_on_channel(mp_obj_t sound_resource_obj, audio_channel_class_obj_t *channel, mp_obj_t loop_obj);
 void engine_audio_stop_all();
 
@@ -1,6 +1,14 @@
 #include "py/obj.h"
 
 #include "debug_print.h"
+#include "engine_debug_profiler.h"
+#include "nodes/3D/camera_node.h"
+#include "nodes/node_bitmap_cache.h"
+#include "draw/engine_display_draw.h"
+#include "draw/engine_color.h"
+#include "draw/engine_shader.h"
+#include "utility/engine_time.h"
+#include <stdlib.h>
 
 
 /*  --- doc ---
@@ -72,6 +80,242 @@ static mp_obj_t engine_debug_enable_setting(mp_obj_t debug_setting){
 MP_DEFINE_CONST_FUN_OBJ_1(engine_debug_enable_setting_obj, engine_debug_enable_setting);
 
 
+/*  --- doc ---
+    NAME: set_profiling
+    ID: set_profiling
+    DESC: Enables or disables timing each stage of every engine tick (link, physics, io, animation, tick, delete, draw, gui and display). The last 128 frames are kept, see {ref_link:get_profile}. Frames where the FPS limit skipped drawing add their link and physics time to the next frame that draws. Disabled by default and after soft resets
+    PARAM: [type=bool]  [name=enabled]  [value=True or False]
+    RETURN: None
+*/ 
+static mp_obj_t engine_debug_set_profiling(mp_obj_t enabled){
+    engine_debug_profiler_set_enabled(mp_obj_is_true(enabled));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(engine_debug_set_profiling_obj, engine_debug_set_profiling);
+
+
+/*  --- doc ---
+    NAME: get_profile
+    ID: get_profile
+    DESC: Returns a dictionary of stage names ("link", "physics", "io", "animation", "tick", "delete", "draw", "gui", "display" and "total") to (min, avg, max, p99) tuples of milliseconds over the recorded frames. Empty if profiling is disabled or no frames were recorded yet
+    RETURN: dict
+*/ 
+static mp_obj_t engine_debug_get_profile(){
+    return engine_debug_profiler_get_stats();
+}
+MP_DEFINE_CONST_FUN_OBJ_0(engine_debug_get_profile_obj, engine_debug_get_profile);
+
+
+/*  --- doc ---
+    NAME: clear_profile
+    ID: clear_profile
+    DESC: Forgets all recorded frames, useful for profiling one part of a game at a time
+    RETURN: None
+*/ 
+static mp_obj_t engine_debug_clear_profile(){
+    engine_debug_profiler_clear();
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_0(engine_debug_clear_profile_obj, engine_debug_clear_profile);
+
+
+/*  --- doc ---
+    NAME: get_frame_allocations
+    ID: get_frame_allocations
+    DESC: Returns how many heap blocks (16 bytes each) were allocated during the last engine tick that ran, counting Python callbacks and the engine together (and link/physics from ticks skipped by the FPS limit). Always counted, even when profiling is disabled. A game whose callbacks don't allocate should see 0 here once everything is created. If a garbage collection ran during the frame only allocations after it are counted
+    RETURN: int
+*/ 
+static mp_obj_t engine_debug_get_frame_allocations(){
+    return mp_obj_new_int(engine_debug_profiler_get_frame_allocations());
+}
+MP_DEFINE_CONST_FUN_OBJ_0(engine_debug_get_frame_allocations_obj, engine_debug_get_frame_allocations);
+
+
+/*  --- doc ---
+    NAME: get_culled_count
+    ID: get_culled_count
+    DESC: Returns how many times a 2D node was skipped for a camera the last time nodes were drawn because it was entirely outside of the camera's viewport (or the areas of the screen being redrawn). A node culled for two cameras counts twice. Always counted, even when profiling is disabled
+    RETURN: int
+*/ 
+static mp_obj_t engine_debug_get_culled_count(){
+    return mp_obj_new_int(engine_camera_get_culled_count());
+}
+MP_DEFINE_CONST_FUN_OBJ_0(engine_debug_get_culled_count_obj, engine_debug_get_culled_count);
+
+
+/*  --- doc ---
+    NAME: get_bitmap_cache_counts
+    ID: get_bitmap_cache_counts
+    DESC: Returns how many times the last time nodes were drawn a node with `cache_as_bitmap` was copied from its cache (hits) or had to be drawn into it again because something in it changed (misses), once per camera. Always counted, even when profiling is disabled
+    RETURN: tuple (hits, misses)
+*/ 
+static mp_obj_t engine_debug_get_bitmap_cache_counts(){
+    mp_obj_t counts[2] = {
+        mp_obj_new_int(node_bitmap_cache_get_hit_count()),
+        mp_obj_new_int(node_bitmap_cache_get_miss_count())
+    };
+
+    return mp_obj_new_tuple(2, counts);
+}
+MP_DEFINE_CONST_FUN_OBJ_0(engine_debug_get_bitmap_cache_counts_obj, engine_debug_get_bitmap_cache_counts);
+
+
+/*  --- doc ---
+    NAME: set_fixed_point_blit
+    ID: set_fixed_point_blit
+    DESC: Rotated and scaled sprites (and text) are drawn by stepping through the texture with 16.16 fixed-point integers. Disable to draw them with the slower floating-point path instead, for comparing accuracy or speed. Enabled by default and after soft resets
+    PARAM: [type=bool]  [name=enabled]  [value=True or False]
+    RETURN: None
+*/ 
+static mp_obj_t engine_debug_set_fixed_point_blit(mp_obj_t enabled){
+    engine_draw_set_blit_fixed_point(mp_obj_is_true(enabled));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(engine_debug_set_fixed_point_blit_obj, engine_debug_set_fixed_point_blit);
+
+
+// Largest difference in any channel between two RGB565 colors
+static uint16_t engine_debug_color_difference(uint16_t a, uint16_t b){
+    uint16_t difference_r = abs((int)(a >> 11) - (int)(b >> 11));
+    uint16_t difference_g = abs((int)((a >> 5) & 0x3F) - (int)((b >> 5) & 0x3F));
+    uint16_t difference_b = abs((int)(a & 0x1F) - (int)(b & 0x1F));
+    return MAX(difference_r, MAX(difference_g, difference_b));
+}
+
+
+/*  --- doc ---
+    NAME: check_color_blending
+    ID: check_color_blending
+    DESC: Compares the integer color blending used while drawing against the floating-point math it replaced for pairs of colors across the range of each channel and amounts from 0.0 to 1.0. Returns the largest difference seen in any channel (in steps of that channel) for opacity blending and for the color interpolation that text and blend shaders use. Used by tests, slow
+    RETURN: tuple (alpha blend difference, interpolate difference)
+*/ 
+static mp_obj_t engine_debug_check_color_blending(){
+    // Each channel at 0, its max and a few steps between
+    const uint16_t steps_5_bit[] = {0, 1, 8, 15, 16, 23, 30, 31};
+    const uint16_t steps_6_bit[] = {0, 1, 16, 31, 32, 47, 62, 63};
+
+    uint16_t colors[8*8*8];
+    uint16_t color_count = 0;
+
+    for(uint8_t r=0; r<8; r++){
+        for(uint8_t g=0; g<8; g++){
+            for(uint8_t b=0; b<8; b++){
+                colors[color_count++] = (steps_5_bit[r] << 11) | (steps_6_bit[g] << 5) | steps_5_bit[b];
+            }
+        }
+    }
+
+    uint16_t worst_alpha_blend = 0;
+    uint16_t worst_blend = 0;
+
+    for(uint16_t from=0; from<color_count; from++){
+        for(uint16_t to=0; to<color_count; to+=7){
+            for(uint8_t step=0; step<=16; step++){
+                float amount = step / 16.0f;
+
+                uint16_t alpha_blend_difference = engine_debug_color_difference(engine_color_alpha_blend(colors[from], colors[to], amount), engine_color_alpha_blend_float(colors[from], colors[to], amount));
+                uint16_t blend_difference = engine_debug_color_difference(engine_color_blend(colors[from], colors[to], amount), engine_color_blend_float(colors[from], colors[to], amount));
+
+                worst_alpha_blend = MAX(worst_alpha_blend, alpha_blend_difference);
+                worst_blend = MAX(worst_blend, blend_difference);
+            }
+        }
+    }
+
+    mp_obj_t differences[2] = {
+        mp_obj_new_int(worst_alpha_blend),
+        mp_obj_new_int(worst_blend),
+    };
+
+    return mp_obj_new_tuple(2, differences);
+}
+MP_DEFINE_CONST_FUN_OBJ_0(engine_debug_check_color_blending_obj, engine_debug_check_color_blending);
+
+
+// Shaded pixels per second of `execute` running `shader` over `count` pixels
+static float engine_debug_time_shader(uint16_t (*execute)(uint16_t, uint16_t, float, engine_shader_t*), engine_shader_t *shader, uint32_t count){
+    // Kept so that the shading isn't optimized away
+    static volatile uint16_t sink = 0;
+
+    uint16_t bg = 0x1234;
+    uint32_t start = engine_time_precise_ticks();
+
+    for(uint32_t index=0; index<count; index++){
+        bg = execute(bg, (uint16_t)(index * 0x9E37), (index & 0xFF) / 255.0f, shader);
+    }
+
+    uint32_t elapsed = engine_time_precise_ticks() - start;
+    sink = bg;
+
+    float elapsed_us = MAX(1, elapsed) / engine_time_precise_ticks_per_us();
+    return count / (elapsed_us / 1000000.0f);
+}
+
+
+// The blend functions as shaders so they can be timed the same way
+static uint16_t engine_debug_shader_alpha_blend(uint16_t bg, uint16_t fg, float amount, engine_shader_t *shader){
+    return engine_color_alpha_blend(bg, fg, amount);
+}
+
+static uint16_t engine_debug_shader_alpha_blend_float(uint16_t bg, uint16_t fg, float amount, engine_shader_t *shader){
+    return engine_color_alpha_blend_float(bg, fg, amount);
+}
+
+static uint16_t engine_debug_shader_blend(uint16_t bg, uint16_t fg, float amount, engine_shader_t *shader){
+    return engine_color_blend(bg, fg, amount);
+}
+
+static uint16_t engine_debug_shader_blend_float(uint16_t bg, uint16_t fg, float amount, engine_shader_t *shader){
+    return engine_color_blend_float(bg, fg, amount);
+}
+
+
+/*  --- doc ---
+    NAME: benchmark_color_blending
+    ID: benchmark_color_blending
+    DESC: Times blending `count` pixels with the integer color blending used while drawing and with the floating-point math it replaced
+    PARAM: [type=int]  [name=count]  [value=number of pixels to blend with each]
+    RETURN: dict of "alpha_blend", "alpha_blend_float", "blend" and "blend_float" to blended pixels per second
+*/ 
+static mp_obj_t engine_debug_benchmark_color_blending(mp_obj_t count_obj){
+    uint32_t count = mp_obj_get_int(count_obj);
+    engine_time_precise_init();
+
+    mp_obj_t results = mp_obj_new_dict(4);
+    mp_obj_dict_store(results, MP_OBJ_NEW_QSTR(MP_QSTR_alpha_blend), mp_obj_new_float(engine_debug_time_shader(engine_debug_shader_alpha_blend, NULL, count)));
+    mp_obj_dict_store(results, MP_OBJ_NEW_QSTR(MP_QSTR_alpha_blend_float), mp_obj_new_float(engine_debug_time_shader(engine_debug_shader_alpha_blend_float, NULL, count)));
+    mp_obj_dict_store(results, MP_OBJ_NEW_QSTR(MP_QSTR_blend), mp_obj_new_float(engine_debug_time_shader(engine_debug_shader_blend, NULL, count)));
+    mp_obj_dict_store(results, MP_OBJ_NEW_QSTR(MP_QSTR_blend_float), mp_obj_new_float(engine_debug_time_shader(engine_debug_shader_blend_float, NULL, count)));
+    return results;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(engine_debug_benchmark_color_blending_obj, engine_debug_benchmark_color_blending);
+
+
+/*  --- doc ---
+    NAME: benchmark_shader
+    ID: benchmark_shader
+    DESC: Times shading `count` pixels with the shader that colors text (interpolate to a color then blend by opacity), compiled as it is used while drawing and run through the op code interpreter it replaced
+    PARAM: [type=int]  [name=count]  [value=number of pixels to shade with each]
+    RETURN: dict of "compiled" and "interpreted" to shaded pixels per second
+*/ 
+static mp_obj_t engine_debug_benchmark_shader(mp_obj_t count_obj){
+    uint32_t count = mp_obj_get_int(count_obj);
+    engine_time_precise_init();
+
+    // Own copy of the text shader, setting the interpolation on the
+    // builtin one would change how the next text drawn looks
+    engine_shader_t shader = *engine_get_builtin_shader(BLEND_OPACITY_SHADER);
+    engine_shader_set_interpolate(&shader, 0xFDA0, 0.5f);
+    engine_shader_compile(&shader);
+
+    mp_obj_t results = mp_obj_new_dict(2);
+    mp_obj_dict_store(results, MP_OBJ_NEW_QSTR(MP_QSTR_compiled), mp_obj_new_float(engine_debug_time_shader(shader.execute, &shader, count)));
+    mp_obj_dict_store(results, MP_OBJ_NEW_QSTR(MP_QSTR_interpreted), mp_obj_new_float(engine_debug_time_shader(engine_pixel_shader_interpret, &shader, count)));
+    return results;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(engine_debug_benchmark_shader_obj, engine_debug_benchmark_shader);
+
+
 /*  --- doc ---
     NAME: engine_debug
     ID: engine_debug
@@ -79,6 +323,16 @@ MP_DEFINE_CONST_FUN_OBJ_1(engine_debug_enable_setting_obj, engine_debug_enable_s
     ATTR: [type=function]   [name={ref_link:enable_all}]        [value=function] 
     ATTR: [type=function]   [name={ref_link:disable_all}]       [value=function]
     ATTR: [type=function]   [name={ref_link:enable_setting}]    [value=function]
+    ATTR: [type=function]   [name={ref_link:set_profiling}]     [value=function]
+    ATTR: [type=function]   [name={ref_link:get_profile}]       [value=function]
+    ATTR: [type=function]   [name={ref_link:clear_profile}]     [value=function]
+    ATTR: [type=function]   [name={ref_link:get_frame_allocations}] [value=function]
+    ATTR: [type=function]   [name={ref_link:get_culled_count}]  [value=function]
+    ATTR: [type=function]   [name={ref_link:get_bitmap_cache_counts}]  [value=function]
+    ATTR: [type=function]   [name={ref_link:set_fixed_point_blit}] [value=function]
+    ATTR: [type=function]   [name={ref_link:check_color_blending}] [value=function]
+    ATTR: [type=function]   [name={ref_link:benchmark_color_blending}] [value=function]
+    ATTR: [type=function]   [name={ref_link:benchmark_shader}]  [value=function]
     ATTR: [type=enum/int]   [name=info]                         [value=0]
     ATTR: [type=enum/int]   [name=warnings]                     [value=1]
     ATTR: [type=enum/int]   [name=errors]                       [value=2]
@@ -89,6 +343,16 @@ static const mp_rom_map_elem_t engine_debug_globals_table[] = {
     { MP_OBJ_NEW_QSTR(MP_QSTR_enable_all), (mp_obj_t)&engine_debug_enable_all_obj },
     { MP_OBJ_NEW_QSTR(MP_QSTR_disable_all), (mp_obj_t)&engine_debug_disable_all_obj },
     { MP_OBJ_NEW_QSTR(MP_QSTR_enable_setting), (mp_obj_t)&engine_debug_enable_setting_obj },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_set_profiling), (mp_obj_t)&engine_debug_set_profiling_obj },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_get_profile), (mp_obj_t)&engine_debug_get_profile_obj },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_clear_profile), (mp_obj_t)&engine_debug_clear_profile_obj },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_get_frame_allocations), (mp_obj_t)&engine_debug_get_frame_allocations_obj },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_get_culled_count), (mp_obj_t)&engine_debug_get_culled_count_obj },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_get_bitmap_cache_counts), (mp_obj_t)&engine_debug_get_bitmap_cache_counts_obj },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_set_fixed_point_blit), (mp_obj_t)&engine_debug_set_fixed_point_blit_obj },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_check_color_blending), (mp_obj_t)&engine_debug_check_color_blending_obj },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_benchmark_color_blending), (mp_obj_t)&engine_debug_benchmark_color_blending_obj },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_benchmark_shader), (mp_obj_t)&engine_debug_benchmark_shader_obj },
     { MP_ROM_QSTR(MP_QSTR_info), MP_ROM_INT(DEBUG_SETTING_INFO) },
     { MP_ROM_QSTR(MP_QSTR_warnings), MP_ROM_INT(DEBUG_SETTING_WARNINGS) },
     { MP_ROM_QSTR(MP_QSTR_errors), MP_ROM_INT(DEBUG_SETTING_ERRORS) },
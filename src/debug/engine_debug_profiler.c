@@ -0,0 +1,195 @@
+#include "engine_debug_profiler.h"
+#include "debug/debug_print.h"
+#include "utility/engine_time.h"
+#include "py/runtime.h"
+#include "py/mpstate.h"
+#include <stdlib.h>
+#include <string.h>
+
+
+static bool profiler_enabled = false;
+
+// Ring of recorded frames, each with a time (in precise ticks) per phase
+static uint32_t (*profiler_frames)[ENGINE_DEBUG_PROFILER_PHASE_COUNT] = NULL;
+static uint16_t profiler_frame_next_index = 0;
+static uint16_t profiler_frame_count = 0;
+
+// Frame being timed and when the last phase ended
+static uint32_t profiler_current[ENGINE_DEBUG_PROFILER_PHASE_COUNT];
+static uint32_t profiler_last_mark = 0;
+
+// GC heap blocks allocated during the frame being timed and
+// the last one. Counted whether profiling is enabled or not
+static size_t profiler_alloc_start = 0;
+static size_t profiler_frame_allocations = 0;
+static size_t profiler_last_frame_allocations = 0;
+
+static const qstr profiler_phase_names[ENGINE_DEBUG_PROFILER_PHASE_COUNT] = {
+    MP_QSTR_link,
+    MP_QSTR_physics,
+    MP_QSTR_io,
+    MP_QSTR_animation,
+    MP_QSTR_tick,
+    MP_QSTR_delete,
+    MP_QSTR_draw,
+    MP_QSTR_gui,
+    MP_QSTR_display,
+    MP_QSTR_total,
+};
+
+
+void engine_debug_profiler_set_enabled(bool enabled){
+    if(enabled == profiler_enabled){
+        return;
+    }
+
+    if(enabled){
+        profiler_frames = malloc(ENGINE_DEBUG_PROFILER_FRAME_COUNT * sizeof(*profiler_frames));
+
+        if(profiler_frames == NULL){
+            mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("EngineProfiler: ERROR: Ran out of memory allocating frame ring"));
+        }
+
+        engine_time_precise_init();
+    }else{
+        free(profiler_frames);
+        profiler_frames = NULL;
+    }
+
+    profiler_enabled = enabled;
+    engine_debug_profiler_clear();
+}
+
+
+bool engine_debug_profiler_is_enabled(){
+    return profiler_enabled;
+}
+
+
+void engine_debug_profiler_start(){
+    #if MICROPY_GC_ALLOC_THRESHOLD
+        profiler_alloc_start = MP_STATE_MEM(gc_alloc_amount);
+    #endif
+
+    if(profiler_enabled == false){
+        return;
+    }
+
+    profiler_last_mark = engine_time_precise_ticks();
+}
+
+
+void engine_debug_profiler_mark(uint8_t phase){
+    if(profiler_enabled == false){
+        return;
+    }
+
+    uint32_t now = engine_time_precise_ticks();
+    profiler_current[phase] += now - profiler_last_mark;
+    profiler_last_mark = now;
+}
+
+
+void engine_debug_profiler_end(bool ticked){
+    #if MICROPY_GC_ALLOC_THRESHOLD
+        // Reset to zero by every collection, if one happened
+        // only what was allocated after it can be counted
+        size_t alloc_amount = MP_STATE_MEM(gc_alloc_amount);
+
+        if(alloc_amount >= profiler_alloc_start){
+            profiler_frame_allocations += alloc_amount - profiler_alloc_start;
+        }else{
+            profiler_frame_allocations += alloc_amount;
+        }
+    #endif
+
+    if(ticked){
+        profiler_last_frame_allocations = profiler_frame_allocations;
+        profiler_frame_allocations = 0;
+    }
+
+    if(profiler_enabled == false || ticked == false){
+        return;
+    }
+
+    uint32_t total = 0;
+
+    for(uint8_t phase=0; phase<ENGINE_DEBUG_PROFILER_PHASE_TOTAL; phase++){
+        total += profiler_current[phase];
+    }
+
+    profiler_current[ENGINE_DEBUG_PROFILER_PHASE_TOTAL] = total;
+
+    memcpy(profiler_frames[profiler_frame_next_index], profiler_current, sizeof(profiler_current));
+    memset(profiler_current, 0, sizeof(profiler_current));
+
+    profiler_frame_next_index = (profiler_frame_next_index + 1) % ENGINE_DEBUG_PROFILER_FRAME_COUNT;
+
+    if(profiler_frame_count < ENGINE_DEBUG_PROFILER_FRAME_COUNT){
+        profiler_frame_count++;
+    }
+}
+
+
+void engine_debug_profiler_clear(){
+    memset(profiler_current, 0, sizeof(profiler_current));
+    profiler_frame_next_index = 0;
+    profiler_frame_count = 0;
+}
+
+
+size_t engine_debug_profiler_get_frame_allocations(){
+    return profiler_last_frame_allocations;
+}
+
+
+static int engine_debug_profiler_compare(const void *a, const void *b){
+    uint32_t time_a = *(const uint32_t*)a;
+    uint32_t time_b = *(const uint32_t*)b;
+    return (time_a > time_b) - (time_a < time_b);
+}
+
+
+mp_obj_t engine_debug_profiler_get_stats(){
+    mp_obj_t stats = mp_obj_new_dict(ENGINE_DEBUG_PROFILER_PHASE_COUNT);
+
+    if(profiler_frame_count == 0){
+        return stats;
+    }
+
+    float ms_per_tick = 1.0f / (engine_time_precise_ticks_per_us() * 1000.0f);
+
+    // Index of the 99th percentile in the sorted times
+    uint16_t p99_index = (profiler_frame_count * 99 + 99) / 100 - 1;
+
+    uint32_t sorted[ENGINE_DEBUG_PROFILER_FRAME_COUNT];
+
+    for(uint8_t phase=0; phase<ENGINE_DEBUG_PROFILER_PHASE_COUNT; phase++){
+        uint64_t sum = 0;
+
+        for(uint16_t frame=0; frame<profiler_frame_count; frame++){
+            sorted[frame] = profiler_frames[frame][phase];
+            sum += sorted[frame];
+        }
+
+        qsort(sorted, profiler_frame_count, sizeof(uint32_t), engine_debug_profiler_compare);
+
+        mp_obj_t phase_stats[4] = {
+            mp_obj_new_float(sorted[0] * ms_per_tick),
+            mp_obj_new_float(((float)sum / profiler_frame_count) * ms_per_tick),
+            mp_obj_new_float(sorted[profiler_frame_count-1] * ms_per_tick),
+            mp_obj_new_float(sorted[p99_index] * ms_per_tick),
+        };
+
+        mp_obj_dict_store(stats, MP_OBJ_NEW_QSTR(profiler_phase_names[phase]), mp_obj_new_tuple(4, phase_stats));
+    }
+
+    return stats;
+}
+
+
+void engine_debug_profiler_reset(){
+    engine_debug_profiler_set_enabled(false);
+    profiler_frame_allocations = 0;
+    profiler_last_frame_allocations = 0;
+}
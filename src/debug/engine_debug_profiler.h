@@ -0,0 +1,63 @@
+#ifndef ENGINE_DEBUG_PROFILER_H
+#define ENGINE_DEBUG_PROFILER_H
+
+#include "py/obj.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// Frame profiler (opt-in): times each stage of `engine_tick()` and keeps
+// the last ENGINE_DEBUG_PROFILER_FRAME_COUNT frames in a ring so that
+// min/avg/max/p99 per stage can be asked for from Python. Times come
+// from `engine_time_precise_ticks()` (DWT cycles on the device).
+// GC heap allocations per frame are always counted, enabled or not
+
+// Stages of `engine_tick()`, in the order they run. Link and
+// physics run every call, even when the FPS limit skips the
+// rest of the frame, so they are summed until the frame runs
+#define ENGINE_DEBUG_PROFILER_PHASE_LINK        0
+#define ENGINE_DEBUG_PROFILER_PHASE_PHYSICS     1
+#define ENGINE_DEBUG_PROFILER_PHASE_IO          2
+#define ENGINE_DEBUG_PROFILER_PHASE_ANIMATION   3
+#define ENGINE_DEBUG_PROFILER_PHASE_TICK        4
+#define ENGINE_DEBUG_PROFILER_PHASE_DELETE      5
+#define ENGINE_DEBUG_PROFILER_PHASE_DRAW        6
+#define ENGINE_DEBUG_PROFILER_PHASE_GUI         7
+#define ENGINE_DEBUG_PROFILER_PHASE_DISPLAY     8
+#define ENGINE_DEBUG_PROFILER_PHASE_TOTAL       9   // Sum of the above
+#define ENGINE_DEBUG_PROFILER_PHASE_COUNT       10
+
+// How many of the most recent frames are kept (about 2s at 60 FPS)
+#define ENGINE_DEBUG_PROFILER_FRAME_COUNT 128
+
+
+// Allocates the ring when enabled and frees it when disabled
+void engine_debug_profiler_set_enabled(bool enabled);
+bool engine_debug_profiler_is_enabled();
+
+// Call at the start of `engine_tick()`
+void engine_debug_profiler_start();
+
+// Adds the time since the last start/mark to `phase` of the current frame
+void engine_debug_profiler_mark(uint8_t phase);
+
+// Call at the end of `engine_tick()`, the current frame is only
+// added to the ring when the rest of the frame ran (`ticked`)
+void engine_debug_profiler_end(bool ticked);
+
+// Forgets all recorded frames
+void engine_debug_profiler_clear();
+
+// Returns a dictionary of phase names to (min, avg, max, p99)
+// tuples in milliseconds over the recorded frames
+mp_obj_t engine_debug_profiler_get_stats();
+
+// Number of GC heap blocks (MICROPY_BYTES_PER_GC_BLOCK bytes each)
+// allocated during the last frame that ran, engine and Python code
+// included. Only what comes after a collection is counted if one
+// happened during the frame
+size_t engine_debug_profiler_get_frame_allocations();
+
+// Disables profiling and frees the ring
+void engine_debug_profiler_reset();
+
+#endif  // ENGINE_DEBUG_PROFILER_H
@@ -1,5 +1,6 @@
 #include "engine_display.h"
 #include "engine_display_common.h"
+#include "engine_display_damage.h"
 #include "draw/engine_display_draw.h"
 #include "debug/debug_print.h"
 #include "py/obj.h"
@@ -40,8 +41,38 @@ void engine_display_init(){
 }
 
 
+// Only sends the areas that changed. The screen buffers are not
+// cleared after since the next frame is drawn on top of them
+static void engine_display_send_damaged(){
+    engine_display_rect_t *rects = NULL;
+    uint8_t rect_count = engine_display_damage_get_send_rects(&rects);
+
+    // Nothing changed, keep drawing to the same screen buffer
+    if(rect_count == 0){
+        return;
+    }
+
+    #if defined(__EMSCRIPTEN__)
+        engine_display_web_update_screen(active_screen_buffer);
+    #elif defined(__unix__)
+        engine_display_sdl_update_screen_regions(active_screen_buffer, rects, rect_count);
+    #elif defined(__arm__)
+        for(uint8_t index=0; index<rect_count; index++){
+            engine_display_rect_t *rect = &rects[index];
+            engine_display_gc9107_update_region(active_screen_buffer, rect->x0, rect->y0, rect->x1 - rect->x0, rect->y1 - rect->y0);
+        }
+    #endif
+
+    engine_switch_active_screen_buffer();
+}
+
+
 void engine_display_send(){
-    // Send the screen buffer to the display
+    if(engine_display_damage_is_enabled()){
+        engine_display_send_damaged();
+        return;
+    }
+
     // Send the screen buffer to the display
     #if defined(__EMSCRIPTEN__)
         engine_display_web_update_screen(active_screen_buffer);
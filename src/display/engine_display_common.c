@@ -14,6 +14,14 @@ uint16_t *screen_buffers[2];
 uint16_t *active_screen_buffer;
 uint16_t *depth_buffer;
 
+// What `active_screen_buffer` and `depth_buffer` were
+// before drawing was pointed at a texture
+static uint16_t *target_saved_screen_buffer = NULL;
+static uint16_t *target_saved_depth_buffer = NULL;
+
+uint16_t engine_display_target_width = SCREEN_WIDTH;
+uint16_t engine_display_target_height = SCREEN_HEIGHT;
+
 // Used to clear the screen
 uint16_t engine_fill_color = 0x0000;
 uint16_t *engine_fill_background = NULL;
@@ -117,6 +125,11 @@ void engine_switch_active_screen_buffer(){
 }
 
 
+uint8_t engine_display_get_active_screen_buffer_index(){
+    return active_screen_buffer_index;
+}
+
+
 void ENGINE_FAST_FUNCTION(engine_display_clear_depth_buffer)(){
     if(depth_buffer != NULL) engine_draw_fill_color(UINT16_MAX, depth_buffer);
 }
@@ -149,11 +162,53 @@ bool ENGINE_FAST_FUNCTION(engine_display_store_check_depth_index)(uint16_t index
 
 
 bool ENGINE_FAST_FUNCTION(engine_display_store_check_depth)(uint8_t sx, uint8_t sy, uint16_t depth){
-    uint16_t index = sy * SCREEN_WIDTH + sx;
+    uint16_t index = sy * engine_display_target_width + sx;
     return engine_display_store_check_depth_index(index, depth);
 }
 
 
 uint16_t *engine_display_get_depth_buffer(){
     return depth_buffer;
+}
+
+
+void engine_display_get_target(engine_display_target_t *target){
+    target->buffer = active_screen_buffer;
+    target->depth = depth_buffer;
+    target->width = engine_display_target_width;
+    target->height = engine_display_target_height;
+}
+
+
+void engine_display_set_target(uint16_t *buffer, uint16_t *depth, uint16_t width, uint16_t height){
+    if(target_saved_screen_buffer == NULL){
+        target_saved_screen_buffer = active_screen_buffer;
+        target_saved_depth_buffer = depth_buffer;
+    }
+
+    active_screen_buffer = buffer;
+    depth_buffer = depth;
+    engine_display_target_width = width;
+    engine_display_target_height = height;
+
+    engine_draw_reset_clip_rects();
+    engine_draw_reset_scissor();
+}
+
+
+void engine_display_reset_target(){
+    if(target_saved_screen_buffer == NULL){
+        return;
+    }
+
+    active_screen_buffer = target_saved_screen_buffer;
+    depth_buffer = target_saved_depth_buffer;
+    target_saved_screen_buffer = NULL;
+    target_saved_depth_buffer = NULL;
+
+    engine_display_target_width = SCREEN_WIDTH;
+    engine_display_target_height = SCREEN_HEIGHT;
+
+    engine_draw_reset_clip_rects();
+    engine_draw_reset_scissor();
 }
\ No newline at end of file
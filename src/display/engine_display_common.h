@@ -28,6 +28,16 @@ MP_REGISTER_ROOT_POINTER(mp_obj_t front_fb);
 #define SCREEN_BUFFER_SIZE_BYTES SCREEN_BUFFER_SIZE_PIXELS*2 // Number of pixels times 2 (16-bit pixels) is the number of bytes in a screen buffer
 
 
+// Area of the screen in pixels. The top-left (`x0`, `y0`) is
+// inside the area while the bottom-right (`x1`, `y1`) is not
+typedef struct{
+    int16_t x0;
+    int16_t y0;
+    int16_t x1;
+    int16_t y1;
+}engine_display_rect_t;
+
+
 void engine_display_set_fill_color(uint16_t color);
 void engine_display_set_fill_background(uint16_t *data);
 void engine_display_reset_fills();
@@ -42,6 +52,9 @@ void engine_init_screen_buffers();
 // Switches active screen buffer
 void engine_switch_active_screen_buffer();
 
+// Index (0 or 1) of the screen buffer that is being drawn to
+uint8_t engine_display_get_active_screen_buffer_index();
+
 // Resets all elements to 0x0000
 void engine_display_clear_depth_buffer();
 
@@ -53,6 +66,33 @@ void engine_display_free_depth_buffer();
 
 uint16_t *engine_display_get_depth_buffer();
 
+// Size of the buffer that drawing goes to, the screen's size
+// unless a camera is rendering into a texture
+extern uint16_t engine_display_target_width;
+extern uint16_t engine_display_target_height;
+
+// What drawing currently goes to, see `engine_display_set_target`
+typedef struct{
+    uint16_t *buffer;
+    uint16_t *depth;
+    uint16_t width;
+    uint16_t height;
+}engine_display_target_t;
+
+// Fills in what is being drawn to so that it can be set back after
+// drawing into something else (targets can be set inside of each other)
+void engine_display_get_target(engine_display_target_t *target);
+
+// Draw into `buffer` (and depth test against `depth`, can be NULL if
+// nothing drawn uses depth) instead of the active screen buffer until
+// `engine_display_reset_target` is called. Both are `width` pixels per
+// row and `height` rows, no bigger than the screen. Clip areas and the
+// scissor are reset to cover the whole buffer
+void engine_display_set_target(uint16_t *buffer, uint16_t *depth, uint16_t width, uint16_t height);
+
+// Go back to drawing into the active screen buffer (from any depth)
+void engine_display_reset_target();
+
 // Returns true if the passed depth is lower/closer
 // than the depth stored there before, also stores it if true.
 // Returns false if did not store it because it was lower
@@ -0,0 +1,433 @@
+#include "engine_display_damage.h"
+#include "draw/engine_display_draw.h"
+#include "debug/debug_print.h"
+#include "py/runtime.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Defined in engine_display_common.c
+extern uint16_t *active_screen_buffer;
+
+
+// Something that was drawn during a recording pass
+typedef struct{
+    engine_display_rect_t rect;
+    uint32_t signature;
+}engine_display_damage_record_t;
+
+
+// Non-overlapping areas of the screen
+typedef struct{
+    engine_display_rect_t rects[ENGINE_DISPLAY_DAMAGE_MAX_RECTS];
+    uint8_t count;
+}engine_display_damage_rects_t;
+
+
+bool damage_enabled = false;
+bool damage_recording = false;
+
+// Set during a fingerprint pass, records are hashed into `damage_fingerprint`
+bool damage_fingerprinting = false;
+uint32_t damage_fingerprint = ENGINE_DISPLAY_DAMAGE_HASH_START;
+engine_display_rect_t damage_fingerprint_bounds;
+
+// What was drawn last frame and what is being drawn this frame,
+// these switch places after each recording pass. C heap, only grown
+engine_display_damage_record_t *damage_records[2] = {NULL, NULL};
+uint32_t damage_record_counts[2] = {0, 0};
+uint32_t damage_record_capacities[2] = {0, 0};
+uint8_t damage_current_records = 0;
+
+// Areas that changed since the last frame
+engine_display_damage_rects_t damage_frame;
+
+// Areas that were added by hand or by enabling damage tracking
+engine_display_damage_rects_t damage_pending;
+
+// Areas of each screen buffer that are out of date. Screen buffers are
+// switched every sent frame so each one needs the changes from two frames
+engine_display_damage_rects_t damage_stale[2];
+
+// Used to notice the background changing
+uint16_t damage_last_fill_color = 0;
+uint16_t *damage_last_fill_background = NULL;
+
+// Used to make signatures that never match for `engine_display_damage_record_always`
+uint32_t damage_always_counter = 0;
+
+uint32_t damage_sent_pixel_count = 0;
+
+
+static inline bool engine_display_damage_rects_overlap(engine_display_rect_t *a, engine_display_rect_t *b){
+    return a->x0 < b->x1 && b->x0 < a->x1 && a->y0 < b->y1 && b->y0 < a->y1;
+}
+
+
+static inline engine_display_rect_t engine_display_damage_rects_union(engine_display_rect_t *a, engine_display_rect_t *b){
+    engine_display_rect_t combined;
+    combined.x0 = MIN(a->x0, b->x0);
+    combined.y0 = MIN(a->y0, b->y0);
+    combined.x1 = MAX(a->x1, b->x1);
+    combined.y1 = MAX(a->y1, b->y1);
+    return combined;
+}
+
+
+static inline int32_t engine_display_damage_rect_area(engine_display_rect_t *rect){
+    return (rect->x1 - rect->x0) * (rect->y1 - rect->y0);
+}
+
+
+// Clips the area to the screen (or texture being drawn
+// into), returns false if nothing is left
+static bool engine_display_damage_make_rect(int32_t x0, int32_t y0, int32_t x1, int32_t y1, engine_display_rect_t *rect){
+    x0 = MAX(x0, 0);
+    y0 = MAX(y0, 0);
+    x1 = MIN(x1, engine_display_target_width);
+    y1 = MIN(y1, engine_display_target_height);
+
+    if(x0 >= x1 || y0 >= y1){
+        return false;
+    }
+
+    rect->x0 = x0;
+    rect->y0 = y0;
+    rect->x1 = x1;
+    rect->y1 = y1;
+    return true;
+}
+
+
+// Adds an area to the list while keeping the areas from overlapping,
+// overlapping areas are combined into their bounding box
+static void engine_display_damage_rects_add(engine_display_damage_rects_t *list, engine_display_rect_t rect){
+    uint8_t index = 0;
+
+    while(index < list->count){
+        if(engine_display_damage_rects_overlap(&list->rects[index], &rect)){
+            rect = engine_display_damage_rects_union(&list->rects[index], &rect);
+
+            // Remove the old area and start over since the
+            // bigger area may now overlap ones already checked
+            list->rects[index] = list->rects[list->count-1];
+            list->count--;
+            index = 0;
+        }else{
+            index++;
+        }
+    }
+
+    if(list->count < ENGINE_DISPLAY_DAMAGE_MAX_RECTS){
+        list->rects[list->count] = rect;
+        list->count++;
+        return;
+    }
+
+    // Out of room, combine with the area that grows the least
+    uint8_t best_index = 0;
+    int32_t best_growth = INT32_MAX;
+
+    for(index=0; index<list->count; index++){
+        engine_display_rect_t combined = engine_display_damage_rects_union(&list->rects[index], &rect);
+        int32_t growth = engine_display_damage_rect_area(&combined) - engine_display_damage_rect_area(&list->rects[index]);
+
+        if(growth < best_growth){
+            best_growth = growth;
+            best_index = index;
+        }
+    }
+
+    rect = engine_display_damage_rects_union(&list->rects[best_index], &rect);
+    list->rects[best_index] = list->rects[list->count-1];
+    list->count--;
+
+    engine_display_damage_rects_add(list, rect);
+}
+
+
+static void engine_display_damage_rects_add_list(engine_display_damage_rects_t *list, engine_display_damage_rects_t *from){
+    for(uint8_t index=0; index<from->count; index++){
+        engine_display_damage_rects_add(list, from->rects[index]);
+    }
+}
+
+
+static void engine_display_damage_rects_fill_screen(engine_display_damage_rects_t *list){
+    list->rects[0] = (engine_display_rect_t){0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
+    list->count = 1;
+}
+
+
+// Same as the full screen clear in `engine_display_send` but only in `rect`
+static void engine_display_damage_clear_rect(engine_display_rect_t *rect){
+    uint16_t *fill_background = engine_display_get_background();
+    uint16_t fill_color = engine_display_get_color();
+
+    int32_t width = rect->x1 - rect->x0;
+
+    for(int32_t y=rect->y0; y<rect->y1; y++){
+        uint32_t row_offset = y * SCREEN_WIDTH + rect->x0;
+
+        if(fill_background != NULL){
+            memcpy(active_screen_buffer + row_offset, fill_background + row_offset, width * sizeof(uint16_t));
+        }else{
+            uint16_t *pixel = active_screen_buffer + row_offset;
+            int32_t count = width;
+            while(count--) *pixel++ = fill_color;
+        }
+    }
+}
+
+
+static inline bool engine_display_damage_records_match(engine_display_damage_record_t *a, engine_display_damage_record_t *b){
+    return a->signature == b->signature &&
+           a->rect.x0 == b->rect.x0 && a->rect.y0 == b->rect.y0 &&
+           a->rect.x1 == b->rect.x1 && a->rect.y1 == b->rect.y1;
+}
+
+
+void engine_display_damage_set_enabled(bool enabled){
+    if(enabled == damage_enabled){
+        return;
+    }
+
+    damage_enabled = enabled;
+    damage_recording = false;
+
+    if(enabled){
+        // Nothing is known about what is in the screen
+        // buffers or on the display yet, redraw everything
+        damage_record_counts[0] = 0;
+        damage_record_counts[1] = 0;
+
+        engine_display_damage_rects_fill_screen(&damage_pending);
+        engine_display_damage_rects_fill_screen(&damage_stale[0]);
+        engine_display_damage_rects_fill_screen(&damage_stale[1]);
+
+        damage_last_fill_color = engine_display_get_color();
+        damage_last_fill_background = engine_display_get_background();
+    }else{
+        // Frames are normally drawn to a fully cleared screen buffer, the
+        // active one may still have an old frame in it so clear it now
+        engine_draw_reset_clip_rects();
+
+        if(active_screen_buffer != NULL){
+            uint16_t *fill_background = engine_display_get_background();
+
+            if(fill_background != NULL){
+                engine_draw_fill_buffer(fill_background, active_screen_buffer);
+            }else{
+                engine_draw_fill_color(engine_display_get_color(), active_screen_buffer);
+            }
+        }
+    }
+}
+
+
+bool engine_display_damage_is_enabled(){
+    return damage_enabled;
+}
+
+
+bool engine_display_damage_is_recording(){
+    return damage_recording;
+}
+
+
+uint32_t engine_display_damage_hash(uint32_t hash, const void *data, size_t length){
+    const uint8_t *bytes = data;
+
+    // http://www.isthe.com/chongo/tech/comp/fnv/index.html#FNV-1a
+    while(length--){
+        hash ^= *bytes++;
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+
+void engine_display_damage_record(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t signature){
+    engine_display_rect_t rect;
+
+    // Things that are entirely off screen can't change anything
+    if(engine_display_damage_make_rect(x0, y0, x1, y1, &rect) == false){
+        return;
+    }
+
+    if(damage_fingerprinting){
+        damage_fingerprint = engine_display_damage_hash(damage_fingerprint, &rect, sizeof(engine_display_rect_t));
+        damage_fingerprint = engine_display_damage_hash(damage_fingerprint, &signature, sizeof(uint32_t));
+        damage_fingerprint_bounds = engine_display_damage_rects_union(&damage_fingerprint_bounds, &rect);
+        return;
+    }
+
+    uint8_t current = damage_current_records;
+
+    if(damage_record_counts[current] >= damage_record_capacities[current]){
+        uint32_t new_capacity = (damage_record_capacities[current] == 0) ? 64 : damage_record_capacities[current] * 2;
+        engine_display_damage_record_t *grown = realloc(damage_records[current], new_capacity * sizeof(engine_display_damage_record_t));
+
+        if(grown == NULL){
+            mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("EngineDisplay: ERROR: Ran out of memory recording damaged areas"));
+        }
+
+        damage_records[current] = grown;
+        damage_record_capacities[current] = new_capacity;
+    }
+
+    engine_display_damage_record_t *record = &damage_records[current][damage_record_counts[current]];
+    record->rect = rect;
+    record->signature = signature;
+    damage_record_counts[current]++;
+}
+
+
+void engine_display_damage_record_always(int32_t x0, int32_t y0, int32_t x1, int32_t y1){
+    damage_always_counter++;
+    engine_display_damage_record(x0, y0, x1, y1, engine_display_damage_hash(ENGINE_DISPLAY_DAMAGE_HASH_START, &damage_always_counter, sizeof(damage_always_counter)));
+}
+
+
+void engine_display_damage_add(int32_t x0, int32_t y0, int32_t x1, int32_t y1){
+    engine_display_rect_t rect;
+
+    if(engine_display_damage_make_rect(x0, y0, x1, y1, &rect)){
+        engine_display_damage_rects_add(&damage_pending, rect);
+    }
+}
+
+
+void engine_display_damage_start_recording(){
+    damage_record_counts[damage_current_records] = 0;
+    damage_recording = true;
+}
+
+
+void engine_display_damage_start_fingerprint(){
+    damage_fingerprint = ENGINE_DISPLAY_DAMAGE_HASH_START;
+    damage_fingerprint_bounds = (engine_display_rect_t){INT16_MAX, INT16_MAX, INT16_MIN, INT16_MIN};
+    damage_fingerprinting = true;
+    damage_recording = true;
+}
+
+
+uint32_t engine_display_damage_stop_fingerprint(engine_display_rect_t *bounds){
+    damage_fingerprinting = false;
+    damage_recording = false;
+
+    if(bounds != NULL){
+        *bounds = damage_fingerprint_bounds;
+    }
+
+    return damage_fingerprint;
+}
+
+
+bool engine_display_damage_stop_recording(){
+    damage_recording = false;
+
+    uint8_t current = damage_current_records;
+    uint8_t previous = 1 - current;
+
+    engine_display_damage_record_t *current_records = damage_records[current];
+    engine_display_damage_record_t *previous_records = damage_records[previous];
+    uint32_t current_count = damage_record_counts[current];
+    uint32_t previous_count = damage_record_counts[previous];
+
+    damage_frame.count = 0;
+    engine_display_damage_rects_add_list(&damage_frame, &damage_pending);
+    damage_pending.count = 0;
+
+    // Changing the background changes everything
+    if(damage_last_fill_color != engine_display_get_color() || damage_last_fill_background != engine_display_get_background()){
+        damage_last_fill_color = engine_display_get_color();
+        damage_last_fill_background = engine_display_get_background();
+        engine_display_damage_rects_fill_screen(&damage_frame);
+    }
+
+    // Everything is drawn in the same order every frame. Skip what
+    // matches at the start and end of both frames, whatever is left in
+    // between was added, removed, or changed and damages where it was
+    // drawn in both frames
+    uint32_t common_count = MIN(current_count, previous_count);
+
+    uint32_t prefix_count = 0;
+    while(prefix_count < common_count && engine_display_damage_records_match(&previous_records[prefix_count], &current_records[prefix_count])){
+        prefix_count++;
+    }
+
+    uint32_t suffix_count = 0;
+    while(suffix_count < common_count - prefix_count && engine_display_damage_records_match(&previous_records[previous_count-1-suffix_count], &current_records[current_count-1-suffix_count])){
+        suffix_count++;
+    }
+
+    for(uint32_t index=prefix_count; index<previous_count-suffix_count; index++){
+        engine_display_damage_rects_add(&damage_frame, previous_records[index].rect);
+    }
+
+    for(uint32_t index=prefix_count; index<current_count-suffix_count; index++){
+        engine_display_damage_rects_add(&damage_frame, current_records[index].rect);
+    }
+
+    // Next frame is recorded over what was last frame
+    damage_current_records = previous;
+
+    // Both screen buffers end up needing these changes
+    engine_display_damage_rects_add_list(&damage_stale[0], &damage_frame);
+    engine_display_damage_rects_add_list(&damage_stale[1], &damage_frame);
+
+    engine_display_damage_rects_t *stale = &damage_stale[engine_display_get_active_screen_buffer_index()];
+
+    if(stale->count == 0){
+        return false;
+    }
+
+    for(uint8_t index=0; index<stale->count; index++){
+        engine_display_damage_clear_rect(&stale->rects[index]);
+    }
+
+    engine_draw_set_clip_rects(stale->rects, stale->count);
+    stale->count = 0;
+
+    return true;
+}
+
+
+void engine_display_damage_finish_drawing(){
+    engine_draw_reset_clip_rects();
+}
+
+
+uint8_t engine_display_damage_get_send_rects(engine_display_rect_t **rects){
+    damage_sent_pixel_count = 0;
+
+    for(uint8_t index=0; index<damage_frame.count; index++){
+        damage_sent_pixel_count += engine_display_damage_rect_area(&damage_frame.rects[index]);
+    }
+
+    *rects = damage_frame.rects;
+    return damage_frame.count;
+}
+
+
+uint32_t engine_display_damage_get_sent_pixel_count(){
+    return damage_sent_pixel_count;
+}
+
+
+void engine_display_damage_reset(){
+    engine_display_damage_set_enabled(false);
+    damage_fingerprinting = false;
+
+    for(uint8_t index=0; index<2; index++){
+        free(damage_records[index]);
+        damage_records[index] = NULL;
+        damage_record_counts[index] = 0;
+        damage_record_capacities[index] = 0;
+    }
+
+    damage_frame.count = 0;
+    damage_pending.count = 0;
+    damage_sent_pixel_count = 0;
+}
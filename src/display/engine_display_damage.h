@@ -0,0 +1,79 @@
+#ifndef ENGINE_DISPLAY_DAMAGE_H
+#define ENGINE_DISPLAY_DAMAGE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "display/engine_display_common.h"
+
+// Damage tracking (opt-in): each frame the node draw callbacks are first
+// run in a recording pass where the drawing primitives only report the
+// screen area they would cover plus a signature of everything that
+// affects their pixels. Comparing that against the last frame gives the
+// areas of the screen that changed. Only those areas are then cleared,
+// redrawn (drawing is clipped to them) and sent to the display
+
+// Most damaged areas tracked at once, when there are more
+// the closest areas get merged together into one
+#define ENGINE_DISPLAY_DAMAGE_MAX_RECTS 8
+
+// Starting value for `engine_display_damage_hash`
+#define ENGINE_DISPLAY_DAMAGE_HASH_START 2166136261u
+
+
+void engine_display_damage_set_enabled(bool enabled);
+bool engine_display_damage_is_enabled();
+
+// True while the draw callbacks are being run to find what
+// changed. Drawing primitives should record and not draw
+bool engine_display_damage_is_recording();
+
+// Mixes `length` bytes at `data` into `hash` (FNV-1a)
+uint32_t engine_display_damage_hash(uint32_t hash, const void *data, size_t length);
+
+// Called by the drawing primitives while recording. The area goes from
+// `x0`/`y0` up to but not including `x1`/`y1` and `signature` should
+// change whenever the pixels drawn in that area would
+void engine_display_damage_record(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t signature);
+
+// Same as `engine_display_damage_record` but for things whose pixels
+// can't be summed up by a signature, the area is redrawn every frame
+void engine_display_damage_record_always(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+
+// Marks an area of the screen as needing to be redrawn
+// and sent next frame no matter what was drawn there
+void engine_display_damage_add(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+
+// Starts the recording pass
+void engine_display_damage_start_recording();
+
+// Ends the recording pass and works out what changed. Returns true
+// if the active screen buffer needs any areas redrawn, in which case
+// those areas were cleared and drawing was clipped to them
+bool engine_display_damage_stop_recording();
+
+// Call after the drawing pass to remove the clipping
+void engine_display_damage_finish_drawing();
+
+// Gets the areas that changed since the last frame that was sent
+uint8_t engine_display_damage_get_send_rects(engine_display_rect_t **rects);
+
+// Number of pixels covered by the areas that were sent last frame
+uint32_t engine_display_damage_get_sent_pixel_count();
+
+// Runs like a recording pass except that what is recorded is summed
+// up into one hash instead of being compared against the last frame.
+// Used by cameras that render into textures to skip re-rendering when
+// nothing they would draw changed. Areas are clipped to the draw target
+void engine_display_damage_start_fingerprint();
+
+// Ends the pass and returns the hash, it changes whenever the pixels
+// drawn would (always for things recorded with `_record_always`). If
+// `bounds` isn't NULL it is set to the area covering everything that
+// was recorded (empty, `x0` >= `x1`, if nothing was)
+uint32_t engine_display_damage_stop_fingerprint(engine_display_rect_t *bounds);
+
+// Disables damage tracking and frees the recording arrays
+void engine_display_damage_reset();
+
+#endif  // ENGINE_DISPLAY_DAMAGE_H
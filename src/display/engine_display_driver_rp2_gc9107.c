@@ -79,14 +79,34 @@ static void gc9107_write_cmd(uint8_t cmd, const uint8_t* data, size_t length){
 }
 
 
-void gc9107_reset_window(){
+// Sets the area of the display (inclusive) that the pixels sent next fill in row by row
+void gc9107_set_window(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2){
     gc9107_write_cmd(0x36, (uint8_t[]){ 0x00 }, 1);
-    gc9107_write_cmd(0x2a, (uint8_t[]){ WINDOW_ADDR_X1>>8, WINDOW_ADDR_X1, WINDOW_ADDR_X2>>8, WINDOW_ADDR_X2 }, 4);
-    gc9107_write_cmd(0x2b, (uint8_t[]){ WINDOW_ADDR_Y1>>8, WINDOW_ADDR_Y1, WINDOW_ADDR_Y2>>8, WINDOW_ADDR_Y2 }, 4);
+    gc9107_write_cmd(0x2a, (uint8_t[]){ x1>>8, x1, x2>>8, x2 }, 4);
+    gc9107_write_cmd(0x2b, (uint8_t[]){ y1>>8, y1, y2>>8, y2 }, 4);
     gc9107_write_cmd(0x2c, NULL, 0);
 }
 
 
+void gc9107_reset_window(){
+    gc9107_set_window(WINDOW_ADDR_X1, WINDOW_ADDR_Y1, WINDOW_ADDR_X2, WINDOW_ADDR_Y2);
+}
+
+
+// Waits for the last DMA transfer and SPI to finish
+static void gc9107_wait_for_transfer(){
+    if(dma_channel_is_busy(dma_tx)){
+        ENGINE_WARNING_PRINTF("Waiting on previous DMA transfer to complete. Could have done more last frame!");
+        dma_channel_wait_for_finish_blocking(dma_tx);
+    }
+
+    // For SPI must also wait for FIFO to flush and reset format
+    // https://github.com/Bodmer/TFT_eSPI/blob/5162af0a0e13e0d4bc0e4c792ed28d38599a1f23/Processors/TFT_eSPI_RP2040.c#L600-L602
+    while (spi_get_hw(spi0)->sr & SPI_SSPSR_BSY_BITS) {};
+    hw_write_masked(&spi_get_hw(spi0)->cr0, (16 - 1) << SPI_SSPCR0_DSS_LSB, SPI_SSPCR0_DSS_BITS);
+}
+
+
 void engine_display_gc9107_init(){
     ENGINE_INFO_PRINTF("Setting up GC9107 screen");
 
@@ -224,15 +244,7 @@ void engine_display_gc9107_init(){
 
 
 void engine_display_gc9107_update(uint16_t *screen_buffer_to_render){
-    if(dma_channel_is_busy(dma_tx)){
-        ENGINE_WARNING_PRINTF("Waiting on previous DMA transfer to complete. Could have done more last frame!");
-        dma_channel_wait_for_finish_blocking(dma_tx);
-    }
-
-    // For SPI must also wait for FIFO to flush and reset format
-    // https://github.com/Bodmer/TFT_eSPI/blob/5162af0a0e13e0d4bc0e4c792ed28d38599a1f23/Processors/TFT_eSPI_RP2040.c#L600-L602
-    while (spi_get_hw(spi0)->sr & SPI_SSPSR_BSY_BITS) {};
-    hw_write_masked(&spi_get_hw(spi0)->cr0, (16 - 1) << SPI_SSPCR0_DSS_LSB, SPI_SSPCR0_DSS_BITS);
+    gc9107_wait_for_transfer();
 
     // Point DMA to active screen buffer that should be
     // sent now that the last frame is finished sending
@@ -250,3 +262,42 @@ void engine_display_gc9107_update(uint16_t *screen_buffer_to_render){
                           SCREEN_BUFFER_SIZE_PIXELS,    // element count (each element is of size DMA_SIZE_16)
                           true);                        // don't start yet, need to set active frame buffer later
 }
+
+
+void engine_display_gc9107_update_region(uint16_t *screen_buffer_to_render, uint8_t x, uint8_t y, uint8_t width, uint8_t height){
+    gc9107_wait_for_transfer();
+
+    txbuf = screen_buffer_to_render;
+
+    // Only the pixels inside this window get written to
+    gc9107_set_window(x, y, x+width-1, y+height-1);
+
+    gpio_put(PIN_GP17_SPI0_CSn__TO__CS, 0);
+    gpio_put(PIN_GP16__TO__DC,          1);
+
+    // Rows that cover the whole width of the screen are
+    // next to each other in the buffer, send them all at once
+    if(width == SCREEN_WIDTH){
+        dma_channel_configure(dma_tx, &dma_config,
+                              &spi_get_hw(spi0)->dr,
+                              &txbuf[y * SCREEN_WIDTH],
+                              width * height,
+                              true);
+        return;
+    }
+
+    // Otherwise send row by row, the display keeps filling
+    // the window as long as the chip stays selected. The
+    // last row is left sending while the next frame is drawn
+    for(uint8_t row=y; row<y+height; row++){
+        if(row != y){
+            dma_channel_wait_for_finish_blocking(dma_tx);
+        }
+
+        dma_channel_configure(dma_tx, &dma_config,
+                              &spi_get_hw(spi0)->dr,
+                              &txbuf[row * SCREEN_WIDTH + x],
+                              width,
+                              true);
+    }
+}
@@ -8,4 +8,7 @@
 void engine_display_gc9107_init();
 void engine_display_gc9107_update(uint16_t *screen_buffer_to_render);
 
+// Sends only the area of the screen buffer starting at `x`/`y` (in pixels)
+void engine_display_gc9107_update_region(uint16_t *screen_buffer_to_render, uint8_t x, uint8_t y, uint8_t width, uint8_t height);
+
 #endif  // ENGINE_DISPLAY_DRIVER_RP2_GC9107_H
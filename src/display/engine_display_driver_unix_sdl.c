@@ -23,6 +23,20 @@
     }
 
 
+    void engine_display_sdl_update_screen_regions(uint16_t *screen_buffer_to_render, engine_display_rect_t *rects, uint8_t rect_count){
+        for(uint8_t index=0; index<rect_count; index++){
+            engine_display_rect_t *rect = &rects[index];
+            SDL_Rect area = {rect->x0, rect->y0, rect->x1 - rect->x0, rect->y1 - rect->y0};
+
+            SDL_UpdateTexture(window_frame_buffer, &area, screen_buffer_to_render + rect->y0 * SCREEN_WIDTH + rect->x0, SCREEN_WIDTH*sizeof(uint16_t));
+        }
+
+        SDL_RenderClear(window_renderer);
+        SDL_RenderCopy(window_renderer, window_frame_buffer, NULL, NULL);
+        SDL_RenderPresent(window_renderer);
+    }
+
+
     void engine_display_sdl_init(){
         // https://dev.to/noah11012/using-sdl2-opening-a-window-79c
         if(SDL_Init(SDL_INIT_VIDEO) < 0){
@@ -2,9 +2,13 @@
 #define ENGINE_DISPLAY_DRIVER_UNIX_SDL_H
 
 #include <stdint.h>
+#include "display/engine_display_common.h"
 
 void engine_display_sdl_init();
 void engine_display_sdl_update_screen(uint16_t *screen_buffer_to_render);
 
+// Only copies the areas of the screen buffer in `rects` to the window
+void engine_display_sdl_update_screen_regions(uint16_t *screen_buffer_to_render, engine_display_rect_t *rects, uint8_t rect_count);
+
 
 #endif  // ENGINE_DISPLAY_DRIVER_UNIX_SDL_H
\ No newline at end of file
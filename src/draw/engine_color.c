@@ -31,8 +31,53 @@ static inline void engine_color_split_u16(uint16_t color, uint16_t *r, uint16_t
     *b = (color >>  0) & bitmask_5_bit;
 }
 
-// https://stackoverflow.com/a/29321264
+// Rounded square roots of every squared 6-bit channel value (and
+// everything between), filled the first time a blend needs it
+#define ENGINE_COLOR_SQRT_TABLE_SIZE (63*63 + 1)
+static uint8_t engine_color_sqrt_table[ENGINE_COLOR_SQRT_TABLE_SIZE];
+static bool engine_color_sqrt_table_filled = false;
+
+
+static void engine_color_fill_sqrt_table(){
+    for(uint32_t index=0; index<ENGINE_COLOR_SQRT_TABLE_SIZE; index++){
+        engine_color_sqrt_table[index] = round_float(sqrtf(index));
+    }
+
+    engine_color_sqrt_table_filled = true;
+}
+
+
+static inline uint32_t engine_color_blend_channel(uint32_t from, uint32_t to, uint32_t amount){
+    uint32_t squared = ((1 << ENGINE_COLOR_BLEND_SHIFT) - amount) * from * from + amount * to * to;
+    return engine_color_sqrt_table[(squared + (1 << (ENGINE_COLOR_BLEND_SHIFT - 1))) >> ENGINE_COLOR_BLEND_SHIFT];
+}
+
+
+uint16_t ENGINE_FAST_FUNCTION(engine_color_blend_12bit)(uint16_t from, uint16_t to, uint32_t amount){
+    if(engine_color_sqrt_table_filled == false){
+        engine_color_fill_sqrt_table();
+    }
+
+    uint32_t out_r = engine_color_blend_channel((from >> 11) & bitmask_5_bit, (to >> 11) & bitmask_5_bit, amount);
+    uint32_t out_g = engine_color_blend_channel((from >>  5) & bitmask_6_bit, (to >>  5) & bitmask_6_bit, amount);
+    uint32_t out_b = engine_color_blend_channel((from >>  0) & bitmask_5_bit, (to >>  0) & bitmask_5_bit, amount);
+
+    return (out_r << 11) | (out_g << 5) | (out_b << 0);
+}
+
+
 uint16_t ENGINE_FAST_FUNCTION(engine_color_blend)(uint16_t from, uint16_t to, float amount){
+    return engine_color_blend_12bit(from, to, engine_color_amount_to_12bit(amount));
+}
+
+
+uint16_t ENGINE_FAST_FUNCTION(engine_color_alpha_blend)(uint16_t background, uint16_t foreground, float alpha){
+    return engine_color_alpha_blend_5bit(background, foreground, engine_color_alpha_to_5bit(alpha));
+}
+
+
+// https://stackoverflow.com/a/29321264
+uint16_t engine_color_blend_float(uint16_t from, uint16_t to, float amount){
     uint16_t from_r, from_g, from_b;
     engine_color_split_u16(from, &from_r, &from_g, &from_b);
     uint16_t to_r, to_g, to_b;
@@ -47,7 +92,7 @@ uint16_t ENGINE_FAST_FUNCTION(engine_color_blend)(uint16_t from, uint16_t to, fl
 
 
 // https://stackoverflow.com/a/19060243
-uint16_t ENGINE_FAST_FUNCTION(engine_color_alpha_blend)(uint16_t background, uint16_t foreground, float alpha){
+uint16_t engine_color_alpha_blend_float(uint16_t background, uint16_t foreground, float alpha){
     uint16_t bg_r, bg_g, bg_b;
     engine_color_split_u16(background, &bg_r, &bg_g, &bg_b);
     uint16_t fg_r, fg_g, fg_b;
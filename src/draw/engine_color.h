@@ -41,7 +41,52 @@ mp_obj_t engine_color_wrap_opt(mp_obj_t color_or_none);
 
 mp_obj_t color_class_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args);
 
+// Green moved up to the top half of a 32-bit word with gaps between
+// the channels (-----GGGGGG-----RRRRR------BBBBB) so that all three can
+// be blended with one multiply without running into each other
+#define ENGINE_COLOR_SPREAD_MASK 0x07E0F81F
+
+// Half of a step of 5-bit alpha in each channel of a spread color
+#define ENGINE_COLOR_SPREAD_ROUND 0x02008010
+
+// Fractional bits of the amount used by `engine_color_blend_12bit`
+#define ENGINE_COLOR_BLEND_SHIFT 12
+
+static inline uint32_t engine_color_spread(uint16_t color){
+    return (color | ((uint32_t)color << 16)) & ENGINE_COLOR_SPREAD_MASK;
+}
+
+// Alpha as 0 ~ 32 for `engine_color_alpha_blend_5bit`
+static inline uint32_t engine_color_alpha_to_5bit(float alpha){
+    if(alpha >= 1.0f) return 32;
+    if(!(alpha > 0.0f)) return 0;
+    return (uint32_t)(alpha * 32.0f + 0.5f);
+}
+
+// Same as `engine_color_alpha_blend` but with `alpha` as 0 ~ 32, rounds
+// each channel to nearest
+static inline uint16_t engine_color_alpha_blend_5bit(uint16_t background, uint16_t foreground, uint32_t alpha){
+    uint32_t bg = engine_color_spread(background);
+    uint32_t blended = ((((engine_color_spread(foreground) - bg) * alpha + ENGINE_COLOR_SPREAD_ROUND) >> 5) + bg) & ENGINE_COLOR_SPREAD_MASK;
+    return (uint16_t)(blended | (blended >> 16));
+}
+
+// Amount as 0 ~ 4096 for `engine_color_blend_12bit`
+static inline uint32_t engine_color_amount_to_12bit(float amount){
+    if(amount >= 1.0f) return 1 << ENGINE_COLOR_BLEND_SHIFT;
+    if(!(amount > 0.0f)) return 0;
+    return (uint32_t)(amount * (1 << ENGINE_COLOR_BLEND_SHIFT) + 0.5f);
+}
+
+// Gamma correct (interpolates squared channels) blend from `from` to
+// `to`. Integer math with the square roots looked up in a table
+uint16_t ENGINE_FAST_FUNCTION(engine_color_blend_12bit)(uint16_t from, uint16_t to, uint32_t amount);
+
 uint16_t ENGINE_FAST_FUNCTION(engine_color_blend)(uint16_t from, uint16_t to, float amount);
 uint16_t ENGINE_FAST_FUNCTION(engine_color_alpha_blend)(uint16_t background, uint16_t foreground, float alpha);
 
+// Float versions of the above that the integer ones are checked against
+uint16_t engine_color_blend_float(uint16_t from, uint16_t to, float amount);
+uint16_t engine_color_alpha_blend_float(uint16_t background, uint16_t foreground, float alpha);
+
 #endif  /// ENGINE_COLOR_H
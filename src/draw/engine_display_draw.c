@@ -1,5 +1,6 @@
 #include "draw/engine_display_draw.h"
 #include "display/engine_display_common.h"
+#include "display/engine_display_damage.h"
 #include "debug/debug_print.h"
 #include <string.h>
 #include <stdlib.h>
@@ -14,10 +15,153 @@
 
 #include "py/objstr.h"
 #include "py/objtype.h"
+#include "py/objarray.h"
 
 // Defined in engine_display_common.c
 extern uint16_t *active_screen_buffer;
 
+// Areas of the screen that drawing is limited to, the clip
+// areas that were set cut down to the scissor area
+engine_display_rect_t engine_draw_clip_rects[ENGINE_DRAW_MAX_CLIP_RECTS] = {{0, 0, SCREEN_WIDTH, SCREEN_HEIGHT}};
+uint8_t engine_draw_clip_rect_count = 1;
+
+// Smallest area containing all of `engine_draw_clip_rects`
+engine_display_rect_t engine_draw_clip_bounds = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
+
+// Clip areas as set by `engine_draw_set_clip_rects` and the scissor area
+static engine_display_rect_t engine_draw_set_rects[ENGINE_DRAW_MAX_CLIP_RECTS] = {{0, 0, SCREEN_WIDTH, SCREEN_HEIGHT}};
+static uint8_t engine_draw_set_rect_count = 1;
+static engine_display_rect_t engine_draw_scissor = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
+
+
+// Cut the set clip areas down to the scissor area, areas
+// left empty are dropped so that primitives never see them
+static void engine_draw_update_clip_rects(){
+    engine_draw_clip_rect_count = 0;
+    engine_draw_clip_bounds = (engine_display_rect_t){SCREEN_WIDTH, SCREEN_HEIGHT, 0, 0};
+
+    for(uint8_t index=0; index<engine_draw_set_rect_count; index++){
+        engine_display_rect_t *set = &engine_draw_set_rects[index];
+
+        engine_display_rect_t clip = {
+            MAX(set->x0, engine_draw_scissor.x0),
+            MAX(set->y0, engine_draw_scissor.y0),
+            MIN(set->x1, engine_draw_scissor.x1),
+            MIN(set->y1, engine_draw_scissor.y1)
+        };
+
+        if(clip.x0 >= clip.x1 || clip.y0 >= clip.y1){
+            continue;
+        }
+
+        engine_draw_clip_rects[engine_draw_clip_rect_count++] = clip;
+
+        engine_draw_clip_bounds.x0 = MIN(engine_draw_clip_bounds.x0, clip.x0);
+        engine_draw_clip_bounds.y0 = MIN(engine_draw_clip_bounds.y0, clip.y0);
+        engine_draw_clip_bounds.x1 = MAX(engine_draw_clip_bounds.x1, clip.x1);
+        engine_draw_clip_bounds.y1 = MAX(engine_draw_clip_bounds.y1, clip.y1);
+    }
+}
+
+
+void engine_draw_set_clip_rects(const engine_display_rect_t *rects, uint8_t count){
+    count = MIN(count, ENGINE_DRAW_MAX_CLIP_RECTS);
+    memcpy(engine_draw_set_rects, rects, count * sizeof(engine_display_rect_t));
+    engine_draw_set_rect_count = count;
+    engine_draw_update_clip_rects();
+}
+
+
+void engine_draw_reset_clip_rects(){
+    engine_draw_set_rects[0] = (engine_display_rect_t){0, 0, engine_display_target_width, engine_display_target_height};
+    engine_draw_set_rect_count = 1;
+    engine_draw_update_clip_rects();
+}
+
+
+void engine_draw_set_scissor(int16_t x0, int16_t y0, int16_t x1, int16_t y1){
+    engine_draw_scissor = (engine_display_rect_t){x0, y0, x1, y1};
+    engine_draw_update_clip_rects();
+}
+
+
+void engine_draw_reset_scissor(){
+    engine_draw_scissor = (engine_display_rect_t){0, 0, engine_display_target_width, engine_display_target_height};
+    engine_draw_update_clip_rects();
+}
+
+
+void engine_draw_save_clip(engine_draw_clip_state_t *state){
+    memcpy(state->rects, engine_draw_set_rects, engine_draw_set_rect_count * sizeof(engine_display_rect_t));
+    state->count = engine_draw_set_rect_count;
+    state->scissor = engine_draw_scissor;
+}
+
+
+void engine_draw_restore_clip(const engine_draw_clip_state_t *state){
+    memcpy(engine_draw_set_rects, state->rects, state->count * sizeof(engine_display_rect_t));
+    engine_draw_set_rect_count = state->count;
+    engine_draw_scissor = state->scissor;
+    engine_draw_update_clip_rects();
+}
+
+
+bool engine_draw_clip_overlaps(int32_t x0, int32_t y0, int32_t x1, int32_t y1){
+    // Cheap check against all of the areas at once first
+    if(x1 <= engine_draw_clip_bounds.x0 || x0 >= engine_draw_clip_bounds.x1 ||
+       y1 <= engine_draw_clip_bounds.y0 || y0 >= engine_draw_clip_bounds.y1){
+        return false;
+    }
+
+    for(uint8_t index=0; index<engine_draw_clip_rect_count; index++){
+        engine_display_rect_t *clip = &engine_draw_clip_rects[index];
+
+        if(x0 < clip->x1 && x1 > clip->x0 && y0 < clip->y1 && y1 > clip->y0){
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+static inline bool engine_draw_clip_contains(int32_t x, int32_t y){
+    for(uint8_t index=0; index<engine_draw_clip_rect_count; index++){
+        engine_display_rect_t *clip = &engine_draw_clip_rects[index];
+
+        if(x >= clip->x0 && x < clip->x1 && y >= clip->y0 && y < clip->y1){
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+// Signature of the shader and `args` (everything else that decides what
+// a primitive draws) for damage tracking. The first arg should be
+// different for each kind of primitive
+static uint32_t engine_draw_damage_signature(const float *args, uint8_t arg_count, engine_shader_t *shader){
+    uint32_t hash = ENGINE_DISPLAY_DAMAGE_HASH_START;
+    hash = engine_display_damage_hash(hash, args, arg_count * sizeof(float));
+    hash = engine_display_damage_hash(hash, &shader, sizeof(engine_shader_t*));
+    hash = engine_display_damage_hash(hash, shader->program, shader->program_len);
+    return hash;
+}
+
+
+// Used as the first arg of `engine_draw_damage_signature`
+enum engine_draw_damage_kinds{
+    DAMAGE_KIND_PIXEL,
+    DAMAGE_KIND_LINE,
+    DAMAGE_KIND_BLIT,
+    DAMAGE_KIND_RECT,
+    DAMAGE_KIND_OUTLINE_CIRCLE,
+    DAMAGE_KIND_FILLED_CIRCLE,
+    DAMAGE_KIND_TRIANGLE,
+    DAMAGE_KIND_TILE
+};
+
 void ENGINE_FAST_FUNCTION(engine_draw_fill_color)(uint16_t color, uint16_t *screen_buffer){
     uint16_t *buf = screen_buffer;
     uint16_t count = SCREEN_BUFFER_SIZE_PIXELS;
@@ -36,9 +180,41 @@ void ENGINE_FAST_FUNCTION(engine_draw_fill_buffer)(uint16_t* src_buffer, uint16_
 }
 
 
+void engine_draw_copy_keyed(const uint16_t *pixels, int32_t x, int32_t y, int32_t width, int32_t height, uint16_t key_color){
+    for(uint8_t index=0; index<engine_draw_clip_rect_count; index++){
+        engine_display_rect_t *clip = &engine_draw_clip_rects[index];
+
+        int32_t x0 = MAX(x, clip->x0);
+        int32_t y0 = MAX(y, clip->y0);
+        int32_t x1 = MIN(x + width, clip->x1);
+        int32_t y1 = MIN(y + height, clip->y1);
+
+        for(int32_t row=y0; row<y1; row++){
+            const uint16_t *src = pixels + (row - y) * width + (x0 - x);
+            uint16_t *dest = active_screen_buffer + row * engine_display_target_width + x0;
+
+            for(int32_t column=x0; column<x1; column++){
+                if(*src != key_color){
+                    *dest = *src;
+                }
+
+                src++;
+                dest++;
+            }
+        }
+    }
+}
+
+
 void ENGINE_FAST_FUNCTION(engine_draw_pixel)(uint16_t color, int32_t x, int32_t y, float alpha, engine_shader_t *shader){
-    if((x >= 0 && x < SCREEN_WIDTH) && (y >= 0 && y < SCREEN_HEIGHT)){
-        uint16_t index = y * SCREEN_WIDTH + x;
+    if(engine_display_damage_is_recording()){
+        float args[] = {DAMAGE_KIND_PIXEL, color, x, y, alpha};
+        engine_display_damage_record(x, y, x+1, y+1, engine_draw_damage_signature(args, 5, shader));
+        return;
+    }
+
+    if(engine_draw_clip_contains(x, y)){
+        uint16_t index = y * engine_display_target_width + x;
 
         active_screen_buffer[index] = shader->execute(active_screen_buffer[index], color, alpha, shader);
     }
@@ -46,194 +222,695 @@ void ENGINE_FAST_FUNCTION(engine_draw_pixel)(uint16_t color, int32_t x, int32_t
 
 
 void ENGINE_FAST_FUNCTION(engine_draw_pixel_no_check)(uint16_t color, int32_t x, int32_t y, float alpha, engine_shader_t *shader){
-    uint16_t index = y * SCREEN_WIDTH + x;
+    uint16_t index = y * engine_display_target_width + x;
     active_screen_buffer[index] = shader->execute(active_screen_buffer[index], color, alpha, shader);
 }
 
 
-// https://en.wikipedia.org/wiki/Digital_differential_analyzer_(graphics_algorithm)
-void engine_draw_line(uint16_t color, float x_start, float y_start, float x_end, float y_end, mp_obj_t camera_node_base_in, float alpha, engine_shader_t *shader){
-    // Distance difference between endpoints
-    float dx = x_end - x_start;
-    float dy = y_end - y_start;
-
-    // See which axis requires most steps to draw complete line, store it
-    float step_count = 0.0f;
-    if(abs((int)dx) >= abs((int)dy)){
-        step_count = abs((int)dx);
-    }else{
-        step_count = abs((int)dy);
+// Integer rasterization used by the primitives below. Pixels are
+// written straight to the screen buffer, with the clip areas applied
+// per span or per primitive instead of through `engine_draw_pixel`
+
+// Endpoints further off the screen than this are clipped in floats
+// first so that the integer line stepping can't overflow
+#define ENGINE_DRAW_LINE_MAX_COORD 8192.0f
+
+
+// Shades one pixel that is already known to be inside the clip areas
+static inline void engine_draw_plot_no_check(uint16_t color, int32_t x, int32_t y, float alpha, engine_shader_t *shader){
+    uint32_t index = y * engine_display_target_width + x;
+    active_screen_buffer[index] = shader->execute(active_screen_buffer[index], color, alpha, shader);
+}
+
+
+static inline void engine_draw_plot(uint16_t color, int32_t x, int32_t y, float alpha, engine_shader_t *shader){
+    if(engine_draw_clip_contains(x, y)){
+        engine_draw_plot_no_check(color, x, y, alpha, shader);
     }
+}
 
-    // Calculate how much to increment each axis each step
-    float slope_x = dx / step_count;
-    float slope_y = dy / step_count;
 
-    float line_x = x_start;
-    float line_y = y_start;
+// Draws the pixels from `x0` up to (not including) `x1` in row `y`. The
+// span is cut to each clip area and written as a run, copied for the
+// empty shader and blended in integers for the opacity shader
+static void engine_draw_span(uint16_t color, int32_t x0, int32_t x1, int32_t y, float alpha, engine_shader_t *shader){
+    for(uint8_t index=0; index<engine_draw_clip_rect_count; index++){
+        engine_display_rect_t *clip = &engine_draw_clip_rects[index];
 
-    // Draw the line
-    for(uint32_t step=0; step<step_count; step++){
-        line_x = line_x + slope_x;
-        line_y = line_y + slope_y;
+        if(y < clip->y0 || y >= clip->y1){
+            continue;
+        }
+
+        int32_t start = MAX(x0, clip->x0);
+        int32_t end = MIN(x1, clip->x1);
+
+        if(start >= end){
+            continue;
+        }
+
+        uint16_t *pixel = active_screen_buffer + y * engine_display_target_width + start;
+        uint16_t *pixel_end = pixel + (end - start);
 
-        engine_draw_pixel(color, (int32_t)line_x, (int32_t)line_y, alpha, shader);
+        if(shader == engine_get_builtin_shader(EMPTY_SHADER)){
+            while(pixel < pixel_end){
+                *pixel++ = color;
+            }
+        }else if(shader == engine_get_builtin_shader(OPACITY_SHADER)){
+            uint32_t alpha_5bit = engine_color_alpha_to_5bit(alpha);
+
+            while(pixel < pixel_end){
+                *pixel = engine_color_alpha_blend_5bit(*pixel, color, alpha_5bit);
+                pixel++;
+            }
+        }else{
+            while(pixel < pixel_end){
+                *pixel = shader->execute(*pixel, color, alpha, shader);
+                pixel++;
+            }
+        }
     }
 }
 
 
+// First step `k` of a Bresenham line where the minor axis has moved at
+// least `moved` pixels. The minor axis moves `floor((2*k*minor + major)
+// / (2*major))` pixels by step `k` (`major` and `minor` are the lengths)
+static inline int32_t engine_draw_line_first_step(int32_t moved, int32_t major, int32_t minor){
+    if(moved <= 0){
+        return 0;
+    }
 
+    if(minor == 0){
+        return INT32_MAX;
+    }
 
-void engine_draw_blit(texture_resource_class_obj_t *texture, uint32_t offset, float center_x, float center_y, int32_t window_width, int32_t window_height, uint32_t pixels_stride, float x_scale, float y_scale, float rotation_radians, uint16_t transparent_color, float alpha, engine_shader_t *shader){
-    /*  https://cohost.org/tomforsyth/post/891823-rotation-with-three#:~:text=But%20the%20TL%3BDR%20is%20you%20do%20three%20shears%3A
-        https://stackoverflow.com/questions/65909025/rotating-a-bitmap-with-3-shears    Lots of inspiration from here
-        https://computergraphics.stackexchange.com/questions/10599/rotate-a-bitmap-with-shearing
-        https://news.ycombinator.com/item?id=34485871 lots of sources
-        https://graphicsinterface.org/wp-content/uploads/gi1986-15.pdf
-        https://gautamnagrawal.medium.com/rotating-image-by-any-angle-shear-transformation-using-only-numpy-d28d16eb5076
-        https://datagenetics.com/blog/august32013/index.html
-        https://www.ocf.berkeley.edu/~fricke/projects/israel/paeth/rotation_by_shearing.html
-        https://www.ocf.berkeley.edu/~fricke/projects/israel/paeth/rotation_by_shearing.html#:~:text=To%20do%20a%20shear%20operation%20on%20a%20raster%20image%20(that%20is%20to%20say%2C%20a%20bitmap)%2C%20we%20just%20shift%20all%20the%20pixels%20in%20a%20given%20row%20(column)%20by%20an%20easy%2Dto%2Dcalculate%20displacement
+    return (2*major*moved - major + 2*minor - 1) / (2*minor);
+}
 
-        https://codereview.stackexchange.com/a/86546 <- Not trishear but might be good enough, it's what is used below
 
-        The last link above highlights the most important part about doing rotations by shears:
-        "To do a shear operation on a raster image (that is to say, a bitmap), we just shift all
-        the pixels in a given row (column) by an easy-to-calculate displacement"
+// Cuts the line down to the part inside the clip bounds (Liang-Barsky).
+// Returns false if none of it is. Only used for very long lines
+static bool engine_draw_line_clip_float(float *x_start, float *y_start, float *x_end, float *y_end){
+    float dx = *x_end - *x_start;
+    float dy = *y_end - *y_start;
 
-        As that link mentions, we'll do the rotation by doing three shears/displacements per-pixel per column.
-        The displacements are performed twice on the x-axis and once on the y axis in x y x order.
-    */
+    float p[4] = {-dx, dx, -dy, dy};
+    float q[4] = {*x_start - (engine_draw_clip_bounds.x0 - 1), (engine_draw_clip_bounds.x1 + 1) - *x_start,
+                  *y_start - (engine_draw_clip_bounds.y0 - 1), (engine_draw_clip_bounds.y1 + 1) - *y_start};
 
-    // ENGINE_PERFORMANCE_CYCLES_START();
-    float inverse_x_scale = 1.0f / x_scale;
-    float inverse_y_scale = 1.0f / y_scale;
-    
-    // https://codereview.stackexchange.com/a/86546
-    float sin_angle = sinf(rotation_radians);
-    float cos_angle = cosf(rotation_radians);
+    float t0 = 0.0f;
+    float t1 = 1.0f;
 
-    // Used to traverse about rotation
-    float sin_angle_inv_scaled = sin_angle * inverse_y_scale;
-    float cos_angle_inv_scaled = cos_angle * inverse_x_scale;
+    for(uint8_t side=0; side<4; side++){
+        if(p[side] == 0.0f){
+            if(q[side] < 0.0f){
+                return false;
+            }
+        }else{
+            float t = q[side] / p[side];
 
-    // Controls the scale of the destination rectangle,
-    // which in turn defines the total scale of the bitmap
-    float scaled_window_width = window_width * x_scale;
-    float scaled_window_height = window_height * y_scale;
+            if(p[side] < 0.0f){
+                t0 = fmaxf(t0, t);
+            }else{
+                t1 = fminf(t1, t);
+            }
+        }
+    }
 
-    float half_scaled_window_width = scaled_window_width * 0.5f;
-    float half_scaled_window_height = scaled_window_height * 0.5f;
+    if(t0 > t1){
+        return false;
+    }
 
-    // When rotated at 45 degrees, make sure corners don't get cut
-    // off: https://math.stackexchange.com/questions/2915935/radius-of-a-circle-touching-a-rectangle-both-of-which-are-inside-a-square
-    int32_t dim = (int32_t)sqrtf((scaled_window_width*scaled_window_width) + (scaled_window_height*scaled_window_height));
-    float dim_half = (dim / 2.0f);
+    *x_end = *x_start + t1 * dx;
+    *y_end = *y_start + t1 * dy;
+    *x_start = *x_start + t0 * dx;
+    *y_start = *y_start + t0 * dy;
+    return true;
+}
 
-    // The top-left of the bitmap destination
-    int32_t top_left_x = (int32_t)floorf(center_x - dim_half);
-    int32_t top_left_y = (int32_t)floorf(center_y - dim_half);
 
-    // If the top-left is above the viewport but
-    // the bitmap may eventually showup, clip the
-    // top of the destination rectangle
-    int32_t j_start = 0;
-    if(top_left_y < 0){
-        j_start = abs(top_left_y);
+// https://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
+void engine_draw_line(uint16_t color, float x_start, float y_start, float x_end, float y_end, mp_obj_t camera_node_base_in, float alpha, engine_shader_t *shader){
+    if(engine_display_damage_is_recording()){
+        float args[] = {DAMAGE_KIND_LINE, color, x_start, y_start, x_end, y_end, alpha};
+        engine_display_damage_record((int32_t)floorf(fminf(x_start, x_end))-1, (int32_t)floorf(fminf(y_start, y_end))-1,
+                                     (int32_t)ceilf(fmaxf(x_start, x_end))+2, (int32_t)ceilf(fmaxf(y_start, y_end))+2,
+                                     engine_draw_damage_signature(args, 7, shader));
+        return;
     }
 
-    // If the top-left is left of the viewport
-    // but the bitmap may eventually showup, clip
-    // the left of the destination rectangle
-    int32_t i_start = 0;
-    if(top_left_x < 0){
-        i_start = abs(top_left_x);
+    // Whole line is outside of the areas that can be drawn to
+    if(engine_draw_clip_overlaps((int32_t)floorf(fminf(x_start, x_end))-1, (int32_t)floorf(fminf(y_start, y_end))-1,
+                                 (int32_t)ceilf(fmaxf(x_start, x_end))+2, (int32_t)ceilf(fmaxf(y_start, y_end))+2) == false){
+        return;
     }
 
-    // 1D index into the screen buffer of where the bitmap will go
-    const uint32_t center_pixel_offset = (top_left_y+j_start) * SCREEN_WIDTH + (top_left_x+i_start);
+    if(fmaxf(fabsf(x_start), fabsf(x_end)) > ENGINE_DRAW_LINE_MAX_COORD || fmaxf(fabsf(y_start), fabsf(y_end)) > ENGINE_DRAW_LINE_MAX_COORD){
+        if(engine_draw_line_clip_float(&x_start, &y_start, &x_end, &y_end) == false){
+            return;
+        }
+    }
 
-    // Used for tracking where we are in the screen_buffer
-    uint32_t dest_offset = center_pixel_offset;
+    int32_t x0 = (int32_t)floorf(x_start);
+    int32_t y0 = (int32_t)floorf(y_start);
+    int32_t x1 = (int32_t)floorf(x_end);
+    int32_t y1 = (int32_t)floorf(y_end);
+
+    // Step along whichever axis the line is longer in (major),
+    // moving along the other (minor) every so often
+    bool x_major = abs(x1 - x0) >= abs(y1 - y0);
+
+    int32_t major_start = x_major ? x0 : y0;
+    int32_t minor_start = x_major ? y0 : x0;
+    int32_t major_step = ((x_major ? x1 - x0 : y1 - y0) >= 0) ? 1 : -1;
+    int32_t minor_step = ((x_major ? y1 - y0 : x1 - x0) >= 0) ? 1 : -1;
+    int32_t major = abs(x_major ? x1 - x0 : y1 - y0);
+    int32_t minor = abs(x_major ? y1 - y0 : x1 - x0);
+
+    // Clip bounds along each axis
+    int32_t major_low = x_major ? engine_draw_clip_bounds.x0 : engine_draw_clip_bounds.y0;
+    int32_t major_high = x_major ? engine_draw_clip_bounds.x1 : engine_draw_clip_bounds.y1;
+    int32_t minor_low = x_major ? engine_draw_clip_bounds.y0 : engine_draw_clip_bounds.x0;
+    int32_t minor_high = x_major ? engine_draw_clip_bounds.y1 : engine_draw_clip_bounds.x1;
+
+    // The first pixel isn't drawn so that connected lines
+    // (like outlines) don't draw their corners twice
+    int32_t k_start = 1;
+    int32_t k_end = major + 1;
+
+    // Steps that are inside the clip bounds along the major axis
+    if(major_step > 0){
+        k_start = MAX(k_start, major_low - major_start);
+        k_end = MIN(k_end, major_high - major_start);
+    }else{
+        k_start = MAX(k_start, major_start - major_high + 1);
+        k_end = MIN(k_end, major_start - major_low + 1);
+    }
+
+    // and along the minor axis
+    int32_t moved_low = (minor_step > 0) ? minor_low - minor_start : minor_start - minor_high + 1;
+    int32_t moved_high = (minor_step > 0) ? minor_high - minor_start : minor_start - minor_low + 1;
+    k_start = MAX(k_start, engine_draw_line_first_step(moved_low, major, minor));
+    k_end = MIN(k_end, engine_draw_line_first_step(moved_high, major, minor));
+
+    if(k_start >= k_end){
+        return;
+    }
+
+    // Where the line is at the first step and its error term there
+    int32_t major_position = major_start + major_step * k_start;
+    int32_t numerator = 2 * k_start * minor + major;
+    int32_t minor_position = minor_start + minor_step * (numerator / (2 * major));
+    int32_t error = numerator % (2 * major);
+
+    // Only one clip area means the bounds above were the whole check
+    bool single_clip = (engine_draw_clip_rect_count == 1);
 
-    // The stride to the next row usually consists of just the
-    // screen width, however, subtract the dimensions of the 
-    // destination rect so that we end up at the next row
-    // in the rect. Also proceed forward on the next row
-    // by the amount we are left clipping the dest rect
-    uint32_t next_dest_row_offset = SCREEN_WIDTH - dim + i_start;
+    for(int32_t k=k_start; k<k_end; k++){
+        int32_t x = x_major ? major_position : minor_position;
+        int32_t y = x_major ? minor_position : major_position;
 
-    int32_t i, j;
+        if(single_clip){
+            engine_draw_plot_no_check(color, x, y, alpha, shader);
+        }else{
+            engine_draw_plot(color, x, y, alpha, shader);
+        }
+
+        major_position += major_step;
+        error += 2 * minor;
+
+        if(error >= 2 * major){
+            error -= 2 * major;
+            minor_position += minor_step;
+        }
+    }
+}
 
+
+
+
+// Texture formats that have their own specialized blit kernels
+enum engine_draw_blit_formats{
+    BLIT_FORMAT_INDEXED_1,
+    BLIT_FORMAT_INDEXED_4,
+    BLIT_FORMAT_INDEXED_8,
+    BLIT_FORMAT_RGB565,
+    BLIT_FORMAT_AXRGB,
+    BLIT_FORMAT_COUNT
+};
+
+
+// Shaders that have their own specialized blit kernels
+enum engine_draw_blit_shaders{
+    BLIT_SHADER_EMPTY,
+    BLIT_SHADER_OPACITY,
+    BLIT_SHADER_BLEND_OPACITY,
+    BLIT_SHADER_COUNT
+};
+
+
+// Everything a blit kernel needs, worked out once per blit
+typedef struct{
+    texture_resource_class_obj_t *texture;
+    engine_shader_t *shader;
+    const uint8_t *data;                // Pixel or color table index data of `texture`
+    const uint16_t *colors;             // Color table of `texture` (only for indexed formats)
+    uint32_t offset;
+    int32_t window_width;
+    int32_t window_height;
+    uint32_t pixels_stride;
+    bool has_transparency;
+    uint16_t transparent_color;
+    float alpha;
+    uint16_t depth;
+    bool axis_aligned;                  // Set when there is no rotation so that the cheaper kernel can be used
+    bool fixed_point;                   // Set when the rotated kernel can step in 16.16 fixed-point
+    bool flip_x;                        // Tiles only, mirror left to right
+    bool flip_y;                        // Tiles only, mirror top to bottom
+
+    uint16_t blend_color;               // Color and amount to interpolate to when the shader is `BLEND_OPACITY_SHADER`
+    uint32_t blend_amount;              // 0 ~ 4096, see `engine_color_blend_12bit`
+    uint32_t alpha_5bit;                // `alpha` as 0 ~ 32 for formats without per-pixel alpha
+
+    float sin_angle;
+    float cos_angle;
+    float sin_angle_inv_scaled;
+    float cos_angle_inv_scaled;
+    float inverse_x_scale;
+    float inverse_y_scale;
+    float half_scaled_window_width;
+    float half_scaled_window_height;
+    float dim_half;
+    int32_t top_left_x;
+    int32_t top_left_y;
+    int32_t i_origin;                   // Column that stepping through the source starts from (see `engine_draw_blit_run`)
+    int32_t i_start;
+    int32_t i_end;
+    int32_t j_start;
+    int32_t j_end;
+}engine_draw_blit_params_t;
+
+
+// Same results as the texture's `get_pixel` but with the format
+// known at compile time so that it can be inlined into the kernel
+static inline __attribute__((always_inline)) uint16_t engine_draw_blit_sample(engine_draw_blit_params_t *params, uint32_t pixel_offset, float *src_alpha, const uint8_t format){
+    switch(format){
+        case BLIT_FORMAT_INDEXED_1:
+        {
+            uint8_t byte_containing_pixel = params->data[pixel_offset >> 3];
+            return params->colors[(byte_containing_pixel >> (7 - (pixel_offset & 0b111))) & 0b1];
+        }
+        case BLIT_FORMAT_INDEXED_4:
+        {
+            uint8_t byte_containing_pixel = params->data[pixel_offset >> 1];
+            return params->colors[(pixel_offset & 0b1) ? (byte_containing_pixel & 0b1111) : (byte_containing_pixel >> 4)];
+        }
+        case BLIT_FORMAT_INDEXED_8:
+            return params->colors[params->data[pixel_offset]];
+        case BLIT_FORMAT_RGB565:
+            return ((const uint16_t*)params->data)[pixel_offset];
+        case BLIT_FORMAT_AXRGB:
+            return texture_resource_get_16bit_axrgb(params->texture, pixel_offset, src_alpha);
+        default:
+            return params->texture->get_pixel(params->texture, pixel_offset, src_alpha);
+    }
+}
+
+
+// Blends with the blit's opacity, the same for every pixel
+// unless the texture format has alpha of its own
+static inline __attribute__((always_inline)) uint16_t engine_draw_blit_alpha_blend(engine_draw_blit_params_t *params, uint16_t bg, uint16_t fg, float src_alpha, const uint8_t format){
+    if(format == BLIT_FORMAT_AXRGB || format == BLIT_FORMAT_COUNT){
+        return engine_color_alpha_blend(bg, fg, params->alpha*src_alpha);
+    }
+
+    return engine_color_alpha_blend_5bit(bg, fg, params->alpha_5bit);
+}
+
+
+// Same results as the shader's `execute` but with the
+// shader known at compile time so that it can be inlined
+static inline __attribute__((always_inline)) uint16_t engine_draw_blit_shade(engine_draw_blit_params_t *params, uint16_t bg, uint16_t fg, float src_alpha, const uint8_t format, const uint8_t shader_kind){
+    switch(shader_kind){
+        case BLIT_SHADER_EMPTY:
+            return fg;
+        case BLIT_SHADER_OPACITY:
+            return engine_draw_blit_alpha_blend(params, bg, fg, src_alpha, format);
+        case BLIT_SHADER_BLEND_OPACITY:
+            return engine_draw_blit_alpha_blend(params, bg, engine_color_blend_12bit(fg, params->blend_color, params->blend_amount), src_alpha, format);
+        default:
+            return params->shader->execute(bg, fg, params->alpha*src_alpha, params->shader);
+    }
+}
+
+
+// Draws a single source pixel to `dest_offset` in the screen buffer
+static inline __attribute__((always_inline)) void engine_draw_blit_put(engine_draw_blit_params_t *params, uint32_t src_offset, uint32_t dest_offset, const uint8_t format, const uint8_t shader_kind, const bool use_depth){
+    float src_alpha = 1.0f;
+    uint16_t src_color = engine_draw_blit_sample(params, src_offset, &src_alpha, format);
+
+    if(params->has_transparency == false || src_color != params->transparent_color){
+        if(use_depth == false || engine_display_store_check_depth_index(dest_offset, params->depth)){
+            active_screen_buffer[dest_offset] = engine_draw_blit_shade(params, active_screen_buffer[dest_offset], src_color, src_alpha, format, shader_kind);
+        }
+    }
+}
+
+
+// Inner loops of the blit for any rotation and scale
+static inline __attribute__((always_inline)) void engine_draw_blit_kernel_rotated(engine_draw_blit_params_t *params, const uint8_t format, const uint8_t shader_kind, const bool use_depth){
     // Start from clipped top and go until max destination rectangle
     // height (bounding-box) or until the start drawing out of bounds
     // (clip bottom)
-    for(j=j_start; j<dim && top_left_y+j < SCREEN_HEIGHT; j++){
+    for(int32_t j=params->j_start; j<params->j_end; j++){
         // Center inside destination rectangle.
         // Offset where we are in the src bitmap
         // by left-clip amount ('i_start')
-        float deltaY = j - dim_half;
-        float deltaX = 0 - dim_half + i_start;
+        float deltaY = j - params->dim_half;
+        float deltaX = 0 - params->dim_half + params->i_origin;
 
         // Calculate the location of the SRC pixel. If the destination
         // gets scaled larger then we need to inversely scale into the
         // src, and vice versa
-        float x = (half_scaled_window_width + deltaX * cos_angle + deltaY * sin_angle) * inverse_x_scale;
-        float y = (half_scaled_window_height - deltaX * sin_angle + deltaY * cos_angle) * inverse_y_scale;
-
-        for(i=i_start; i<dim; i++){
-            // Check if drawing to draw out of bounds to the right,
-            // if so, stop drawing the destination row early and
-            // move on to the next
-            if(top_left_x+i < SCREEN_WIDTH){
-                // Uncomment to see background. Drawing
-                // sprites that are thin could be optimized
-                // screen_buffer[dest_offset] = 0b11111000000000;
+        float x = (params->half_scaled_window_width + deltaX * params->cos_angle + deltaY * params->sin_angle) * params->inverse_x_scale;
+        float y = (params->half_scaled_window_height - deltaX * params->sin_angle + deltaY * params->cos_angle) * params->inverse_y_scale;
+
+        // Step over to the first column instead of starting there so the
+        // same source pixels are picked no matter where the clip starts
+        for(int32_t i=params->i_origin; i<params->i_start; i++){
+            x += params->cos_angle_inv_scaled;
+            y -= params->sin_angle_inv_scaled;
+        }
 
-                // Floor these otherwise get artifacts (don't exactly know why).
-                // Floor + int seems to be faster than comparing floats
-                int32_t rotX = (int32_t)floorf(x);
-                int32_t rotY = (int32_t)floorf(y);
+        // Used for tracking where we are in the screen_buffer
+        uint32_t dest_offset = (params->top_left_y+j) * engine_display_target_width + (params->top_left_x+params->i_start);
 
-                // If statements are expensive! Don't need to check if withing screen
-                // bounds since those dimensions are clipped (destination rect)
-                if((rotX >= 0 && rotX < window_width) && (rotY >= 0 && rotY < window_height)){
-                    uint32_t src_offset = rotY * pixels_stride + rotX;
-                    // uint16_t src_color = pixels[src_offset];
-                    float src_alpha = 1.0f;
-                    uint16_t src_color = texture->get_pixel(texture, offset+src_offset, &src_alpha);
-
-                    if(src_color != transparent_color || src_color == ENGINE_NO_TRANSPARENCY_COLOR){
-                        // active_screen_buffer[dest_offset] = shader->execute(active_screen_buffer[dest_offset], src_color, alpha, shader);
-                        active_screen_buffer[dest_offset] = shader->execute(active_screen_buffer[dest_offset], src_color, alpha*src_alpha, shader);
+        // Columns past the right of the screen were already clipped off
+        for(int32_t i=params->i_start; i<params->i_end; i++){
+            // Anything negative would floor to outside the bitmap, for
+            // everything else truncating is the same as flooring
+            if(x >= 0.0f && y >= 0.0f){
+                int32_t rotX = (int32_t)x;
+                int32_t rotY = (int32_t)y;
+
+                if(rotX < params->window_width && rotY < params->window_height){
+                    engine_draw_blit_put(params, params->offset + rotY * params->pixels_stride + rotX, dest_offset, format, shader_kind, use_depth);
+                }
+            }
+
+            // While in row, keep traversing about rotation
+            x += params->cos_angle_inv_scaled;
+            y -= params->sin_angle_inv_scaled;
+
+            // Go to next pixel next time to set it
+            dest_offset += 1;
+        }
+    }
+}
+
+
+// Inner loops of the blit when there is no rotation. Produces the same
+// pixels as `engine_draw_blit_kernel_rotated` but only visits the part
+// of the destination rectangle that the bitmap actually lands on
+static inline __attribute__((always_inline)) void engine_draw_blit_kernel_axis_aligned(engine_draw_blit_params_t *params, const uint8_t format, const uint8_t shader_kind, const bool use_depth){
+    float deltaX = 0 - params->dim_half + params->i_origin;
+
+    // Without rotation every row samples the same source columns. Work
+    // them out once by stepping exactly like the rotated kernel does so
+    // that scaled bitmaps round to the same columns
+    int16_t src_columns[SCREEN_WIDTH];
+    int32_t column_start = -1;
+    int32_t column_end = -1;
+
+    float x = (params->half_scaled_window_width + deltaX * params->cos_angle + (params->j_start - params->dim_half) * params->sin_angle) * params->inverse_x_scale;
+
+    for(int32_t i=params->i_origin; i<params->i_start; i++){
+        x += params->cos_angle_inv_scaled;
+    }
+
+    for(int32_t i=params->i_start; i<params->i_end; i++){
+        int32_t column = i - params->i_start;
+
+        if(x >= 0.0f && (int32_t)x < params->window_width){
+            src_columns[column] = (int32_t)x;
+
+            if(column_start == -1){
+                column_start = column;
+            }
+
+            column_end = column + 1;
+        }
+
+        x += params->cos_angle_inv_scaled;
+    }
+
+    // Bitmap is entirely clipped off the left or right of the screen
+    if(column_start == -1){
+        return;
+    }
+
+    // At a scale of 1 each row is a straight copy from the source row
+    const bool unit_columns = (params->cos_angle_inv_scaled == 1.0f);
+
+    for(int32_t j=params->j_start; j<params->j_end; j++){
+        float deltaY = j - params->dim_half;
+        float y = (params->half_scaled_window_height - deltaX * params->sin_angle + deltaY * params->cos_angle) * params->inverse_y_scale;
+
+        // Rows of the destination rectangle above or below the bitmap
+        if(y < 0.0f || (int32_t)y >= params->window_height){
+            continue;
+        }
+
+        uint32_t src_row_offset = params->offset + (int32_t)y * params->pixels_stride;
+        uint32_t dest_row_offset = (params->top_left_y+j) * engine_display_target_width + (params->top_left_x+params->i_start);
+
+        // Opaque RGB565 pixels can be copied in spans that
+        // stop at transparent pixels instead of one by one
+        if(format == BLIT_FORMAT_RGB565 && shader_kind == BLIT_SHADER_EMPTY && use_depth == false && unit_columns){
+            const uint16_t *src_row = (const uint16_t*)params->data + src_row_offset;
+            int32_t column = column_start;
+
+            while(column < column_end){
+                // Skip to the start of the next span of opaque pixels
+                if(params->has_transparency){
+                    while(column < column_end && src_row[src_columns[column]] == params->transparent_color){
+                        column++;
                     }
                 }
 
-                // While in row, keep traversing about rotation
-                x += cos_angle_inv_scaled;
-                y -= sin_angle_inv_scaled;
+                int32_t span_start = column;
 
-                // Go to next pixel next time to set it
+                while(column < column_end && (params->has_transparency == false || src_row[src_columns[column]] != params->transparent_color)){
+                    column++;
+                }
+
+                if(column > span_start){
+                    memcpy(active_screen_buffer + dest_row_offset + span_start, src_row + src_columns[span_start], (column - span_start) * sizeof(uint16_t));
+                }
+            }
+
+            continue;
+        }
+
+        for(int32_t column=column_start; column<column_end; column++){
+            engine_draw_blit_put(params, src_row_offset + src_columns[column], dest_row_offset + column, format, shader_kind, use_depth);
+        }
+    }
+}
+
+
+// Fractional bits of the fixed-point texture coordinates. Texture
+// coordinates have to stay under 2^15 to fit in an int32_t
+#define BLIT_FIXED_SHIFT 16
+#define BLIT_FIXED_ONE (1 << BLIT_FIXED_SHIFT)
+#define BLIT_FIXED_MAX_COORD 32767.0f
+
+static bool engine_draw_blit_fixed_point = true;
+
+
+void engine_draw_set_blit_fixed_point(bool enabled){
+    engine_draw_blit_fixed_point = enabled;
+}
+
+
+static inline int32_t engine_draw_blit_to_fixed(float value){
+    return (int32_t)floorf(value * BLIT_FIXED_ONE);
+}
+
+
+// Narrows the columns ['k_start', 'k_end') of a row to those where
+// 'start + k*step' (16.16) lands in [0, 'limit') so that the row's
+// loop doesn't need to range check each texture coordinate
+static inline void engine_draw_blit_fixed_clip(int32_t start, int32_t step, int32_t limit, int32_t *k_start, int32_t *k_end){
+    int32_t low;
+    int32_t high;
+
+    if(step > 0){
+        low = (start >= 0) ? 0 : (-start + step - 1) / step;
+        high = (start < limit) ? (limit - 1 - start) / step + 1 : 0;
+    }else if(step < 0){
+        step = -step;
+        low = (start < limit) ? 0 : (start - limit) / step + 1;
+        high = (start >= 0) ? start / step + 1 : 0;
+    }else{
+        if(start < 0 || start >= limit){
+            *k_end = *k_start;
+        }
+        return;
+    }
+
+    *k_start = MAX(*k_start, low);
+    *k_end = MIN(*k_end, high);
+}
+
+
+// Inner loops of the blit for any rotation and scale, same as
+// `engine_draw_blit_kernel_rotated` but stepping through the texture
+// with integer adds. Each row is clipped to the columns that land in
+// the bitmap first so there's no per-pixel range check
+static inline __attribute__((always_inline)) void engine_draw_blit_kernel_rotated_fixed(engine_draw_blit_params_t *params, const uint8_t format, const uint8_t shader_kind, const bool use_depth){
+    int32_t columns = params->i_end - params->i_start;
+    int32_t skip = params->i_start - params->i_origin;
+
+    float deltaX = 0 - params->dim_half + params->i_origin;
+    float deltaY = params->j_start - params->dim_half;
+
+    // Texture coordinates of the first column of the first row
+    int32_t row_x = engine_draw_blit_to_fixed((params->half_scaled_window_width + deltaX * params->cos_angle + deltaY * params->sin_angle) * params->inverse_x_scale + skip * params->cos_angle_inv_scaled);
+    int32_t row_y = engine_draw_blit_to_fixed((params->half_scaled_window_height - deltaX * params->sin_angle + deltaY * params->cos_angle) * params->inverse_y_scale - skip * params->sin_angle_inv_scaled);
+
+    // Along a row and from one row to the next
+    int32_t step_x = engine_draw_blit_to_fixed(params->cos_angle_inv_scaled);
+    int32_t step_y = -engine_draw_blit_to_fixed(params->sin_angle_inv_scaled);
+    int32_t row_step_x = engine_draw_blit_to_fixed(params->sin_angle * params->inverse_x_scale);
+    int32_t row_step_y = engine_draw_blit_to_fixed(params->cos_angle * params->inverse_y_scale);
+
+    int32_t limit_x = params->window_width << BLIT_FIXED_SHIFT;
+    int32_t limit_y = params->window_height << BLIT_FIXED_SHIFT;
+
+    for(int32_t j=params->j_start; j<params->j_end; j++){
+        int32_t k_start = 0;
+        int32_t k_end = columns;
+
+        engine_draw_blit_fixed_clip(row_x, step_x, limit_x, &k_start, &k_end);
+        engine_draw_blit_fixed_clip(row_y, step_y, limit_y, &k_start, &k_end);
+
+        if(k_start < k_end){
+            int32_t x = row_x + k_start * step_x;
+            int32_t y = row_y + k_start * step_y;
+
+            uint32_t dest_offset = (params->top_left_y+j) * engine_display_target_width + (params->top_left_x+params->i_start+k_start);
+
+            for(int32_t k=k_start; k<k_end; k++){
+                engine_draw_blit_put(params, params->offset + (y >> BLIT_FIXED_SHIFT) * params->pixels_stride + (x >> BLIT_FIXED_SHIFT), dest_offset, format, shader_kind, use_depth);
+
+                x += step_x;
+                y += step_y;
                 dest_offset += 1;
-            }else{
-                // After this will be a subtraction by 'dim'
-                // but we need to be at the end of the row
-                // for that to work, set 'dest_offset' to end
-                // See 'next_dest_row_offset'
-                dest_offset += dim-i;
-                break;
             }
         }
 
-        // Go to next row but at the left of it (SCREEN_WIDTH - dim)
-        dest_offset += next_dest_row_offset;
+        row_x += row_step_x;
+        row_y += row_step_y;
     }
+}
 
-    // ENGINE_PERFORMANCE_CYCLES_STOP();
+
+// The inner loops of the blit. Always inlined with constant `format`,
+// `shader_kind`, and `use_depth` so that each kernel below gets its own
+// copy with all the per-pixel branching on those folded away
+static inline __attribute__((always_inline)) void engine_draw_blit_kernel(engine_draw_blit_params_t *params, const uint8_t format, const uint8_t shader_kind, const bool use_depth){
+    if(params->axis_aligned){
+        engine_draw_blit_kernel_axis_aligned(params, format, shader_kind, use_depth);
+    }else if(params->fixed_point){
+        engine_draw_blit_kernel_rotated_fixed(params, format, shader_kind, use_depth);
+    }else{
+        engine_draw_blit_kernel_rotated(params, format, shader_kind, use_depth);
+    }
 }
 
 
-void engine_draw_blit_depth(texture_resource_class_obj_t *texture, uint32_t offset, float center_x, float center_y, int32_t window_width, int32_t window_height, uint32_t pixels_stride, float x_scale, float y_scale, float rotation_radians, uint16_t transparent_color, float alpha, uint16_t depth, engine_shader_t *shader){
+// Kernel for textures or shaders without a specialized kernel
+static void engine_draw_blit_kernel_generic(engine_draw_blit_params_t *params){
+    engine_draw_blit_kernel(params, BLIT_FORMAT_COUNT, BLIT_SHADER_COUNT, false);
+}
+
+
+static void engine_draw_blit_kernel_generic_depth(engine_draw_blit_params_t *params){
+    engine_draw_blit_kernel(params, BLIT_FORMAT_COUNT, BLIT_SHADER_COUNT, true);
+}
+
+
+#define ENGINE_DRAW_BLIT_KERNEL(format, shader_kind)                                                \
+    static void engine_draw_blit_kernel_##format##_##shader_kind(engine_draw_blit_params_t *params){        \
+        engine_draw_blit_kernel(params, format, shader_kind, false);                                 \
+    }                                                                                                \
+    static void engine_draw_blit_kernel_##format##_##shader_kind##_depth(engine_draw_blit_params_t *params){ \
+        engine_draw_blit_kernel(params, format, shader_kind, true);                                  \
+    }
+
+#define ENGINE_DRAW_BLIT_KERNELS(format)                        \
+    ENGINE_DRAW_BLIT_KERNEL(format, BLIT_SHADER_EMPTY)          \
+    ENGINE_DRAW_BLIT_KERNEL(format, BLIT_SHADER_OPACITY)        \
+    ENGINE_DRAW_BLIT_KERNEL(format, BLIT_SHADER_BLEND_OPACITY)
+
+ENGINE_DRAW_BLIT_KERNELS(BLIT_FORMAT_INDEXED_1)
+ENGINE_DRAW_BLIT_KERNELS(BLIT_FORMAT_INDEXED_4)
+ENGINE_DRAW_BLIT_KERNELS(BLIT_FORMAT_INDEXED_8)
+ENGINE_DRAW_BLIT_KERNELS(BLIT_FORMAT_RGB565)
+ENGINE_DRAW_BLIT_KERNELS(BLIT_FORMAT_AXRGB)
+
+#define ENGINE_DRAW_BLIT_KERNEL_ENTRY(format, shader_kind)   \
+    {engine_draw_blit_kernel_##format##_##shader_kind, engine_draw_blit_kernel_##format##_##shader_kind##_depth}
+
+#define ENGINE_DRAW_BLIT_KERNEL_ENTRIES(format)                         \
+    {                                                                   \
+        ENGINE_DRAW_BLIT_KERNEL_ENTRY(format, BLIT_SHADER_EMPTY),       \
+        ENGINE_DRAW_BLIT_KERNEL_ENTRY(format, BLIT_SHADER_OPACITY),     \
+        ENGINE_DRAW_BLIT_KERNEL_ENTRY(format, BLIT_SHADER_BLEND_OPACITY)\
+    }
+
+// Indexed by [format][shader][depth off/on]
+static void (*const engine_draw_blit_kernels[BLIT_FORMAT_COUNT][BLIT_SHADER_COUNT][2])(engine_draw_blit_params_t *params) = {
+    ENGINE_DRAW_BLIT_KERNEL_ENTRIES(BLIT_FORMAT_INDEXED_1),
+    ENGINE_DRAW_BLIT_KERNEL_ENTRIES(BLIT_FORMAT_INDEXED_4),
+    ENGINE_DRAW_BLIT_KERNEL_ENTRIES(BLIT_FORMAT_INDEXED_8),
+    ENGINE_DRAW_BLIT_KERNEL_ENTRIES(BLIT_FORMAT_RGB565),
+    ENGINE_DRAW_BLIT_KERNEL_ENTRIES(BLIT_FORMAT_AXRGB),
+};
+
+
+static uint8_t engine_draw_blit_get_format(texture_resource_class_obj_t *texture){
+    if(texture->get_pixel == texture_resource_get_indexed_pixel){
+        switch(texture->bit_depth){
+            case 1: return BLIT_FORMAT_INDEXED_1;
+            case 4: return BLIT_FORMAT_INDEXED_4;
+            case 8: return BLIT_FORMAT_INDEXED_8;
+        }
+    }else if(texture->get_pixel == texture_resource_get_16bit_rgb565){
+        return BLIT_FORMAT_RGB565;
+    }else if(texture->get_pixel == texture_resource_get_16bit_axrgb){
+        return BLIT_FORMAT_AXRGB;
+    }
+
+    return BLIT_FORMAT_COUNT;
+}
+
+
+static uint8_t engine_draw_blit_get_shader_kind(engine_shader_t *shader){
+    if(shader == engine_get_builtin_shader(EMPTY_SHADER)){
+        return BLIT_SHADER_EMPTY;
+    }else if(shader == engine_get_builtin_shader(OPACITY_SHADER)){
+        return BLIT_SHADER_OPACITY;
+    }else if(shader == engine_get_builtin_shader(BLEND_OPACITY_SHADER)){
+        return BLIT_SHADER_BLEND_OPACITY;
+    }
+
+    return BLIT_SHADER_COUNT;
+}
+
+
+static void engine_draw_blit_run(texture_resource_class_obj_t *texture, uint32_t offset, float center_x, float center_y, int32_t window_width, int32_t window_height, uint32_t pixels_stride, float x_scale, float y_scale, float rotation_radians, uint16_t transparent_color, float alpha, bool use_depth, uint16_t depth, engine_shader_t *shader){
     /*  https://cohost.org/tomforsyth/post/891823-rotation-with-three#:~:text=But%20the%20TL%3BDR%20is%20you%20do%20three%20shears%3A
         https://stackoverflow.com/questions/65909025/rotating-a-bitmap-with-3-shears    Lots of inspiration from here
         https://computergraphics.stackexchange.com/questions/10599/rotate-a-bitmap-with-shearing
@@ -255,131 +932,258 @@ void engine_draw_blit_depth(texture_resource_class_obj_t *texture, uint32_t offs
     */
 
     // ENGINE_PERFORMANCE_CYCLES_START();
-    float inverse_x_scale = 1.0f / x_scale;
-    float inverse_y_scale = 1.0f / y_scale;
+    engine_draw_blit_params_t params;
+
+    params.texture = texture;
+    params.shader = shader;
+    params.data = ((mp_obj_array_t*)texture->data)->items;
+    params.colors = (texture->bit_depth < 16) ? ((mp_obj_array_t*)texture->colors)->items : NULL;
+    params.offset = offset;
+    params.window_width = window_width;
+    params.window_height = window_height;
+    params.pixels_stride = pixels_stride;
+    params.has_transparency = (transparent_color != ENGINE_NO_TRANSPARENCY_COLOR);
+    params.transparent_color = transparent_color;
+    params.alpha = alpha;
+    params.depth = depth;
+
+    // Only used for `blend_opacity_shader`, its first op is the interpolation
+    params.blend_color = shader->ops[0].color;
+    params.blend_amount = shader->ops[0].amount;
+    params.alpha_5bit = engine_color_alpha_to_5bit(alpha);
+
+    params.inverse_x_scale = 1.0f / x_scale;
+    params.inverse_y_scale = 1.0f / y_scale;
     
     // https://codereview.stackexchange.com/a/86546
-    float sin_angle = sinf(rotation_radians);
-    float cos_angle = cosf(rotation_radians);
+    params.sin_angle = sinf(rotation_radians);
+    params.cos_angle = cosf(rotation_radians);
 
     // Used to traverse about rotation
-    float sin_angle_inv_scaled = sin_angle * inverse_y_scale;
-    float cos_angle_inv_scaled = cos_angle * inverse_x_scale;
+    params.sin_angle_inv_scaled = params.sin_angle * params.inverse_y_scale;
+    params.cos_angle_inv_scaled = params.cos_angle * params.inverse_x_scale;
 
     // Controls the scale of the destination rectangle,
     // which in turn defines the total scale of the bitmap
     float scaled_window_width = window_width * x_scale;
     float scaled_window_height = window_height * y_scale;
 
-    float half_scaled_window_width = scaled_window_width * 0.5f;
-    float half_scaled_window_height = scaled_window_height * 0.5f;
+    params.half_scaled_window_width = scaled_window_width * 0.5f;
+    params.half_scaled_window_height = scaled_window_height * 0.5f;
 
     // When rotated at 45 degrees, make sure corners don't get cut
     // off: https://math.stackexchange.com/questions/2915935/radius-of-a-circle-touching-a-rectangle-both-of-which-are-inside-a-square
     int32_t dim = (int32_t)sqrtf((scaled_window_width*scaled_window_width) + (scaled_window_height*scaled_window_height));
-    float dim_half = (dim / 2.0f);
+    params.dim_half = (dim / 2.0f);
 
     // The top-left of the bitmap destination
-    int32_t top_left_x = (int32_t)floorf(center_x - dim_half);
-    int32_t top_left_y = (int32_t)floorf(center_y - dim_half);
+    params.top_left_x = (int32_t)floorf(center_x - params.dim_half);
+    params.top_left_y = (int32_t)floorf(center_y - params.dim_half);
+
+    if(engine_display_damage_is_recording()){
+        // Pixels of the texture changing (not through the
+        // offset) isn't noticed, that needs to be added by hand
+        float args[] = {DAMAGE_KIND_BLIT, offset, center_x, center_y, window_width, window_height, pixels_stride, x_scale, y_scale, rotation_radians, transparent_color, alpha, use_depth, depth};
+        uint32_t signature = engine_draw_damage_signature(args, 14, shader);
+        signature = engine_display_damage_hash(signature, &texture, sizeof(texture_resource_class_obj_t*));
+        signature = engine_display_damage_hash(signature, &texture->revision, sizeof(uint32_t));
+
+        engine_display_damage_record(params.top_left_x, params.top_left_y, params.top_left_x+dim, params.top_left_y+dim, signature);
+        return;
+    }
+
+    // Exactly no rotation, rows and columns of the bitmap line up with the screen
+    params.axis_aligned = (params.sin_angle == 0.0f && params.cos_angle == 1.0f);
 
-    // If the top-left is above the viewport but
-    // the bitmap may eventually showup, clip the
-    // top of the destination rectangle
-    int32_t j_start = 0;
-    if(top_left_y < 0){
-        j_start = abs(top_left_y);
+    // Largest texture coordinate anywhere in the destination
+    // rectangle has to fit in 16.16 (tiny scales don't)
+    float max_x = (fabsf(params.half_scaled_window_width) + dim * (fabsf(params.cos_angle) + fabsf(params.sin_angle))) * fabsf(params.inverse_x_scale);
+    float max_y = (fabsf(params.half_scaled_window_height) + dim * (fabsf(params.cos_angle) + fabsf(params.sin_angle))) * fabsf(params.inverse_y_scale);
+    params.fixed_point = engine_draw_blit_fixed_point && max_x < BLIT_FIXED_MAX_COORD && max_y < BLIT_FIXED_MAX_COORD && window_width < BLIT_FIXED_MAX_COORD && window_height < BLIT_FIXED_MAX_COORD;
+
+    // Pick the kernel once for the whole blit
+    uint8_t format = engine_draw_blit_get_format(texture);
+    uint8_t shader_kind = engine_draw_blit_get_shader_kind(shader);
+
+    void (*kernel)(engine_draw_blit_params_t *params);
+
+    if(format == BLIT_FORMAT_COUNT || shader_kind == BLIT_SHADER_COUNT){
+        kernel = use_depth ? engine_draw_blit_kernel_generic_depth : engine_draw_blit_kernel_generic;
+    }else{
+        kernel = engine_draw_blit_kernels[format][shader_kind][use_depth];
     }
 
-    // If the top-left is left of the viewport
-    // but the bitmap may eventually showup, clip
-    // the left of the destination rectangle
-    int32_t i_start = 0;
-    if(top_left_x < 0){
-        i_start = abs(top_left_x);
+    // Columns left of the screen are never stepped through. Clip
+    // areas further right step from here too so that the edges
+    // of areas drawn separately line up (see the kernels)
+    params.i_origin = MAX(0, -params.top_left_x);
+
+    // Clip the destination rectangle to each clip area (just
+    // the screen usually) once instead of per-pixel
+    for(uint8_t index=0; index<engine_draw_clip_rect_count; index++){
+        engine_display_rect_t *clip = &engine_draw_clip_rects[index];
+
+        params.i_start = MAX(0, clip->x0 - params.top_left_x);
+        params.j_start = MAX(0, clip->y0 - params.top_left_y);
+        params.i_end = MIN(dim, clip->x1 - params.top_left_x);
+        params.j_end = MIN(dim, clip->y1 - params.top_left_y);
+
+        if(params.i_start < params.i_end && params.j_start < params.j_end){
+            kernel(&params);
+        }
     }
 
-    // 1D index into the screen buffer of where the bitmap will go
-    const uint32_t center_pixel_offset = (top_left_y+j_start) * SCREEN_WIDTH + (top_left_x+i_start);
+    // ENGINE_PERFORMANCE_CYCLES_STOP();
+}
 
-    // Used for tracking where we are in the screen_buffer
-    uint32_t dest_offset = center_pixel_offset;
 
-    // The stride to the next row usually consists of just the
-    // screen width, however, subtract the dimensions of the 
-    // destination rect so that we end up at the next row
-    // in the rect. Also proceed forward on the next row
-    // by the amount we are left clipping the dest rect
-    uint32_t next_dest_row_offset = SCREEN_WIDTH - dim + i_start;
+void engine_draw_blit(texture_resource_class_obj_t *texture, uint32_t offset, float center_x, float center_y, int32_t window_width, int32_t window_height, uint32_t pixels_stride, float x_scale, float y_scale, float rotation_radians, uint16_t transparent_color, float alpha, engine_shader_t *shader){
+    engine_draw_blit_run(texture, offset, center_x, center_y, window_width, window_height, pixels_stride, x_scale, y_scale, rotation_radians, transparent_color, alpha, false, 0, shader);
+}
 
-    int32_t i, j;
 
-    // Start from clipped top and go until max destination rectangle
-    // height (bounding-box) or until the start drawing out of bounds
-    // (clip bottom)
-    for(j=j_start; j<dim && top_left_y+j < SCREEN_HEIGHT; j++){
-        // Center inside destination rectangle.
-        // Offset where we are in the src bitmap
-        // by left-clip amount ('i_start')
-        float deltaY = j - dim_half;
-        float deltaX = 0 - dim_half + i_start;
+void engine_draw_blit_depth(texture_resource_class_obj_t *texture, uint32_t offset, float center_x, float center_y, int32_t window_width, int32_t window_height, uint32_t pixels_stride, float x_scale, float y_scale, float rotation_radians, uint16_t transparent_color, float alpha, uint16_t depth, engine_shader_t *shader){
+    engine_draw_blit_run(texture, offset, center_x, center_y, window_width, window_height, pixels_stride, x_scale, y_scale, rotation_radians, transparent_color, alpha, true, depth, shader);
+}
 
-        // Calculate the location of the SRC pixel. If the destination
-        // gets scaled larger then we need to inversely scale into the
-        // src, and vice versa
-        float x = (half_scaled_window_width + deltaX * cos_angle + deltaY * sin_angle) * inverse_x_scale;
-        float y = (half_scaled_window_height - deltaX * sin_angle + deltaY * cos_angle) * inverse_y_scale;
-
-        for(i=i_start; i<dim; i++){
-            // Check if drawing to draw out of bounds to the right,
-            // if so, stop drawing the destination row early and
-            // move on to the next
-            if(top_left_x+i < SCREEN_WIDTH){
-                // Uncomment to see background. Drawing
-                // sprites that are thin could be optimized
-                // screen_buffer[dest_offset] = 0b11111000000000;
 
-                // Floor these otherwise get artifacts (don't exactly know why).
-                // Floor + int seems to be faster than comparing floats
-                int32_t rotX = (int32_t)floorf(x);
-                int32_t rotY = (int32_t)floorf(y);
+// Inner loops of a tile, source rows and columns map straight onto the
+// screen (flipped or not) so there's nothing to step through
+static inline __attribute__((always_inline)) void engine_draw_tile_kernel(engine_draw_blit_params_t *params, const uint8_t format, const uint8_t shader_kind){
+    for(int32_t j=params->j_start; j<params->j_end; j++){
+        int32_t y = params->flip_y ? (params->window_height - 1 - j) : j;
 
-                // If statements are expensive! Don't need to check if withing screen
-                // bounds since those dimensions are clipped (destination rect)
-                if((rotX >= 0 && rotX < window_width) && (rotY >= 0 && rotY < window_height)){
-                    uint32_t src_offset = rotY * pixels_stride + rotX;
-                    // uint16_t src_color = pixels[src_offset];
-                    float src_alpha = 1.0f;
-                    uint16_t src_color = texture->get_pixel(texture, offset+src_offset, &src_alpha);
-
-                    if(src_color != transparent_color || src_color == ENGINE_NO_TRANSPARENCY_COLOR){
-                        if(engine_display_store_check_depth_index(dest_offset, depth)){
-                            active_screen_buffer[dest_offset] = shader->execute(active_screen_buffer[dest_offset], src_color, alpha*src_alpha, shader);
-                        }
+        uint32_t src_row_offset = params->offset + y * params->pixels_stride;
+        uint32_t dest_row_offset = (params->top_left_y+j) * engine_display_target_width + params->top_left_x;
+
+        // Opaque RGB565 pixels can be copied in spans that
+        // stop at transparent pixels instead of one by one
+        if(format == BLIT_FORMAT_RGB565 && shader_kind == BLIT_SHADER_EMPTY && params->flip_x == false){
+            const uint16_t *src_row = (const uint16_t*)params->data + src_row_offset;
+            int32_t column = params->i_start;
+
+            while(column < params->i_end){
+                if(params->has_transparency){
+                    while(column < params->i_end && src_row[column] == params->transparent_color){
+                        column++;
                     }
                 }
 
-                // While in row, keep traversing about rotation
-                x += cos_angle_inv_scaled;
-                y -= sin_angle_inv_scaled;
+                int32_t span_start = column;
 
-                // Go to next pixel next time to set it
-                dest_offset += 1;
-            }else{
-                // After this will be a subtraction by 'dim'
-                // but we need to be at the end of the row
-                // for that to work, set 'dest_offset' to end
-                // See 'next_dest_row_offset'
-                dest_offset += dim-i;
-                break;
+                while(column < params->i_end && (params->has_transparency == false || src_row[column] != params->transparent_color)){
+                    column++;
+                }
+
+                if(column > span_start){
+                    memcpy(active_screen_buffer + dest_row_offset + span_start, src_row + span_start, (column - span_start) * sizeof(uint16_t));
+                }
             }
+
+            continue;
         }
 
-        // Go to next row but at the left of it (SCREEN_WIDTH - dim)
-        dest_offset += next_dest_row_offset;
+        for(int32_t i=params->i_start; i<params->i_end; i++){
+            int32_t x = params->flip_x ? (params->window_width - 1 - i) : i;
+            engine_draw_blit_put(params, src_row_offset + x, dest_row_offset + i, format, shader_kind, false);
+        }
     }
+}
 
-    // ENGINE_PERFORMANCE_CYCLES_STOP();
+
+static void engine_draw_tile_kernel_generic(engine_draw_blit_params_t *params){
+    engine_draw_tile_kernel(params, BLIT_FORMAT_COUNT, BLIT_SHADER_COUNT);
+}
+
+
+#define ENGINE_DRAW_TILE_KERNEL(format, shader_kind)                                            \
+    static void engine_draw_tile_kernel_##format##_##shader_kind(engine_draw_blit_params_t *params){   \
+        engine_draw_tile_kernel(params, format, shader_kind);                                   \
+    }
+
+#define ENGINE_DRAW_TILE_KERNELS(format)                        \
+    ENGINE_DRAW_TILE_KERNEL(format, BLIT_SHADER_EMPTY)          \
+    ENGINE_DRAW_TILE_KERNEL(format, BLIT_SHADER_OPACITY)        \
+    ENGINE_DRAW_TILE_KERNEL(format, BLIT_SHADER_BLEND_OPACITY)
+
+ENGINE_DRAW_TILE_KERNELS(BLIT_FORMAT_INDEXED_1)
+ENGINE_DRAW_TILE_KERNELS(BLIT_FORMAT_INDEXED_4)
+ENGINE_DRAW_TILE_KERNELS(BLIT_FORMAT_INDEXED_8)
+ENGINE_DRAW_TILE_KERNELS(BLIT_FORMAT_RGB565)
+ENGINE_DRAW_TILE_KERNELS(BLIT_FORMAT_AXRGB)
+
+#define ENGINE_DRAW_TILE_KERNEL_ENTRIES(format)                 \
+    {                                                           \
+        engine_draw_tile_kernel_##format##_BLIT_SHADER_EMPTY,   \
+        engine_draw_tile_kernel_##format##_BLIT_SHADER_OPACITY, \
+        engine_draw_tile_kernel_##format##_BLIT_SHADER_BLEND_OPACITY \
+    }
+
+// Indexed by [format][shader]
+static void (*const engine_draw_tile_kernels[BLIT_FORMAT_COUNT][BLIT_SHADER_COUNT])(engine_draw_blit_params_t *params) = {
+    ENGINE_DRAW_TILE_KERNEL_ENTRIES(BLIT_FORMAT_INDEXED_1),
+    ENGINE_DRAW_TILE_KERNEL_ENTRIES(BLIT_FORMAT_INDEXED_4),
+    ENGINE_DRAW_TILE_KERNEL_ENTRIES(BLIT_FORMAT_INDEXED_8),
+    ENGINE_DRAW_TILE_KERNEL_ENTRIES(BLIT_FORMAT_RGB565),
+    ENGINE_DRAW_TILE_KERNEL_ENTRIES(BLIT_FORMAT_AXRGB),
+};
+
+
+void engine_draw_tile(texture_resource_class_obj_t *texture, uint32_t offset, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t pixels_stride, bool flip_x, bool flip_y, uint16_t transparent_color, float alpha, engine_shader_t *shader){
+    if(engine_display_damage_is_recording()){
+        float args[] = {DAMAGE_KIND_TILE, offset, x, y, width, height, pixels_stride, flip_x, flip_y, transparent_color, alpha};
+        uint32_t signature = engine_draw_damage_signature(args, 11, shader);
+        signature = engine_display_damage_hash(signature, &texture, sizeof(texture_resource_class_obj_t*));
+        signature = engine_display_damage_hash(signature, &texture->revision, sizeof(uint32_t));
+
+        engine_display_damage_record(x, y, x+width, y+height, signature);
+        return;
+    }
+
+    engine_draw_blit_params_t params;
+
+    params.texture = texture;
+    params.shader = shader;
+    params.data = ((mp_obj_array_t*)texture->data)->items;
+    params.colors = (texture->bit_depth < 16) ? ((mp_obj_array_t*)texture->colors)->items : NULL;
+    params.offset = offset;
+    params.window_width = width;
+    params.window_height = height;
+    params.pixels_stride = pixels_stride;
+    params.has_transparency = (transparent_color != ENGINE_NO_TRANSPARENCY_COLOR);
+    params.transparent_color = transparent_color;
+    params.alpha = alpha;
+    params.flip_x = flip_x;
+    params.flip_y = flip_y;
+    params.blend_color = shader->ops[0].color;
+    params.blend_amount = shader->ops[0].amount;
+    params.alpha_5bit = engine_color_alpha_to_5bit(alpha);
+    params.top_left_x = x;
+    params.top_left_y = y;
+
+    uint8_t format = engine_draw_blit_get_format(texture);
+    uint8_t shader_kind = engine_draw_blit_get_shader_kind(shader);
+
+    void (*kernel)(engine_draw_blit_params_t *params);
+
+    if(format == BLIT_FORMAT_COUNT || shader_kind == BLIT_SHADER_COUNT){
+        kernel = engine_draw_tile_kernel_generic;
+    }else{
+        kernel = engine_draw_tile_kernels[format][shader_kind];
+    }
+
+    for(uint8_t index=0; index<engine_draw_clip_rect_count; index++){
+        engine_display_rect_t *clip = &engine_draw_clip_rects[index];
+
+        params.i_start = MAX(0, clip->x0 - x);
+        params.j_start = MAX(0, clip->y0 - y);
+        params.i_end = MIN(width, clip->x1 - x);
+        params.j_end = MIN(height, clip->y1 - y);
+
+        if(params.i_start < params.i_end && params.j_start < params.j_end){
+            kernel(&params);
+        }
+    }
 }
 
 
@@ -433,62 +1237,49 @@ void engine_draw_rect(uint16_t color, float center_x, float center_y, int32_t wi
     int32_t top_left_x = (int32_t)floorf(center_x - dim_half);
     int32_t top_left_y = (int32_t)floorf(center_y - dim_half);
 
-    // If the top-left is above the viewport but
-    // the bitmap may eventually showup, clip the
-    // top of the destination rectangle
-    int32_t j_start = 0;
-    if(top_left_y < 0){
-        j_start = abs(top_left_y);
+    if(engine_display_damage_is_recording()){
+        float args[] = {DAMAGE_KIND_RECT, color, center_x, center_y, width, height, x_scale, y_scale, rotation_radians, alpha};
+        engine_display_damage_record(top_left_x, top_left_y, top_left_x+dim, top_left_y+dim, engine_draw_damage_signature(args, 10, shader));
+        return;
     }
 
-    // If the top-left is left of the viewport
-    // but the bitmap may eventually showup, clip
-    // the left of the destination rectangle
-    int32_t i_start = 0;
-    if(top_left_x < 0){
-        i_start = abs(top_left_x);
-    }
-
-    // 1D index into the screen buffer of where the bitmap will go
-    const uint32_t center_pixel_offset = (top_left_y+j_start) * SCREEN_WIDTH + (top_left_x+i_start);
-
-    // Used for tracking where we are in the screen_buffer
-    uint32_t dest_offset = center_pixel_offset;
-
-    // The stride to the next row usually consists of just the
-    // screen width, however, subtract the dimensions of the 
-    // destination rect so that we end up at the next row
-    // in the rect. Also proceed forward on the next row
-    // by the amount we are left clipping the dest rect
-    uint32_t next_dest_row_offset = SCREEN_WIDTH - dim + i_start;
-
-    int32_t i, j;
-
-    // Start from clipped top and go until max destination rectangle
-    // height (bounding-box) or until the start drawing out of bounds
-    // (clip bottom)
-    for(j=j_start; j<dim && top_left_y+j < SCREEN_HEIGHT; j++){
-        // Center inside destination rectangle.
-        // Offset where we are in the src bitmap
-        // by left-clip amount ('i_start')
-        float deltaY = j - dim_half;
-        float deltaX = 0 - dim_half + i_start;
+    // Columns left of the screen are never stepped through
+    int32_t i_origin = MAX(0, -top_left_x);
+
+    for(uint8_t index=0; index<engine_draw_clip_rect_count; index++){
+        engine_display_rect_t *clip = &engine_draw_clip_rects[index];
+
+        // Clip the destination rectangle to the clip area (just
+        // the screen usually) once instead of per-pixel
+        int32_t i_start = MAX(0, clip->x0 - top_left_x);
+        int32_t j_start = MAX(0, clip->y0 - top_left_y);
+        int32_t i_end = MIN(dim, clip->x1 - top_left_x);
+        int32_t j_end = MIN(dim, clip->y1 - top_left_y);
+
+        for(int32_t j=j_start; j<j_end; j++){
+            // Center inside destination rectangle.
+            // Offset where we are in the src bitmap
+            // by left-clip amount ('i_start')
+            float deltaY = j - dim_half;
+            float deltaX = 0 - dim_half + i_origin;
+
+            // Calculate the location of the SRC pixel. If the destination
+            // gets scaled larger then we need to inversely scale into the
+            // src, and vice versa
+            float x = (half_scaled_width + deltaX * cos_angle + deltaY * sin_angle) * inverse_x_scale;
+            float y = (half_scaled_height - deltaX * sin_angle + deltaY * cos_angle) * inverse_y_scale;
+
+            // Step over to the first column instead of starting there so the
+            // same pixels are filled no matter where the clip starts
+            for(int32_t i=i_origin; i<i_start; i++){
+                x += cos_angle_inv_scaled;
+                y -= sin_angle_inv_scaled;
+            }
 
-        // Calculate the location of the SRC pixel. If the destination
-        // gets scaled larger then we need to inversely scale into the
-        // src, and vice versa
-        float x = (half_scaled_width + deltaX * cos_angle + deltaY * sin_angle) * inverse_x_scale;
-        float y = (half_scaled_height - deltaX * sin_angle + deltaY * cos_angle) * inverse_y_scale;
-
-        for(i=i_start; i<dim; i++){
-            // Check if drawing to draw out of bounds to the right,
-            // if so, stop drawing the destination row early and
-            // move on to the next
-            if(top_left_x+i < SCREEN_WIDTH){
-                // Uncomment to see background. Drawing
-                // sprites that are thin could be optimized
-                // screen_buffer[dest_offset] = 0b11111000000000;
+            // Used for tracking where we are in the screen_buffer
+            uint32_t dest_offset = (top_left_y+j) * engine_display_target_width + (top_left_x+i_start);
 
+            for(int32_t i=i_start; i<i_end; i++){
                 // Floor these otherwise get artifacts (don't exactly know why).
                 // Floor + int seems to be faster than comparing floats
                 int32_t rotX = (int32_t)floorf(x);
@@ -506,18 +1297,8 @@ void engine_draw_rect(uint16_t color, float center_x, float center_y, int32_t wi
 
                 // Go to next pixel next time to set it
                 dest_offset += 1;
-            }else{
-                // After this will be a subtraction by 'dim'
-                // but we need to be at the end of the row
-                // for that to work, set 'dest_offset' to end
-                // See 'next_dest_row_offset'
-                dest_offset += dim-i;
-                break;
             }
         }
-
-        // Go to next row but at the left of it (SCREEN_WIDTH - dim)
-        dest_offset += next_dest_row_offset;
     }
 
     // ENGINE_PERFORMANCE_CYCLES_STOP();
@@ -525,52 +1306,97 @@ void engine_draw_rect(uint16_t color, float center_x, float center_y, int32_t wi
 
 
 void engine_draw_outline_circle(uint16_t color, float center_x, float center_y, float radius, float alpha, engine_shader_t *shader){
-    // https://stackoverflow.com/a/58629898
-    float distance = radius;
-    float angle_increment = acosf(1 - 1/distance) * 2.0f;   // Multiply by 2.0 since care about speed and not accuracy as much
+    if(engine_display_damage_is_recording()){
+        float args[] = {DAMAGE_KIND_OUTLINE_CIRCLE, color, center_x, center_y, radius, alpha};
+        engine_display_damage_record((int32_t)floorf(center_x-radius)-1, (int32_t)floorf(center_y-radius)-1,
+                                     (int32_t)ceilf(center_x+radius)+2, (int32_t)ceilf(center_y+radius)+2,
+                                     engine_draw_damage_signature(args, 6, shader));
+        return;
+    }
 
-    for(float angle = 0; angle <= 90; angle += angle_increment){
-        float cx = distance * cosf(angle);
-        float cy = distance * sinf(angle);
-        
-        // Bottom right quadrant of the circle
-        int brx = (int)(center_x+cx);
-        int bry = (int)(center_y+cy);
+    if(engine_draw_clip_overlaps((int32_t)floorf(center_x-radius)-1, (int32_t)floorf(center_y-radius)-1,
+                                 (int32_t)ceilf(center_x+radius)+2, (int32_t)ceilf(center_y+radius)+2) == false){
+        return;
+    }
 
-        // Bottom left quadrant of the circle
-        int blx = (int)(center_x-cx);
-        int bly = (int)(center_y+cy);
+    int32_t cx = (int32_t)floorf(center_x);
+    int32_t cy = (int32_t)floorf(center_y);
 
-        // Top right quadrant of the circle
-        int trx = (int)(center_x+cx);
-        int try = (int)(center_y-cy);
+    // https://en.wikipedia.org/wiki/Midpoint_circle_algorithm
+    int32_t x = (int32_t)radius;
+    int32_t y = 0;
+    int32_t error = 1 - x;
 
-        // Top left quadrant of the circle
-        int tlx = (int)(center_x-cx);
-        int tly = (int)(center_y-cy);
+    while(x >= y){
+        // Each pixel of the octant is mirrored into the other seven,
+        // on the axes and diagonals some of those are the same pixel
+        engine_draw_plot(color, cx + x, cy + y, alpha, shader);
+        engine_draw_plot(color, cx - x, cy - y, alpha, shader);
 
-        engine_draw_pixel(color, brx, bry, alpha, shader);
-        engine_draw_pixel(color, blx, bly, alpha, shader);
-        engine_draw_pixel(color, trx, try, alpha, shader);
-        engine_draw_pixel(color, tlx, tly, alpha, shader);
+        if(y != 0){
+            engine_draw_plot(color, cx - x, cy + y, alpha, shader);
+            engine_draw_plot(color, cx + x, cy - y, alpha, shader);
+        }
+
+        if(x != y){
+            engine_draw_plot(color, cx + y, cy + x, alpha, shader);
+            engine_draw_plot(color, cx - y, cy - x, alpha, shader);
+
+            if(y != 0){
+                engine_draw_plot(color, cx - y, cy + x, alpha, shader);
+                engine_draw_plot(color, cx + y, cy - x, alpha, shader);
+            }
+        }
+
+        y++;
+
+        if(error < 0){
+            error += 2 * y + 1;
+        }else{
+            x--;
+            error += 2 * (y - x) + 1;
+        }
     }
 }
 
 
 void engine_draw_filled_circle(uint16_t color, float center_x, float center_y, float radius, float alpha, engine_shader_t *shader){
-    float radius_sqr = radius * radius;
-    int x_min = (int)(-radius);
-    int x_max = (int)radius;
+    if(engine_display_damage_is_recording()){
+        float args[] = {DAMAGE_KIND_FILLED_CIRCLE, color, center_x, center_y, radius, alpha};
+        engine_display_damage_record((int32_t)floorf(center_x-radius)-1, (int32_t)floorf(center_y-radius)-1,
+                                     (int32_t)ceilf(center_x+radius)+2, (int32_t)ceilf(center_y+radius)+2,
+                                     engine_draw_damage_signature(args, 6, shader));
+        return;
+    }
 
-    // https://stackoverflow.com/a/59211338
-    for(int x=x_min; x<x_max; x++){
-        int hh = (int)sqrt(radius_sqr - x * x);
-        int rx = (int)center_x + x;
-        int ph = (int)center_y + hh;
+    if(engine_draw_clip_overlaps((int32_t)floorf(center_x-radius)-1, (int32_t)floorf(center_y-radius)-1,
+                                 (int32_t)ceilf(center_x+radius)+2, (int32_t)ceilf(center_y+radius)+2) == false){
+        return;
+    }
 
-        for(int y=(int)center_y-hh; y<ph; y++){
-            engine_draw_pixel(color, rx, y, alpha, shader);
+    // Covers the pixels at offsets -R ~ R-1 from the center where the
+    // column's half height `floor(sqrt(radius^2 - x^2))` reaches the row
+    // (https://stackoverflow.com/a/59211338) but drawn as rows
+    int32_t cx = (int32_t)center_x;
+    int32_t cy = (int32_t)center_y;
+    int32_t r = (int32_t)radius;
+    int32_t radius_sqr = (int32_t)floorf(radius * radius);
+
+    // Half width of the rows `reach` away from the center, shrunk as
+    // rows go outwards instead of taking a square root per row
+    int32_t half_width = r;
+
+    for(int32_t reach=1; reach*reach<=radius_sqr; reach++){
+        while(half_width*half_width + reach*reach > radius_sqr){
+            half_width--;
         }
+
+        int32_t x0 = cx + MAX(-half_width, -r);
+        int32_t x1 = cx + MIN(half_width, r - 1) + 1;
+
+        // Rows below and above the center that are `reach` away
+        engine_draw_span(color, x0, x1, cy + reach - 1, alpha, shader);
+        engine_draw_span(color, x0, x1, cy - reach, alpha, shader);
     }
 }
 
@@ -582,6 +1408,16 @@ void engine_draw_text(font_resource_class_obj_t *font, mp_obj_t text, float cent
     float sin_angle_perp = sinf(rotation_radians + HALF_PI);
     float cos_angle_perp = cosf(rotation_radians + HALF_PI);
 
+    // Skip all the glyphs if the text box can't be seen at any
+    // rotation. Pad by a glyph for letter spacing and rounding
+    float text_box_radius = 0.5f * sqrtf((text_box_width*x_scale)*(text_box_width*x_scale) + (text_box_height*y_scale)*(text_box_height*y_scale));
+    text_box_radius += font->glyph_height * fmaxf(fabsf(x_scale), fabsf(y_scale));
+
+    if(engine_draw_clip_overlaps((int32_t)floorf(center_x-text_box_radius), (int32_t)floorf(center_y-text_box_radius),
+                                 (int32_t)ceilf(center_x+text_box_radius)+1, (int32_t)ceilf(center_y+text_box_radius)+1) == false){
+        return;
+    }
+
     // Since sprites are centered by default and the text box height includes the
     // height of the first line, get rid of one line's worth of height to center
     // it correctly
@@ -678,44 +1514,58 @@ void engine_draw_filled_triangle(uint16_t color, float x0, float y0, float x1, f
     int16_t maxX = (int16_t)max3(x0, x1, x2);
     int16_t maxY = (int16_t)max3(y0, y1, y2);
 
-    // Clip against screen bounds
-    minX = max(minX, 0);
-    minY = max(minY, 0);
-    maxX = min(maxX, SCREEN_WIDTH_MINUS_1);
-    maxY = min(maxY, SCREEN_HEIGHT_MINUS_1);
-
-    int16_t px = minX;
-    int16_t py = minY;
-
-    int16_t w0_row = (int16_t)orient2d(x1, y1, x2, y2, px, py);
-    int16_t w1_row = (int16_t)orient2d(x2, y2, x0, y0, px, py);
-    int16_t w2_row = (int16_t)orient2d(x0, y0, x1, y1, px, py);
-
-    // Rasterize
-    for(py = minY; py <= maxY; py++){
-        // Barycentric coordinates at start of row
-        int16_t w0 = w0_row;
-        int16_t w1 = w1_row;
-        int16_t w2 = w2_row;
-
-        for(px = minX; px <= maxX; px++){
-            // If p is on or inside all edges, render pixel.
-            // https://fgiesen.wordpress.com/2013/02/10/optimizing-the-basic-rasterizer/#:~:text=if%20((w0%20%7C%20w1%20%7C%20w2)%20%3E%3D%200)
-            if ((w0 | w1 | w2) >= 0){
-                // if(engine_display_store_check_depth(px, py, depth)){
-                    engine_draw_pixel_no_check(color, px, py, alpha, shader);
-                // }
+    if(engine_display_damage_is_recording()){
+        float args[] = {DAMAGE_KIND_TRIANGLE, color, x0, y0, x1, y1, x2, y2, alpha};
+        engine_display_damage_record(minX, minY, maxX+1, maxY+1, engine_draw_damage_signature(args, 9, shader));
+        return;
+    }
+
+    if(engine_draw_clip_overlaps(minX, minY, maxX+1, maxY+1) == false){
+        return;
+    }
+
+    for(uint8_t index=0; index<engine_draw_clip_rect_count; index++){
+        engine_display_rect_t *clip = &engine_draw_clip_rects[index];
+
+        // Clip against the clip area (just the screen usually)
+        int16_t clip_min_x = max(minX, clip->x0);
+        int16_t clip_min_y = max(minY, clip->y0);
+        int16_t clip_max_x = min(maxX, clip->x1-1);
+        int16_t clip_max_y = min(maxY, clip->y1-1);
+
+        int16_t px = clip_min_x;
+        int16_t py = clip_min_y;
+
+        int16_t w0_row = (int16_t)orient2d(x1, y1, x2, y2, px, py);
+        int16_t w1_row = (int16_t)orient2d(x2, y2, x0, y0, px, py);
+        int16_t w2_row = (int16_t)orient2d(x0, y0, x1, y1, px, py);
+
+        // Rasterize
+        for(py = clip_min_y; py <= clip_max_y; py++){
+            // Barycentric coordinates at start of row
+            int16_t w0 = w0_row;
+            int16_t w1 = w1_row;
+            int16_t w2 = w2_row;
+
+            for(px = clip_min_x; px <= clip_max_x; px++){
+                // If p is on or inside all edges, render pixel.
+                // https://fgiesen.wordpress.com/2013/02/10/optimizing-the-basic-rasterizer/#:~:text=if%20((w0%20%7C%20w1%20%7C%20w2)%20%3E%3D%200)
+                if ((w0 | w1 | w2) >= 0){
+                    // if(engine_display_store_check_depth(px, py, depth)){
+                        engine_draw_pixel_no_check(color, px, py, alpha, shader);
+                    // }
+                }
+
+                // One step to the right
+                w0 += A12;
+                w1 += A20;
+                w2 += A01;
             }
 
-            // One step to the right
-            w0 += A12;
-            w1 += A20;
-            w2 += A01;
+            // One row step
+            w0_row += B12;
+            w1_row += B20;
+            w2_row += B01;
         }
-
-        // One row step
-        w0_row += B12;
-        w1_row += B20;
-        w2_row += B01;
     }
 }
\ No newline at end of file
@@ -7,10 +7,47 @@
 #include "resources/engine_font_resource.h"
 #include "utility/engine_defines.h"
 #include "draw/engine_shader.h"
+#include "display/engine_display_common.h"
 
 // Color that is passed to draw function indicating that no transparency is needed
 #define ENGINE_NO_TRANSPARENCY_COLOR 0b0000100000100001
 
+// Most areas that drawing can be clipped to at once
+#define ENGINE_DRAW_MAX_CLIP_RECTS 8
+
+
+// Only draw inside these (non-overlapping) areas of the screen
+// until `engine_draw_reset_clip_rects` is called. The areas are copied
+void engine_draw_set_clip_rects(const engine_display_rect_t *rects, uint8_t count);
+
+// Go back to drawing anywhere on the screen
+void engine_draw_reset_clip_rects();
+
+// Also limit drawing to this area of the screen (the viewport of the
+// camera being drawn for) until `engine_draw_reset_scissor` is called.
+// The clip areas are cut down to it, their order/count is kept otherwise
+void engine_draw_set_scissor(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+// Stop limiting drawing to the scissor area
+void engine_draw_reset_scissor();
+
+// Clip areas and scissor as they were set, see `engine_draw_save_clip`
+typedef struct{
+    engine_display_rect_t rects[ENGINE_DRAW_MAX_CLIP_RECTS];
+    uint8_t count;
+    engine_display_rect_t scissor;
+}engine_draw_clip_state_t;
+
+// Copies out the clip areas and scissor so that they can be put
+// back with `engine_draw_restore_clip` after drawing elsewhere
+void engine_draw_save_clip(engine_draw_clip_state_t *state);
+void engine_draw_restore_clip(const engine_draw_clip_state_t *state);
+
+// Returns true if any part of the area (`x1` and `y1`
+// not included) could be drawn to with the current
+// clip areas and scissor. Used to skip drawing early
+bool engine_draw_clip_overlaps(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+
 
 // Fills entire screen buffer with 'color'
 void ENGINE_FAST_FUNCTION(engine_draw_fill_color)(uint16_t color, uint16_t *screen_buffer);
@@ -18,6 +55,11 @@ void ENGINE_FAST_FUNCTION(engine_draw_fill_color)(uint16_t color, uint16_t *scre
 // Fills entire screen buffer with 'src_buffer'
 void ENGINE_FAST_FUNCTION(engine_draw_fill_buffer)(uint16_t* src_buffer, uint16_t *screen_buffer);
 
+// Copies a `width` by `height` block of `pixels` with its top-left at
+// `x`/`y`, pixels that are `key_color` are left out. Clipped like the
+// other primitives but not recorded for damage tracking
+void engine_draw_copy_keyed(const uint16_t *pixels, int32_t x, int32_t y, int32_t width, int32_t height, uint16_t key_color);
+
 // Sets a single pixel in the screen buffer to 'color'
 void ENGINE_FAST_FUNCTION(engine_draw_pixel)(uint16_t color, int32_t x, int32_t y, float alpha, engine_shader_t *shader);
 
@@ -25,10 +67,20 @@ void ENGINE_FAST_FUNCTION(engine_draw_pixel_no_check)(uint16_t color, int32_t x,
 
 void engine_draw_line(uint16_t color, float x_start, float y_start, float x_end, float y_end, mp_obj_t camera_node_base, float alpha, engine_shader_t *shader);
 
+// Rotated/scaled blits step through the texture with 16.16 fixed-point
+// integers when enabled (default), the float path is kept for comparing
+// against and for transforms too large to fit in 16.16
+void engine_draw_set_blit_fixed_point(bool enabled);
+
 void engine_draw_blit(texture_resource_class_obj_t *texture, uint32_t offset, float center_x, float center_y, int32_t window_width, int32_t window_height, uint32_t pixels_stride, float x_scale, float y_scale, float rotation_radians, uint16_t transparent_color, float alpha, engine_shader_t *shader);
 
 void engine_draw_blit_depth(texture_resource_class_obj_t *texture, uint32_t offset, float center_x, float center_y, int32_t window_width, int32_t window_height, uint32_t pixels_stride, float x_scale, float y_scale, float rotation_radians, uint16_t transparent_color, float alpha, uint16_t depth, engine_shader_t *shader);
 
+// Draws a `width` by `height` block of the texture starting at `offset`
+// unscaled and unrotated with its top-left at `x`/`y`, optionally
+// mirrored. Rows are copied in spans where possible (tile maps)
+void engine_draw_tile(texture_resource_class_obj_t *texture, uint32_t offset, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t pixels_stride, bool flip_x, bool flip_y, uint16_t transparent_color, float alpha, engine_shader_t *shader);
+
 void engine_draw_rect(uint16_t color, float center_x, float center_y, int32_t width, int32_t height, float x_scale, float y_scale, float rotation_radians, float alpha, engine_shader_t *shader);
 
 void engine_draw_outline_circle(uint16_t color, float center_x, float center_y, float radius, float alpha, engine_shader_t *shader);
@@ -1,6 +1,7 @@
 #include "py/obj.h"
 #include "py/runtime.h"
 #include "display/engine_display_common.h"
+#include "display/engine_display_damage.h"
 #include "resources/engine_texture_resource.h"
 #include "resources/engine_resource_manager.h"
 #include "engine_color.h"
@@ -51,6 +52,58 @@ static mp_obj_t engine_draw_set_background(mp_obj_t background){
 MP_DEFINE_CONST_FUN_OBJ_1(engine_draw_set_background_obj, engine_draw_set_background);
 
 
+/*  --- doc ---
+    NAME: set_damage_tracking
+    ID: set_damage_tracking
+    DESC: When enabled, only the parts of the screen that changed since the last frame are redrawn and sent to the display. Each frame, what every node would draw is compared against the last frame to find what changed. Works best when most of the screen stays the same (menus, puzzle games, etc.), 3D nodes always cause the whole screen to be redrawn. Changing pixels of a {ref_link:TextureResource} or drawing to {ref_link:back_fb} directly is not noticed, use {ref_link:damage} for that. Disabled by default
+    PARAM: [type=bool]   [name=enabled]  [value=True or False]
+    RETURN: None
+*/
+static mp_obj_t engine_draw_set_damage_tracking(mp_obj_t enabled){
+    engine_display_damage_set_enabled(mp_obj_is_true(enabled));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(engine_draw_set_damage_tracking_obj, engine_draw_set_damage_tracking);
+
+
+/*  --- doc ---
+    NAME: damage
+    ID: damage
+    DESC: Marks an area of the screen to be redrawn and sent to the display next frame when damage tracking is enabled (see {ref_link:set_damage_tracking}). Call with no parameters to redraw the whole screen
+    PARAM: [type=int]   [name=x]        [value=any (optional, left of the area in pixels)]
+    PARAM: [type=int]   [name=y]        [value=any (optional, top of the area in pixels)]
+    PARAM: [type=int]   [name=width]    [value=any (optional)]
+    PARAM: [type=int]   [name=height]   [value=any (optional)]
+    RETURN: None
+*/
+static mp_obj_t engine_draw_damage(size_t n_args, const mp_obj_t *args){
+    if(n_args == 0){
+        engine_display_damage_add(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+    }else if(n_args == 4){
+        int32_t x = mp_obj_get_int(args[0]);
+        int32_t y = mp_obj_get_int(args[1]);
+        engine_display_damage_add(x, y, x + mp_obj_get_int(args[2]), y + mp_obj_get_int(args[3]));
+    }else{
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("EngineDraw: ERROR: Expected 0 or 4 arguments for `damage`"));
+    }
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(engine_draw_damage_obj, 0, 4, engine_draw_damage);
+
+
+/*  --- doc ---
+    NAME: get_damaged_pixels
+    ID: get_damaged_pixels
+    DESC: Gets how many pixels were sent to the display last frame when damage tracking is enabled (see {ref_link:set_damage_tracking}). Useful for seeing how much of the screen is changing each frame
+    RETURN: int
+*/
+static mp_obj_t engine_draw_get_damaged_pixels(){
+    return mp_obj_new_int(engine_display_damage_get_sent_pixel_count());
+}
+MP_DEFINE_CONST_FUN_OBJ_0(engine_draw_get_damaged_pixels_obj, engine_draw_get_damaged_pixels);
+
+
 static mp_obj_t engine_draw_module_init(){
     engine_main_raise_if_not_initialized();
     return mp_const_none;
@@ -170,6 +223,9 @@ static const mp_rom_map_elem_t engine_draw_globals_table[] = {
     { MP_OBJ_NEW_QSTR(MP_QSTR___init__), MP_ROM_PTR(&engine_draw_module_init_obj) },
     { MP_OBJ_NEW_QSTR(MP_QSTR_set_background_color), MP_ROM_PTR(&engine_draw_set_background_color_obj) },
     { MP_OBJ_NEW_QSTR(MP_QSTR_set_background), MP_ROM_PTR(&engine_draw_set_background_obj) },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_set_damage_tracking), MP_ROM_PTR(&engine_draw_set_damage_tracking_obj) },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_damage), MP_ROM_PTR(&engine_draw_damage_obj) },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_get_damaged_pixels), MP_ROM_PTR(&engine_draw_get_damaged_pixels_obj) },
     { MP_OBJ_NEW_QSTR(MP_QSTR_Color), MP_ROM_PTR(&color_class_type) },
     { MP_OBJ_NEW_QSTR(MP_QSTR_black), MP_ROM_PTR(&black) },
     { MP_OBJ_NEW_QSTR(MP_QSTR_navy), MP_ROM_PTR(&navy) },
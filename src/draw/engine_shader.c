@@ -18,8 +18,33 @@ uint16_t ENGINE_FAST_FUNCTION(engine_pixel_shader_alpha)(uint16_t bg, uint16_t f
 }
 
 
-// Slow function for when a node has a custom shader (TODO: not implemented yet)
-uint16_t ENGINE_FAST_FUNCTION(engine_pixel_shader_custom)(uint16_t bg, uint16_t fg, float opacity, engine_shader_t *shader){
+// Fast function for text and other nodes that are colored in and then blended by opacity
+uint16_t ENGINE_FAST_FUNCTION(engine_pixel_shader_interpolate_alpha)(uint16_t bg, uint16_t fg, float opacity, engine_shader_t *shader){
+    fg = engine_color_blend_12bit(fg, shader->ops[0].color, shader->ops[0].amount);
+    return engine_color_alpha_blend(bg, fg, opacity);
+}
+
+
+// Function for any other combination of ops, runs the decoded ops in order
+uint16_t ENGINE_FAST_FUNCTION(engine_pixel_shader_ops)(uint16_t bg, uint16_t fg, float opacity, engine_shader_t *shader){
+    for(uint8_t index=0; index<shader->op_count; index++){
+        engine_shader_op_t *op = &shader->ops[index];
+
+        switch(op->code){
+            case SHADER_OPACITY_BLEND:
+                fg = engine_color_alpha_blend(bg, fg, opacity);
+            break;
+            case SHADER_RGB_INTERPOLATE:
+                fg = engine_color_blend_12bit(fg, op->color, op->amount);
+            break;
+        }
+    }
+
+    return fg;
+}
+
+
+uint16_t ENGINE_FAST_FUNCTION(engine_pixel_shader_interpret)(uint16_t bg, uint16_t fg, float opacity, engine_shader_t *shader){
     uint8_t index = 0;
 
     while(index < shader->program_len){
@@ -38,9 +63,9 @@ uint16_t ENGINE_FAST_FUNCTION(engine_pixel_shader_custom)(uint16_t bg, uint16_t
                 float t = 0;
                 memcpy(&t, shader->program+index+3, sizeof(float));
 
-                fg = engine_color_blend(fg, interpolate_to_color, t);
+                fg = engine_color_blend_12bit(fg, interpolate_to_color, engine_color_amount_to_12bit(t));
 
-                index += 6; // OPPFFFF
+                index += 7; // OPPFFFF
                 continue;
             }
             break;
@@ -57,22 +82,19 @@ uint16_t ENGINE_FAST_FUNCTION(engine_pixel_shader_custom)(uint16_t bg, uint16_t
 engine_shader_t empty_shader = {
     .program = {},
     .program_len = 0,
-    .execute = engine_pixel_shader_empty,
 };
 
 
 // Fast shader that can be passed from node draw callback to drawing functions to quickly paste pixels to buffer with opacity blending
 engine_shader_t opacity_shader = {
-    .program = {},
-    .program_len = 0,
-    .execute = engine_pixel_shader_alpha,
+    .program = {SHADER_OPACITY_BLEND},
+    .program_len = 1,
 };
 
 
 engine_shader_t blend_opacity_shader = {
     .program = {SHADER_RGB_INTERPOLATE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, SHADER_OPACITY_BLEND},
     .program_len = 8,
-    .execute = engine_pixel_shader_custom,
 };
 
 engine_shader_t *builtin_shaders[3] = {
@@ -83,4 +105,91 @@ engine_shader_t *builtin_shaders[3] = {
 
 engine_shader_t *engine_get_builtin_shader(enum engine_builtin_shader_types type){
     return builtin_shaders[type];
+}
+
+
+void engine_shader_init(){
+    for(uint8_t index=0; index<3; index++){
+        engine_shader_compile(builtin_shaders[index]);
+    }
+}
+
+
+void engine_shader_compile(engine_shader_t *shader){
+    uint8_t index = 0;
+    shader->op_count = 0;
+
+    while(index < shader->program_len){
+        if(shader->op_count == ENGINE_SHADER_MAX_OPS){
+            ENGINE_WARNING_PRINTF("EngineShader: Program has more than %d ops, the rest are ignored", ENGINE_SHADER_MAX_OPS);
+            break;
+        }
+
+        engine_shader_op_t *op = &shader->ops[shader->op_count];
+        op->code = shader->program[index];
+
+        switch(op->code){
+            case SHADER_OPACITY_BLEND:
+            {
+                index++;
+            }
+            break;
+            case SHADER_RGB_INTERPOLATE:
+            {
+                op->color = (shader->program[index+1] << 8) | shader->program[index+2];
+
+                float t = 0;
+                memcpy(&t, shader->program+index+3, sizeof(float));
+                op->amount = engine_color_amount_to_12bit(t);
+
+                index += 7; // OPPFFFF
+            }
+            break;
+            default:
+            {
+                // Unknown op, skip it like the interpreter does
+                index++;
+                continue;
+            }
+        }
+
+        shader->op_count++;
+    }
+
+    // Known combinations get their own function
+    if(shader->op_count == 0){
+        shader->execute = engine_pixel_shader_empty;
+    }else if(shader->op_count == 1 && shader->ops[0].code == SHADER_OPACITY_BLEND){
+        shader->execute = engine_pixel_shader_alpha;
+    }else if(shader->op_count == 2 && shader->ops[0].code == SHADER_RGB_INTERPOLATE && shader->ops[1].code == SHADER_OPACITY_BLEND){
+        shader->execute = engine_pixel_shader_interpolate_alpha;
+    }else{
+        shader->execute = engine_pixel_shader_ops;
+    }
+}
+
+
+void engine_shader_set_interpolate(engine_shader_t *shader, uint16_t color, float amount){
+    uint8_t index = 0;
+
+    while(index < shader->program_len && shader->program[index] != SHADER_RGB_INTERPOLATE){
+        index++;   // Only SHADER_RGB_INTERPOLATE has operands
+    }
+
+    if(index >= shader->program_len){
+        return;
+    }
+
+    // Kept in `program` too since that's what damage tracking compares
+    shader->program[index+1] = (color >> 8) & 0b11111111;
+    shader->program[index+2] = (color >> 0) & 0b11111111;
+    memcpy(shader->program+index+3, &amount, sizeof(float));
+
+    for(uint8_t op_index=0; op_index<shader->op_count; op_index++){
+        if(shader->ops[op_index].code == SHADER_RGB_INTERPOLATE){
+            shader->ops[op_index].color = color;
+            shader->ops[op_index].amount = engine_color_amount_to_12bit(amount);
+            return;
+        }
+    }
 }
\ No newline at end of file
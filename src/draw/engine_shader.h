@@ -15,14 +15,42 @@ enum engine_builtin_shader_types{
     BLEND_OPACITY_SHADER=2
 };
 
+// Most ops a shader program can be compiled to
+#define ENGINE_SHADER_MAX_OPS 8
+
+// An op of `program` with its operands already decoded
+typedef struct{
+    uint8_t code;                                                                                    // One of `engine_shader_op_codes`
+    uint16_t color;                                                                                  // SHADER_RGB_INTERPOLATE: color to interpolate to
+    uint32_t amount;                                                                                 // SHADER_RGB_INTERPOLATE: 0 ~ 4096 (see `engine_color_blend_12bit`)
+}engine_shader_op_t;
+
 typedef struct engine_shader_t{
     uint8_t program[UINT8_MAX];                                                                      // Shader program consisting of op codes from `engine_shader_op_codes` (256 max codes allowed)
     uint8_t program_len;                                                                             // Length of `program` in bytes
     uint16_t (*execute)(uint16_t bg, uint16_t fg, float opacity, struct engine_shader_t *shader);    // Function to execute the bytes/op codes in `program` (sometimes switched out for speed if some effects are not used)
+    engine_shader_op_t ops[ENGINE_SHADER_MAX_OPS];                                                   // `program` compiled by `engine_shader_compile`
+    uint8_t op_count;
 }engine_shader_t;
 
 
 engine_shader_t *engine_get_builtin_shader(enum engine_builtin_shader_types type);
 
+// Compiles the builtin shaders, call once before drawing anything
+void engine_shader_init();
+
+// Decodes `program` into `ops` and picks the `execute` function for
+// them: a hand-written one for known combinations of ops, otherwise
+// one that runs the decoded ops. Call after changing `program`
+void engine_shader_compile(engine_shader_t *shader);
+
+// Sets the color and amount of the first SHADER_RGB_INTERPOLATE op
+// in `shader` (in `program` and `ops`, no need to compile again)
+void engine_shader_set_interpolate(engine_shader_t *shader, uint16_t color, float amount);
+
+// Runs `program` by decoding it for each pixel. Slower than what
+// `engine_shader_compile` picks, kept for comparing against
+uint16_t ENGINE_FAST_FUNCTION(engine_pixel_shader_interpret)(uint16_t bg, uint16_t fg, float opacity, engine_shader_t *shader);
+
 
 #endif  // ENGINE_SHADER_H
\ No newline at end of file
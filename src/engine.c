@@ -4,6 +4,8 @@
 #include "engine_object_layers.h"
 #include "display/engine_display.h"
 #include "display/engine_display_common.h"
+#include "display/engine_display_damage.h"
+#include "debug/engine_debug_profiler.h"
 #include "io/engine_io_module.h"
 #include "physics/engine_physics.h"
 #include "resources/engine_resource_manager.h"
@@ -226,8 +228,11 @@ MP_DEFINE_CONST_FUN_OBJ_0(engine_time_to_next_tick_obj, engine_mp_time_to_next_t
 
 
 bool engine_tick(){
+    engine_debug_profiler_start();
+
     // Run this as often as possible
     engine_link_module_task();
+    engine_debug_profiler_mark(ENGINE_DEBUG_PROFILER_PHASE_LINK);
 
     bool ticked = false;
 
@@ -246,6 +251,7 @@ bool engine_tick(){
     // Now that all the node callbacks were called and potentially moved
     // physics nodes around, step the physics engine another tick.
     engine_physics_tick();
+    engine_debug_profiler_mark(ENGINE_DEBUG_PROFILER_PHASE_PHYSICS);
 
     if(fps_limit_disabled || dt_ms >= engine_fps_limit_period_ms){
         engine_fps_time_at_before_last_tick_ms = engine_fps_time_at_last_tick_ms;
@@ -256,28 +262,55 @@ bool engine_tick(){
 
         // Update/grab which buttons are pressed before calling all node callbacks
         engine_io_tick();
+        engine_debug_profiler_mark(ENGINE_DEBUG_PROFILER_PHASE_IO);
 
         // Goes through all animation components.
         // Do this first in case a camera is being
         // tweened or anything like that
         engine_animation_tick(dt_ms);
+        engine_debug_profiler_mark(ENGINE_DEBUG_PROFILER_PHASE_ANIMATION);
 
         // Call every instanced node's callbacks
-        engine_invoke_all_node_tick_callbacks(dt_ms * 0.001f);
+        engine_invoke_all_node_tick_callbacks(dt_ms);
+        engine_debug_profiler_mark(ENGINE_DEBUG_PROFILER_PHASE_TICK);
+
         engine_objects_clear_deletable();                       // Remove any nodes marked for deletion before rendering
-        engine_invoke_all_node_draw_callbacks();
+        engine_debug_profiler_mark(ENGINE_DEBUG_PROFILER_PHASE_DELETE);
+
+        // Cameras drawing into textures go first so that
+        // the screen can show what they drew this frame
+        engine_invoke_all_camera_render_targets();
+
+        if(engine_display_damage_is_enabled()){
+            // Find out what changed since last frame and
+            // only redraw those parts (if anything)
+            engine_display_damage_start_recording();
+            engine_invoke_all_node_draw_callbacks();
+
+            if(engine_display_damage_stop_recording()){
+                engine_invoke_all_node_draw_callbacks();
+                engine_display_damage_finish_drawing();
+            }
+        }else{
+            engine_invoke_all_node_draw_callbacks();
+        }
+        engine_debug_profiler_mark(ENGINE_DEBUG_PROFILER_PHASE_DRAW);
 
         engine_gui_tick();
+        engine_debug_profiler_mark(ENGINE_DEBUG_PROFILER_PHASE_GUI);
 
         // After every game cycle send the current active screen buffer to the display
         engine_display_send();
 
         // Clear the depth buffer, if needed
         engine_display_clear_depth_buffer();
+        engine_debug_profiler_mark(ENGINE_DEBUG_PROFILER_PHASE_DISPLAY);
 
         ticked = true;
     }
 
+    engine_debug_profiler_end(ticked);
+
     // Not sure why this is needed exactly for handling ctrl-c
     // correctly, just replicating what happens in modutime.c
     MP_THREAD_GIL_ENTER();
@@ -11,20 +11,22 @@
     loop through certain objects quickly. For example,
     it would be a waste of time to loop through all nodes every
     time a node needs a camera to render itself, it's because of
-    this that duplicate references are kept in shorter lists
+    this that duplicate references are kept in shorter lists.
+    Nodes are linked through 'collection_link' (camera, physics
+    and gui) and 'deletable_link' in 'engine_node_base_t'
 */
 
-linked_list_node *engine_collections_track_camera(engine_node_base_t *camera_node_base);
-void engine_collections_untrack_camera(linked_list_node *camera_list_node);
+void engine_collections_track_camera(engine_node_base_t *camera_node_base);
+void engine_collections_untrack_camera(engine_node_base_t *camera_node_base);
 
-linked_list_node *engine_collections_track_physics(engine_node_base_t *physics_node_base);
-void engine_collections_untrack_physics(linked_list_node *physics_list_node);
+void engine_collections_track_physics(engine_node_base_t *physics_node_base);
+void engine_collections_untrack_physics(engine_node_base_t *physics_node_base);
 
-linked_list_node *engine_collections_track_gui(engine_node_base_t *gui_node_base);
-void engine_collections_untrack_gui(linked_list_node *gui_list_node);
+void engine_collections_track_gui(engine_node_base_t *gui_node_base);
+void engine_collections_untrack_gui(engine_node_base_t *gui_node_base);
 
-linked_list_node *engine_collections_track_deletable(engine_node_base_t *node_base);
-void engine_collections_untrack_deletable(linked_list_node *node_base_node);
+void engine_collections_track_deletable(engine_node_base_t *node_base);
+void engine_collections_untrack_deletable(engine_node_base_t *node_base);
 
 linked_list *engine_collections_get_camera_list();
 linked_list *engine_collections_get_physics_list();
@@ -15,7 +15,12 @@
 #include "time/engine_rtc.h"
 #include "display/engine_display.h"
 #include "display/engine_display_common.h"
+#include "display/engine_display_damage.h"
+#include "debug/engine_debug_profiler.h"
+#include "draw/engine_display_draw.h"
+#include "draw/engine_shader.h"
 #include "physics/engine_physics.h"
+#include "physics/engine_physics_broadphase.h"
 #include "animation/engine_animation_module.h"
 #include "engine_gui.h"
 #include "fault/engine_fault.h"
@@ -55,6 +60,10 @@ void engine_main_reset(){
 
     // Always reset screen background fills
     engine_display_reset_fills();
+    engine_display_reset_target();
+    engine_display_damage_reset();
+    engine_debug_profiler_reset();
+    engine_draw_set_blit_fixed_point(true);
     
     engine_link_module_reset();
 
@@ -62,6 +71,7 @@ void engine_main_reset(){
     engine_audio_stop_all();
     engine_resource_reset();
     engine_gui_reset();
+    engine_physics_broadphase_reset();
 
     engine_objects_clear_all();
 
@@ -127,6 +137,7 @@ static mp_obj_t engine_main_module_init(){
     engine_audio_setup_playback();
 
     engine_io_setup();
+    engine_shader_init();
     engine_physics_init();
     engine_animation_init();
     engine_rtc_init();
@@ -13,14 +13,54 @@
 #include "nodes/2D/gui_bitmap_button_2d_node.h"
 #include "nodes/2D/physics_rectangle_2d_node.h"
 #include "nodes/2D/physics_circle_2d_node.h"
+#include "nodes/2D/tile_map_2d_node.h"
 #include "nodes/node_types.h"
 #include "nodes/node_base.h"
+#include "nodes/node_bitmap_cache.h"
 #include "engine_collections.h"
+#include "utility/engine_mp.h"
 
 #include "py/gc.h"
 
-uint16_t engine_object_layer_count = 128;
-linked_list engine_object_layers[128];
+uint16_t engine_object_layer_count = ENGINE_OBJECT_LAYER_COUNT;
+linked_list engine_object_layers[ENGINE_OBJECT_LAYER_COUNT];
+
+// Only the nodes in each layer that have something to do in the tick loop
+linked_list engine_object_tick_layers[ENGINE_OBJECT_LAYER_COUNT];
+
+// One bit per layer, set while the layer's list in 'engine_object_layers'
+// or 'engine_object_tick_layers' isn't empty. Games only tend to use a
+// few layers, these let the draw and tick loops go straight to them
+uint32_t engine_object_layers_occupied[ENGINE_OBJECT_LAYER_COUNT/32];
+uint32_t engine_object_tick_layers_occupied[ENGINE_OBJECT_LAYER_COUNT/32];
+
+
+// Returns the first layer index at or after 'layer_index' that has its
+// bit set in 'occupied' or ENGINE_OBJECT_LAYER_COUNT if there isn't one.
+// Looked up each step so layers filled by callbacks are still visited
+static uint16_t engine_object_layers_next_occupied(uint32_t *occupied, uint16_t layer_index){
+    while(layer_index < ENGINE_OBJECT_LAYER_COUNT){
+        uint16_t word_start = layer_index & ~31;
+        uint32_t bits = occupied[layer_index >> 5] & (0xffffffff << (layer_index & 31));
+
+        if(bits != 0){
+            return word_start + __builtin_ctz(bits);
+        }
+
+        layer_index = word_start + 32;
+    }
+
+    return ENGINE_OBJECT_LAYER_COUNT;
+}
+
+
+static void engine_object_layers_update_occupied(uint32_t *occupied, linked_list *layers, uint8_t layer_index){
+    if(layers[layer_index].start != NULL){
+        BIT_SET_TRUE(occupied[layer_index >> 5], (layer_index & 31));
+    }else{
+        BIT_SET_FALSE(occupied[layer_index >> 5], (layer_index & 31));
+    }
+}
 
 
 void engine_objects_clear_all(){
@@ -55,7 +95,7 @@ void engine_objects_clear_deletable(){
 
 uint16_t engine_get_total_object_count(){
     uint16_t count = 0;
-    for(uint8_t ilx=0; ilx<engine_object_layer_count; ilx++){
+    for(uint16_t ilx=engine_object_layers_next_occupied(engine_object_layers_occupied, 0); ilx<ENGINE_OBJECT_LAYER_COUNT; ilx=engine_object_layers_next_occupied(engine_object_layers_occupied, ilx+1)){
         count += engine_object_layers[ilx].count;
     }
 
@@ -63,47 +103,118 @@ uint16_t engine_get_total_object_count(){
 }
 
 
-// Add an object to the pool of all nodes in 'engine_object_layers' at some layer
-linked_list_node *engine_add_object_to_layer(void *obj, uint8_t layer_index){
+// Add a node to the pool of all nodes in 'engine_object_layers' at some layer
+void engine_add_object_to_layer(engine_node_base_t *node_base, uint8_t layer_index){
     if(layer_index >= engine_object_layer_count){
         ENGINE_ERROR_PRINTF("Tried to add object to layer %d but the max layer index is %d. Resize the number of available draw layers at the cost of memory", layer_index, engine_object_layer_count-1);
         mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("Tried to add object to layer index that is out of bounds! Resize the object layer count!"));
     }
 
-    return linked_list_add_obj(&engine_object_layers[layer_index], obj);
+    linked_list_add_node(&engine_object_layers[layer_index], &node_base->layer_link, node_base);
+    engine_object_layers_update_occupied(engine_object_layers_occupied, engine_object_layers, layer_index);
+
+    // Moving to another layer, keep ticking in the new one
+    if(node_base_is_ticking(node_base)){
+        linked_list_add_node(&engine_object_tick_layers[layer_index], &node_base->tick_link, node_base);
+        engine_object_layers_update_occupied(engine_object_tick_layers_occupied, engine_object_tick_layers, layer_index);
+    }
+}
+
+
+void engine_remove_object_from_layer(engine_node_base_t *node_base, uint8_t layer_index){
+    linked_list_remove_node(&engine_object_layers[layer_index], &node_base->layer_link);
+    engine_object_layers_update_occupied(engine_object_layers_occupied, engine_object_layers, layer_index);
+
+    if(node_base_is_ticking(node_base)){
+        linked_list_remove_node(&engine_object_tick_layers[layer_index], &node_base->tick_link);
+        engine_object_layers_update_occupied(engine_object_tick_layers_occupied, engine_object_tick_layers, layer_index);
+    }
+}
+
+
+void engine_set_object_ticking(engine_node_base_t *node_base, bool ticking){
+    if(ticking == node_base_is_ticking(node_base)){
+        return;
+    }
+
+    node_base_set_if_ticking(node_base, ticking);
+
+    if(ticking){
+        linked_list_add_node(&engine_object_tick_layers[node_base->layer], &node_base->tick_link, node_base);
+    }else{
+        linked_list_remove_node(&engine_object_tick_layers[node_base->layer], &node_base->tick_link);
+    }
+
+    engine_object_layers_update_occupied(engine_object_tick_layers_occupied, engine_object_tick_layers, node_base->layer);
 }
 
 
-void engine_remove_object_from_layer(linked_list_node *object_list_node, uint8_t layer_index){
-    linked_list_del_list_node(&engine_object_layers[layer_index], object_list_node);
+// Counts calls to the tick loop, spreads out nodes ticking every N frames
+static uint32_t engine_object_tick_frame = 0;
+
+
+// Whether the node's `tick_policy` lets it tick this frame. Nodes
+// ticking every N frames get all the time since they last ticked
+static bool engine_object_should_tick(engine_node_base_t *node_base, float dt_ms, float *node_dt_ms){
+    *node_dt_ms = dt_ms;
+
+    switch(node_base->tick_policy){
+        case NODE_BASE_TICK_VISIBLE:
+            return node_base_is_on_screen(node_base);
+        case NODE_BASE_TICK_NEAR_CAMERA:
+            return engine_camera_is_near_2d(node_base, node_base->tick_distance);
+        case NODE_BASE_TICK_INTERVAL:
+        {
+            node_base->tick_dt_ms += dt_ms;
+
+            if((engine_object_tick_frame + node_base->tick_phase) % node_base->tick_interval != 0){
+                return false;
+            }
+
+            *node_dt_ms = node_base->tick_dt_ms;
+            node_base->tick_dt_ms = 0.0f;
+            return true;
+        }
+        default:
+            return true;
+    }
 }
 
 
-// Go through all nodes and call their tick callbacks depending on the
-// node type. For example, some nodes will only have a 'tick()'
-// dt_s - delta time in seconds
-void engine_invoke_all_node_tick_callbacks(float dt_s){
+// Go through the nodes that tick and call their tick callbacks depending
+// on the node type. For example, some nodes will only have a 'tick()'
+// dt_ms - delta time in milliseconds, callbacks get it in seconds
+void engine_invoke_all_node_tick_callbacks(float dt_ms){
     linked_list_node *current_linked_list_node = NULL;
 
-    for(uint16_t ilx=0; ilx<engine_object_layer_count; ilx++){
+    // Every callback gets the same `dt` object
+    mp_obj_t dt_obj = engine_mp_float_shared_seconds(dt_ms);
+
+    for(uint16_t ilx=engine_object_layers_next_occupied(engine_object_tick_layers_occupied, 0); ilx<ENGINE_OBJECT_LAYER_COUNT; ilx=engine_object_layers_next_occupied(engine_object_tick_layers_occupied, ilx+1)){
         ENGINE_INFO_PRINTF("Starting ticking nodes in layer %d/%d", ilx, engine_object_layer_count-1);
 
-        current_linked_list_node = engine_object_layers[ilx].start;
+        current_linked_list_node = engine_object_tick_layers[ilx].start;
 
         while(current_linked_list_node != NULL){
-            // Get the base node that every node is stored under
+            // Get the base node that every node is stored under. Move on
+            // now since the tick may take the node out of this layer
             engine_node_base_t *node_base = current_linked_list_node->object;
+            current_linked_list_node = current_linked_list_node->next;
 
             mp_obj_t exec[3];
 
+            float node_dt_ms;
+            bool tick_now = engine_object_should_tick(node_base, dt_ms, &node_dt_ms);
+            mp_obj_t node_dt_obj = (node_dt_ms == dt_ms) ? dt_obj : engine_mp_float_shared_seconds(node_dt_ms);
+
             switch(node_base->type){
                 case NODE_TYPE_EMPTY:
                 {
                     engine_empty_node_class_obj_t *empty_node = node_base->node;
-                    if(empty_node->tick_cb != mp_const_none){
+                    if(empty_node->tick_cb != mp_const_none && tick_now){
                         exec[0] = empty_node->tick_cb;
                         exec[1] = node_base->attr_accessor;
-                        exec[2] = mp_obj_new_float(dt_s);
+                        exec[2] = node_dt_obj;
                         mp_call_method_n_kw(1, 0, exec);
                     }
                 }
@@ -111,10 +222,10 @@ void engine_invoke_all_node_tick_callbacks(float dt_s){
                 case NODE_TYPE_CAMERA:
                 {
                     engine_camera_node_class_obj_t *camera_node = node_base->node;
-                    if(camera_node->tick_cb != mp_const_none){
+                    if(camera_node->tick_cb != mp_const_none && tick_now){
                         exec[0] = camera_node->tick_cb;
                         exec[1] = node_base->attr_accessor;
-                        exec[2] = mp_obj_new_float(dt_s);
+                        exec[2] = node_dt_obj;
                         mp_call_method_n_kw(1, 0, exec);
                     }
                 }
@@ -122,10 +233,10 @@ void engine_invoke_all_node_tick_callbacks(float dt_s){
                 case NODE_TYPE_VOXELSPACE:
                 {
                     engine_voxelspace_node_class_obj_t *voxelspace_node= node_base->node;
-                    if(voxelspace_node->tick_cb != mp_const_none){
+                    if(voxelspace_node->tick_cb != mp_const_none && tick_now){
                         exec[0] = voxelspace_node->tick_cb;
                         exec[1] = node_base->attr_accessor;
-                        exec[2] = mp_obj_new_float(dt_s);
+                        exec[2] = node_dt_obj;
                         mp_call_method_n_kw(1, 0, exec);
                     }
                 }
@@ -133,10 +244,10 @@ void engine_invoke_all_node_tick_callbacks(float dt_s){
                 case NODE_TYPE_VOXELSPACE_SPRITE:
                 {
                     engine_voxelspace_sprite_node_class_obj_t *voxelspace_sprite_node= node_base->node;
-                    if(voxelspace_sprite_node->tick_cb != mp_const_none){
+                    if(voxelspace_sprite_node->tick_cb != mp_const_none && tick_now){
                         exec[0] = voxelspace_sprite_node->tick_cb;
                         exec[1] = node_base->attr_accessor;
-                        exec[2] = mp_obj_new_float(dt_s);
+                        exec[2] = node_dt_obj;
                         mp_call_method_n_kw(1, 0, exec);
                     }
                 }
@@ -144,10 +255,10 @@ void engine_invoke_all_node_tick_callbacks(float dt_s){
                 case NODE_TYPE_MESH_3D:
                 {
                     engine_mesh_node_class_obj_t *mesh_node = node_base->node;
-                    if(mesh_node->tick_cb != mp_const_none){
+                    if(mesh_node->tick_cb != mp_const_none && tick_now){
                         exec[0] = mesh_node->tick_cb;
                         exec[1] = node_base->attr_accessor;
-                        exec[2] = mp_obj_new_float(dt_s);
+                        exec[2] = node_dt_obj;
                         mp_call_method_n_kw(1, 0, exec);
                     }
                 }
@@ -155,10 +266,10 @@ void engine_invoke_all_node_tick_callbacks(float dt_s){
                 case NODE_TYPE_RECTANGLE_2D:
                 {
                     engine_rectangle_2d_node_class_obj_t *rectangle_2d_node = node_base->node;
-                    if(rectangle_2d_node->tick_cb != mp_const_none){
+                    if(rectangle_2d_node->tick_cb != mp_const_none && tick_now){
                         exec[0] = rectangle_2d_node->tick_cb;
                         exec[1] = node_base->attr_accessor;
-                        exec[2] = mp_obj_new_float(dt_s);
+                        exec[2] = node_dt_obj;
                         mp_call_method_n_kw(1, 0, exec);
                     }
                 }
@@ -166,10 +277,10 @@ void engine_invoke_all_node_tick_callbacks(float dt_s){
                 case NODE_TYPE_LINE_2D:
                 {
                     engine_line_2d_node_class_obj_t *line_2d_node = node_base->node;
-                    if(line_2d_node->tick_cb != mp_const_none){
+                    if(line_2d_node->tick_cb != mp_const_none && tick_now){
                         exec[0] = line_2d_node->tick_cb;
                         exec[1] = node_base->attr_accessor;
-                        exec[2] = mp_obj_new_float(dt_s);
+                        exec[2] = node_dt_obj;
                         mp_call_method_n_kw(1, 0, exec);
                     }
                 }
@@ -177,10 +288,10 @@ void engine_invoke_all_node_tick_callbacks(float dt_s){
                 case NODE_TYPE_CIRCLE_2D:
                 {
                     engine_circle_2d_node_class_obj_t *circle_2d_node = node_base->node;
-                    if(circle_2d_node->tick_cb != mp_const_none){
+                    if(circle_2d_node->tick_cb != mp_const_none && tick_now){
                         exec[0] = circle_2d_node->tick_cb;
                         exec[1] = node_base->attr_accessor;
-                        exec[2] = mp_obj_new_float(dt_s);
+                        exec[2] = node_dt_obj;
                         mp_call_method_n_kw(1, 0, exec);
                     }
                 }
@@ -188,10 +299,10 @@ void engine_invoke_all_node_tick_callbacks(float dt_s){
                 case NODE_TYPE_SPRITE_2D:
                 {
                     engine_sprite_2d_node_class_obj_t *sprite_2d_node = node_base->node;
-                    if(sprite_2d_node->tick_cb != mp_const_none){
+                    if(sprite_2d_node->tick_cb != mp_const_none && tick_now){
                         exec[0] = sprite_2d_node->tick_cb;
                         exec[1] = node_base->attr_accessor;
-                        exec[2] = mp_obj_new_float(dt_s);
+                        exec[2] = node_dt_obj;
                         mp_call_method_n_kw(1, 0, exec);
                     }
                 }
@@ -199,10 +310,21 @@ void engine_invoke_all_node_tick_callbacks(float dt_s){
                 case NODE_TYPE_TEXT_2D:
                 {
                     engine_text_2d_node_class_obj_t *text_2d_node = node_base->node;
-                    if(text_2d_node->tick_cb != mp_const_none){
+                    if(text_2d_node->tick_cb != mp_const_none && tick_now){
                         exec[0] = text_2d_node->tick_cb;
                         exec[1] = node_base->attr_accessor;
-                        exec[2] = mp_obj_new_float(dt_s);
+                        exec[2] = node_dt_obj;
+                        mp_call_method_n_kw(1, 0, exec);
+                    }
+                }
+                break;
+                case NODE_TYPE_TILE_MAP_2D:
+                {
+                    engine_tile_map_2d_node_class_obj_t *tile_map_2d_node = node_base->node;
+                    if(tile_map_2d_node->tick_cb != mp_const_none && tick_now){
+                        exec[0] = tile_map_2d_node->tick_cb;
+                        exec[1] = node_base->attr_accessor;
+                        exec[2] = node_dt_obj;
                         mp_call_method_n_kw(1, 0, exec);
                     }
                 }
@@ -212,9 +334,9 @@ void engine_invoke_all_node_tick_callbacks(float dt_s){
                     engine_gui_button_2d_node_class_obj_t *button_2d_node = node_base->node;
                     exec[1] = node_base->attr_accessor;
 
-                    if(button_2d_node->tick_cb != mp_const_none){
+                    if(button_2d_node->tick_cb != mp_const_none && tick_now){
                         exec[0] = button_2d_node->tick_cb;
-                        exec[2] = mp_obj_new_float(dt_s);
+                        exec[2] = node_dt_obj;
                         mp_call_method_n_kw(1, 0, exec);
                     }
 
@@ -265,9 +387,9 @@ void engine_invoke_all_node_tick_callbacks(float dt_s){
                     engine_gui_bitmap_button_2d_node_class_obj_t *bitmap_button_2d_node = node_base->node;
                     exec[1] = node_base->attr_accessor;
 
-                    if(bitmap_button_2d_node->tick_cb != mp_const_none){
+                    if(bitmap_button_2d_node->tick_cb != mp_const_none && tick_now){
                         exec[0] = bitmap_button_2d_node->tick_cb;
-                        exec[2] = mp_obj_new_float(dt_s);
+                        exec[2] = node_dt_obj;
                         mp_call_method_n_kw(1, 0, exec);
                     }
 
@@ -316,10 +438,10 @@ void engine_invoke_all_node_tick_callbacks(float dt_s){
                 case NODE_TYPE_PHYSICS_RECTANGLE_2D:
                 {
                     engine_physics_node_base_t *physics_node_base = node_base->node;
-                    if(physics_node_base->tick_cb != mp_const_none){
+                    if(physics_node_base->tick_cb != mp_const_none && tick_now){
                         exec[0] = physics_node_base->tick_cb;
                         exec[1] = node_base->attr_accessor;
-                        exec[2] = mp_obj_new_float(dt_s);
+                        exec[2] = node_dt_obj;
                         mp_call_method_n_kw(1, 0, exec);
                     }
                 }
@@ -327,10 +449,10 @@ void engine_invoke_all_node_tick_callbacks(float dt_s){
                 case NODE_TYPE_PHYSICS_CIRCLE_2D:
                 {
                     engine_physics_node_base_t *physics_node_base = node_base->node;
-                    if(physics_node_base->tick_cb != mp_const_none){
+                    if(physics_node_base->tick_cb != mp_const_none && tick_now){
                         exec[0] = physics_node_base->tick_cb;
                         exec[1] = node_base->attr_accessor;
-                        exec[2] = mp_obj_new_float(dt_s);
+                        exec[2] = node_dt_obj;
                         mp_call_method_n_kw(1, 0, exec);
                     }
                 }
@@ -339,19 +461,40 @@ void engine_invoke_all_node_tick_callbacks(float dt_s){
                     ENGINE_ERROR_PRINTF("This node type doesn't do anything? %d", node_base->type);
                 break;
             }
-
-            current_linked_list_node = current_linked_list_node->next;
         }
     }
 
+    engine_object_tick_frame++;
+
     ENGINE_INFO_PRINTF("##### GAME TICKS COMPLETE #####\n");
 }
 
 
-void engine_invoke_all_node_draw_callbacks(){
+// Nodes are marked on screen again by any camera that sees them
+// while drawing and bitmap caches mark their subtrees again. Done
+// once per frame and not per draw since render targets and the
+// screen each draw all layers
+static void engine_clear_all_draw_bits(){
+    for(uint16_t ilx=engine_object_layers_next_occupied(engine_object_layers_occupied, 0); ilx<ENGINE_OBJECT_LAYER_COUNT; ilx=engine_object_layers_next_occupied(engine_object_layers_occupied, ilx+1)){
+        linked_list_node *current_linked_list_node = engine_object_layers[ilx].start;
+
+        while(current_linked_list_node != NULL){
+            engine_node_base_t *node_base = current_linked_list_node->object;
+            node_base_set_if_on_screen(node_base, false);
+            node_base_set_if_bitmap_cached(node_base, false);
+            node_base_set_if_bitmap_cache_drawing(node_base, false);
+            current_linked_list_node = current_linked_list_node->next;
+        }
+    }
+}
+
+
+// Draws every node for the cameras that are being drawn for (see
+// `engine_camera_render_targets`)
+static void engine_draw_all_layers(){
     linked_list_node *current_linked_list_node = NULL;
 
-    for(uint16_t ilx=0; ilx<engine_object_layer_count; ilx++){
+    for(uint16_t ilx=engine_object_layers_next_occupied(engine_object_layers_occupied, 0); ilx<ENGINE_OBJECT_LAYER_COUNT; ilx=engine_object_layers_next_occupied(engine_object_layers_occupied, ilx+1)){
         ENGINE_INFO_PRINTF("Starting drawing nodes in layer %d/%d", ilx, engine_object_layer_count-1);
 
         current_linked_list_node = engine_object_layers[ilx].start;
@@ -359,87 +502,118 @@ void engine_invoke_all_node_draw_callbacks(){
         while(current_linked_list_node != NULL){
             // Get the base node that every node is stored under
             engine_node_base_t *node_base = current_linked_list_node->object;
+            current_linked_list_node = current_linked_list_node->next;
+
+            // Subtrees with a cache are drawn all at once (or copied)
+            // when their root comes up, only their own nodes are drawn
+            // while that happens
+            if(node_bitmap_cache_skips(node_base)){
+                node_bitmap_cache_draw(node_base, engine_draw_all_layers);
+                continue;
+            }
 
             switch(node_base->type){
                 case NODE_TYPE_EMPTY:
-                {
-                    // Nothing but don't want to get to default case and error
-                }
-                break;
                 case NODE_TYPE_CAMERA:
                 {
-                    // Nothing but don't want to get to default case and error
+                    // Nothing to draw, only need to know if it's on screen for ticking
+                    if(node_base->tick_policy == NODE_BASE_TICK_VISIBLE){
+                        engine_camera_check_on_screen_2d(node_base);
+                    }
                 }
                 break;
                 case NODE_TYPE_VOXELSPACE:
                 {
-                    engine_camera_draw_for_each(voxelspace_node_class_draw, node_base);
+                    engine_camera_draw_for_each(voxelspace_node_class_draw, NULL, node_base);
                 }
                 break;
                 case NODE_TYPE_VOXELSPACE_SPRITE:
                 {
-                    engine_camera_draw_for_each(voxelspace_sprite_node_class_draw, node_base);
+                    engine_camera_draw_for_each(voxelspace_sprite_node_class_draw, NULL, node_base);
                 }
                 break;
                 case NODE_TYPE_MESH_3D:
                 {
-                    engine_camera_draw_for_each(mesh_node_class_draw, node_base);
+                    engine_camera_draw_for_each(mesh_node_class_draw, NULL, node_base);
                 }
                 break;
                 case NODE_TYPE_RECTANGLE_2D:
                 {
-                    engine_camera_draw_for_each(rectangle_2d_node_class_draw, node_base);
+                    engine_camera_draw_for_each(rectangle_2d_node_class_draw, rectangle_2d_node_class_get_bounds, node_base);
                 }
                 break;
                 case NODE_TYPE_LINE_2D:
                 {
-                    engine_camera_draw_for_each(line_2d_node_class_draw, node_base);
+                    engine_camera_draw_for_each(line_2d_node_class_draw, line_2d_node_class_get_bounds, node_base);
                 }
                 break;
                 case NODE_TYPE_CIRCLE_2D:
                 {
-                    engine_camera_draw_for_each(circle_2d_node_class_draw, node_base);
+                    engine_camera_draw_for_each(circle_2d_node_class_draw, circle_2d_node_class_get_bounds, node_base);
                 }
                 break;
                 case NODE_TYPE_SPRITE_2D:
                 {
-                    engine_camera_draw_for_each(sprite_2d_node_class_draw, node_base);
+                    engine_camera_draw_for_each(sprite_2d_node_class_draw, sprite_2d_node_class_get_bounds, node_base);
+
+                    // Cached ones are stepped by their cache, drawn or not
+                    if(node_base_is_bitmap_cached(node_base) == false){
+                        sprite_2d_node_class_animate(node_base);
+                    }
                 }
                 break;
                 case NODE_TYPE_TEXT_2D:
                 {
-                    engine_camera_draw_for_each(text_2d_node_class_draw, node_base);
+                    engine_camera_draw_for_each(text_2d_node_class_draw, text_2d_node_class_get_bounds, node_base);
+                }
+                break;
+                case NODE_TYPE_TILE_MAP_2D:
+                {
+                    engine_camera_draw_for_each(tile_map_2d_node_class_draw, tile_map_2d_node_class_get_bounds, node_base);
                 }
                 break;
                 case NODE_TYPE_GUI_BUTTON_2D:
                 {
-                    engine_camera_draw_for_each(gui_button_2d_node_class_draw, node_base);
+                    engine_camera_draw_for_each(gui_button_2d_node_class_draw, gui_button_2d_node_class_get_bounds, node_base);
                 }
                 break;
                 case NODE_TYPE_GUI_BITMAP_BUTTON_2D:
                 {
-                    engine_camera_draw_for_each(gui_bitmap_button_2d_node_class_draw, node_base);
+                    engine_camera_draw_for_each(gui_bitmap_button_2d_node_class_draw, gui_bitmap_button_2d_node_class_get_bounds, node_base);
                 }
                 break;
                 case NODE_TYPE_PHYSICS_RECTANGLE_2D:
                 {
 
-                    engine_camera_draw_for_each(physics_rectangle_2d_node_class_draw, node_base);
+                    engine_camera_draw_for_each(physics_rectangle_2d_node_class_draw, physics_rectangle_2d_node_class_get_bounds, node_base);
                 }
                 break;
                 case NODE_TYPE_PHYSICS_CIRCLE_2D:
                 {
-                    engine_camera_draw_for_each(physics_circle_2d_node_class_draw, node_base);
+                    engine_camera_draw_for_each(physics_circle_2d_node_class_draw, physics_circle_2d_node_class_get_bounds, node_base);
                 }
                 break;
                 default:
                     ENGINE_ERROR_PRINTF("This node type doesn't do anything? %d", node_base->type);
                 break;
             }
-
-            current_linked_list_node = current_linked_list_node->next;
         }
     }
+}
+
+
+void engine_invoke_all_camera_render_targets(){
+    engine_clear_all_draw_bits();
+    node_bitmap_cache_start_frame();
+    engine_camera_render_targets(engine_draw_all_layers);
+}
+
+
+void engine_invoke_all_node_draw_callbacks(){
+    // Only count what was culled while drawing this frame
+    engine_camera_reset_culled_count();
+
+    engine_draw_all_layers();
 
     ENGINE_INFO_PRINTF("##### GAME DRAWING COMPLETE #####\n");
 }
\ No newline at end of file
@@ -2,14 +2,28 @@
 #define ENGINE_OBJECT_LAYERS_H
 
 #include "utility/linked_list.h"
+#include "nodes/node_base.h"
 
 void engine_objects_clear_all();
 void engine_objects_clear_deletable();
 uint16_t engine_get_total_object_count();
-linked_list_node *engine_add_object_to_layer(void *obj, uint8_t layer_index);
-void engine_remove_object_from_layer(linked_list_node *object_list_node, uint8_t layer_index);
+// How many layers nodes can be drawn and ticked in
+#define ENGINE_OBJECT_LAYER_COUNT 128
+
+void engine_add_object_to_layer(engine_node_base_t *node_base, uint8_t layer_index);
+void engine_remove_object_from_layer(engine_node_base_t *node_base, uint8_t layer_index);
+
+// Adds the node to or removes it from the per-layer lists of nodes
+// visited by the tick loop. Call whenever a node's tick callback
+// changes, nodes that aren't in it are skipped without being looked at
+void engine_set_object_ticking(engine_node_base_t *node_base, bool ticking);
+
+void engine_invoke_all_node_tick_callbacks(float dt_ms);
+// Draws into the textures of cameras that have a render target,
+// call once a frame before drawing to the screen (it also marks
+// cached world transforms as out of date for the new frame)
+void engine_invoke_all_camera_render_targets();
 
-void engine_invoke_all_node_tick_callbacks(float dt);
 void engine_invoke_all_node_draw_callbacks();
 
 #endif  // ENGINE_OBJECT_LAYERS_H
\ No newline at end of file
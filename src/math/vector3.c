@@ -17,6 +17,9 @@ mp_obj_t vector3_class_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw
     self->y.base.type = &mp_type_float;
     self->z.base.type = &mp_type_float;
 
+    self->on_change_user_ptr = NULL;
+    self->on_changed = NULL;
+
     if(n_args == 0) {
         self->x.value = 0.0f;
         self->y.value = 0.0f;
@@ -122,6 +125,9 @@ static void vector3_class_attr(mp_obj_t self_in, qstr attribute, mp_obj_t *desti
                 return; // Fail
         }
 
+        // Let anything watching for changes know
+        if(self->on_changed != NULL) self->on_changed(self->on_change_user_ptr);
+
         // Success
         destination[0] = MP_OBJ_NULL;
     }
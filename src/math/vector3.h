@@ -10,6 +10,8 @@ typedef struct{
     mp_obj_float_t x;
     mp_obj_float_t y;
     mp_obj_float_t z;
+    void *on_change_user_ptr;
+    void (*on_changed)(void *on_change_user_ptr);                        // <- Function pointer that's called after x, y or z is changed
 }vector3_class_obj_t;
 
 extern const mp_obj_type_t vector3_class_type;
@@ -22,12 +22,14 @@ target_sources(usermod_engine INTERFACE
     ${ENGINE_MOD_DIR}/io/engine_io_rp3.c
     ${ENGINE_MOD_DIR}/nodes/node_base.c
     ${ENGINE_MOD_DIR}/nodes/physics_node_base.c
+    ${ENGINE_MOD_DIR}/nodes/node_bitmap_cache.c
     ${ENGINE_MOD_DIR}/nodes/empty_node.c
     ${ENGINE_MOD_DIR}/nodes/3D/camera_node.c
     ${ENGINE_MOD_DIR}/nodes/3D/voxelspace_node.c
     ${ENGINE_MOD_DIR}/nodes/3D/voxelspace_sprite_node.c
     ${ENGINE_MOD_DIR}/nodes/3D/mesh_node.c
     ${ENGINE_MOD_DIR}/nodes/2D/sprite_2d_node.c
+    ${ENGINE_MOD_DIR}/nodes/2D/tile_map_2d_node.c
     ${ENGINE_MOD_DIR}/nodes/2D/rectangle_2d_node.c
     ${ENGINE_MOD_DIR}/nodes/2D/line_2d_node.c
     ${ENGINE_MOD_DIR}/nodes/2D/circle_2d_node.c
@@ -42,6 +44,7 @@ target_sources(usermod_engine INTERFACE
     ${ENGINE_MOD_DIR}/math/rectangle.c
     ${ENGINE_MOD_DIR}/debug/engine_debug_module.c
     ${ENGINE_MOD_DIR}/debug/debug_print.c
+    ${ENGINE_MOD_DIR}/debug/engine_debug_profiler.c
     ${ENGINE_MOD_DIR}/utility/linked_list.c
     ${ENGINE_MOD_DIR}/utility/engine_time.c
     ${ENGINE_MOD_DIR}/utility/engine_file.c
@@ -53,9 +56,11 @@ target_sources(usermod_engine INTERFACE
     # ${ENGINE_MOD_DIR}/display/engine_display_driver_rp2_st7789.c
     ${ENGINE_MOD_DIR}/display/engine_display_driver_rp2_gc9107.c
     ${ENGINE_MOD_DIR}/display/engine_display_common.c
+    ${ENGINE_MOD_DIR}/display/engine_display_damage.c
     ${ENGINE_MOD_DIR}/draw/engine_display_draw.c
     ${ENGINE_MOD_DIR}/audio/engine_audio_module.c
     ${ENGINE_MOD_DIR}/audio/engine_audio_channel.c
+    ${ENGINE_MOD_DIR}/audio/engine_audio_mixer.c
     ${ENGINE_MOD_DIR}/resources/engine_resource_module.c
     ${ENGINE_MOD_DIR}/resources/engine_resource_manager.c
     ${ENGINE_MOD_DIR}/resources/engine_texture_resource.c
@@ -68,6 +73,7 @@ target_sources(usermod_engine INTERFACE
     ${ENGINE_MOD_DIR}/physics/engine_physics.c
     ${ENGINE_MOD_DIR}/physics/engine_physics_ids.c
     ${ENGINE_MOD_DIR}/physics/engine_physics_collision.c
+    ${ENGINE_MOD_DIR}/physics/engine_physics_broadphase.c
     ${ENGINE_MOD_DIR}/physics/collision_contact_2d.c
     ${ENGINE_MOD_DIR}/animation/engine_animation_module.c
     ${ENGINE_MOD_DIR}/animation/engine_animation_tween.c
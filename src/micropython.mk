@@ -18,12 +18,14 @@ SRC_USERMOD += $(ENGINE_MOD_DIR)/io/engine_io_module.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/io/engine_io_sdl.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/nodes/node_base.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/nodes/physics_node_base.c
+SRC_USERMOD += $(ENGINE_MOD_DIR)/nodes/node_bitmap_cache.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/nodes/empty_node.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/nodes/3D/camera_node.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/nodes/3D/voxelspace_node.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/nodes/3D/voxelspace_sprite_node.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/nodes/3D/mesh_node.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/nodes/2D/sprite_2d_node.c
+SRC_USERMOD += $(ENGINE_MOD_DIR)/nodes/2D/tile_map_2d_node.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/nodes/2D/rectangle_2d_node.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/nodes/2D/line_2d_node.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/nodes/2D/circle_2d_node.c
@@ -38,6 +40,7 @@ SRC_USERMOD += $(ENGINE_MOD_DIR)/math/vector2.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/math/rectangle.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/debug/engine_debug_module.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/debug/debug_print.c
+SRC_USERMOD += $(ENGINE_MOD_DIR)/debug/engine_debug_profiler.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/utility/linked_list.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/utility/engine_time.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/utility/engine_file.c
@@ -48,9 +51,11 @@ SRC_USERMOD += $(ENGINE_MOD_DIR)/engine_gui.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/display/engine_display.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/display/engine_display_driver_unix_sdl.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/display/engine_display_common.c
+SRC_USERMOD += $(ENGINE_MOD_DIR)/display/engine_display_damage.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/draw/engine_display_draw.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/audio/engine_audio_module.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/audio/engine_audio_channel.c
+SRC_USERMOD += $(ENGINE_MOD_DIR)/audio/engine_audio_mixer.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/resources/engine_resource_module.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/resources/engine_resource_manager.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/resources/engine_texture_resource.c
@@ -63,6 +68,7 @@ SRC_USERMOD += $(ENGINE_MOD_DIR)/physics/engine_physics_module.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/physics/engine_physics.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/physics/engine_physics_ids.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/physics/engine_physics_collision.c
+SRC_USERMOD += $(ENGINE_MOD_DIR)/physics/engine_physics_broadphase.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/physics/collision_contact_2d.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/animation/engine_animation_module.c
 SRC_USERMOD += $(ENGINE_MOD_DIR)/animation/engine_animation_tween.c
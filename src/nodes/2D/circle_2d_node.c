@@ -20,7 +20,7 @@ void circle_2d_node_class_draw(mp_obj_t circle_node_base_obj, mp_obj_t camera_no
     engine_circle_2d_node_class_obj_t *circle_2d_node = circle_node_base->node;
 
     // Avoid drawing or doing anything if opacity is zero
-    float circle_opacity = mp_obj_get_float(circle_2d_node->opacity);
+    float circle_opacity = circle_2d_node->opacity;
     if(engine_math_compare_floats(circle_opacity, 0.0f)){
         return;
     }
@@ -29,8 +29,8 @@ void circle_2d_node_class_draw(mp_obj_t circle_node_base_obj, mp_obj_t camera_no
     engine_camera_node_class_obj_t *camera = camera_node_base->node;
 
     rectangle_class_obj_t *camera_viewport = camera->viewport;
-    float camera_zoom = mp_obj_get_float(camera->zoom);
-    float camera_opacity = mp_obj_get_float(camera->opacity);
+    float camera_zoom = camera->zoom;
+    float camera_opacity = camera->opacity;
 
     float circle_radius =  mp_obj_get_float(circle_2d_node->radius);
     bool circle_outlined = mp_obj_get_int(circle_2d_node->outline);
@@ -47,8 +47,8 @@ void circle_2d_node_class_draw(mp_obj_t circle_node_base_obj, mp_obj_t camera_no
         camera_zoom = 1.0f;
     }
 
-    inherited.px += camera_viewport->width/2;
-    inherited.py += camera_viewport->height/2;
+    inherited.px += camera_viewport->x + camera_viewport->width/2;
+    inherited.py += camera_viewport->y + camera_viewport->height/2;
 
     // Scale circle radius by smallest inherited (not sure the best way to do this)
     float scale_radius_by = 1.0f;
@@ -81,6 +81,17 @@ void circle_2d_node_class_draw(mp_obj_t circle_node_base_obj, mp_obj_t camera_no
 }
 
 
+bool circle_2d_node_class_get_bounds(mp_obj_t circle_node_base_obj, mp_obj_t camera_node, engine_display_rect_t *bounds){
+    engine_node_base_t *circle_node_base = circle_node_base_obj;
+    engine_circle_2d_node_class_obj_t *circle_2d_node = circle_node_base->node;
+
+    float circle_radius = mp_obj_get_float(circle_2d_node->radius);
+
+    engine_camera_get_bounds_2d(circle_node_base, camera_node, circle_radius, circle_radius, 0.0f, bounds);
+    return true;
+}
+
+
 // Return `true` if handled loading the attr from internal structure, `false` otherwise
 bool circle_2d_node_load_attr(engine_node_base_t *self_node_base, qstr attribute, mp_obj_t *destination){
     // Get the underlying structure
@@ -105,7 +116,7 @@ bool circle_2d_node_load_attr(engine_node_base_t *self_node_base, qstr attribute
             return true;
         break;
         case MP_QSTR_rotation:
-            destination[0] = self->rotation;
+            destination[0] = mp_obj_new_float(self->rotation);
             return true;
         break;
         case MP_QSTR_color:
@@ -113,7 +124,7 @@ bool circle_2d_node_load_attr(engine_node_base_t *self_node_base, qstr attribute
             return true;
         break;
         case MP_QSTR_opacity:
-            destination[0] = self->opacity;
+            destination[0] = mp_obj_new_float(self->opacity);
             return true;
         break;
         case MP_QSTR_scale:
@@ -138,6 +149,7 @@ bool circle_2d_node_store_attr(engine_node_base_t *self_node_base, qstr attribut
     switch(attribute){
         case MP_QSTR_tick:
             self->tick_cb = destination[1];
+            engine_set_object_ticking(self_node_base, self->tick_cb != mp_const_none);
             return true;
         break;
         case MP_QSTR_position:
@@ -149,7 +161,7 @@ bool circle_2d_node_store_attr(engine_node_base_t *self_node_base, qstr attribut
             return true;
         break;
         case MP_QSTR_rotation:
-            self->rotation = destination[1];
+            self->rotation = mp_obj_get_float(destination[1]);
             return true;
         break;
         case MP_QSTR_color:
@@ -157,7 +169,7 @@ bool circle_2d_node_store_attr(engine_node_base_t *self_node_base, qstr attribut
             return true;
         break;
         case MP_QSTR_opacity:
-            self->opacity = destination[1];
+            self->opacity = mp_obj_get_float(destination[1]);
             return true;
         break;
         case MP_QSTR_scale:
@@ -209,7 +221,7 @@ static mp_attr_fun_t circle_2d_node_class_attr(mp_obj_t self_in, qstr attribute,
    ATTR:    [type=function]                         [name={ref_link:get_parent}]                         [value=function]
    ATTR:    [type=function]                         [name={ref_link:tick}]                               [value=function]
    ATTR:    [type={ref_link:Vector2}]               [name=position]                                      [value={ref_link:Vector2}]
-   ATTR:    [type={ref_link:Vector2}]               [name=global_position]                               [value={ref_link:Vector2} (read-only)]
+   ATTR:    [type={ref_link:Vector2}]               [name=global_position]                               [value={ref_link:Vector2} (read-only, the same Vector2 is updated and returned on every access)]
    ATTR:    [type=float]                            [name=radius]                                        [value=any]
    ATTR:    [type=float]                            [name=rotation]                                      [value=any]
    ATTR:    [type={ref_link:Color}|int (RGB565)]    [name=color]                                         [value=color]
@@ -272,9 +284,9 @@ mp_obj_t circle_2d_node_class_new(const mp_obj_type_t *type, size_t n_args, size
     circle_2d_node->tick_cb  = mp_const_none;
     circle_2d_node->position = parsed_args[position].u_obj;
     circle_2d_node->radius = parsed_args[radius].u_obj;
-    circle_2d_node->rotation = parsed_args[rotation].u_obj;
+    circle_2d_node->rotation = mp_obj_get_float(parsed_args[rotation].u_obj);
     circle_2d_node->color = engine_color_wrap(parsed_args[color].u_obj);
-    circle_2d_node->opacity = parsed_args[opacity].u_obj;
+    circle_2d_node->opacity = mp_obj_get_float(parsed_args[opacity].u_obj);
     circle_2d_node->scale = parsed_args[scale].u_obj;
     circle_2d_node->outline = parsed_args[outline].u_obj;
     node_base_set_inherit_position(node_base, parsed_args[inherit_position].u_bool);
@@ -315,6 +327,8 @@ mp_obj_t circle_2d_node_class_new(const mp_obj_type_t *type, size_t n_args, size
         node_base->attr_accessor = node_instance;
     }
 
+    engine_set_object_ticking(node_base, circle_2d_node->tick_cb != mp_const_none);
+
     return MP_OBJ_FROM_PTR(node_base);
 }
 
@@ -3,15 +3,16 @@
 
 #include "py/obj.h"
 #include "nodes/node_base.h"
+#include "display/engine_display_common.h"
 
 
 // A basic 2d circle node
 typedef struct{
     mp_obj_t position;  // Vector2: 2d xy position of this node
     mp_obj_t radius;    // float
-    mp_obj_t rotation;  // float Rotation in radians (affects child nodes)
+    float rotation;     // float Rotation in radians (affects child nodes)
     mp_obj_t color;     // int The color of this circle
-    mp_obj_t opacity;
+    float opacity;
     mp_obj_t scale;     // float: how much to scale radius by, 1.0f by default
     mp_obj_t outline;   // bool: if true, circle is drawn as an outline, false by default
     mp_obj_t tick_cb;
@@ -19,6 +20,7 @@ typedef struct{
 
 extern const mp_obj_type_t engine_circle_2d_node_class_type;
 void circle_2d_node_class_draw(mp_obj_t circle_node_base_obj, mp_obj_t camera_node);
+bool circle_2d_node_class_get_bounds(mp_obj_t circle_node_base_obj, mp_obj_t camera_node, engine_display_rect_t *bounds);
 
 
 #endif  // CIRCLE_2D_NODE_H
@@ -28,7 +28,7 @@ void gui_bitmap_button_2d_node_class_draw(mp_obj_t button_node_base_obj, mp_obj_
     engine_gui_bitmap_button_2d_node_class_obj_t *button = button_node_base->node;
 
     // Avoid drawing or doing anything if opacity is zero
-    float button_opacity = mp_obj_get_float(button->opacity);
+    float button_opacity = button->opacity;
     if(engine_math_compare_floats(button_opacity, 0.0f)){
         return;
     }
@@ -38,8 +38,8 @@ void gui_bitmap_button_2d_node_class_draw(mp_obj_t button_node_base_obj, mp_obj_
         engine_camera_node_class_obj_t *camera = camera_node_base->node;
 
         rectangle_class_obj_t *camera_viewport = camera->viewport;
-        float camera_zoom = mp_obj_get_float(camera->zoom);
-        float camera_opacity = mp_obj_get_float(camera->opacity);
+        float camera_zoom = camera->zoom;
+        float camera_opacity = camera->opacity;
 
         // Get inherited properties
         engine_inheritable_2d_t inherited;
@@ -51,8 +51,8 @@ void gui_bitmap_button_2d_node_class_draw(mp_obj_t button_node_base_obj, mp_obj_
             camera_zoom = 1.0f;
         }
 
-        inherited.px += camera_viewport->width/2;
-        inherited.py += camera_viewport->height/2;
+        inherited.px += camera_viewport->x + camera_viewport->width/2;
+        inherited.py += camera_viewport->y + camera_viewport->height/2;
 
         font_resource_class_obj_t *font = button->font_resource;
         vector2_class_obj_t *button_text_scale = button->text_scale;
@@ -105,13 +105,7 @@ void gui_bitmap_button_2d_node_class_draw(mp_obj_t button_node_base_obj, mp_obj_
             text_shader = engine_get_builtin_shader(EMPTY_SHADER);
         }else{
             text_shader = engine_get_builtin_shader(BLEND_OPACITY_SHADER);
-
-            float t = 1.0f;
-
-            text_shader->program[1] = (text_color->value >> 8) & 0b11111111;
-            text_shader->program[2] = (text_color->value >> 0) & 0b11111111;
-
-            memcpy(text_shader->program+3, &t, sizeof(float));
+            engine_shader_set_interpolate(text_shader, text_color->value, 1.0f);
         }
 
         engine_draw_text(font, button->text,
@@ -127,6 +121,28 @@ void gui_bitmap_button_2d_node_class_draw(mp_obj_t button_node_base_obj, mp_obj_
 }
 
 
+bool gui_bitmap_button_2d_node_class_get_bounds(mp_obj_t button_node_base_obj, mp_obj_t camera_node, engine_display_rect_t *bounds){
+    engine_node_base_t *button_node_base = button_node_base_obj;
+    engine_gui_bitmap_button_2d_node_class_obj_t *button = button_node_base->node;
+
+    if(button->bitmap_texture == mp_const_none || button->text == mp_const_none){
+        return false;
+    }
+
+    // The text can be scaled to be larger than the bitmap. The
+    // focused and pressed bitmaps can be larger too but those
+    // are only used for the button that has focus
+    texture_resource_class_obj_t *bitmap = button->bitmap_texture;
+    vector2_class_obj_t *button_text_scale = button->text_scale;
+
+    float half_width = fmaxf(bitmap->width, button->text_width * fabsf(button_text_scale->x.value)) * 0.5f;
+    float half_height = fmaxf(bitmap->height, button->text_height * fabsf(button_text_scale->x.value)) * 0.5f;
+
+    engine_camera_get_bounds_2d(button_node_base, camera_node, half_width, half_height, 0.0f, bounds);
+    return true;
+}
+
+
 void gui_bitmap_button_2d_node_calculate_dimensions(engine_gui_bitmap_button_2d_node_class_obj_t *button){
     if(button->text != mp_const_none && button->font_resource != mp_const_none){
         font_resource_get_box_dimensions(button->font_resource, button->text, &button->text_width, &button->text_height, mp_obj_get_float(button->letter_spacing), mp_obj_get_float(button->line_spacing));
@@ -143,7 +159,7 @@ mp_obj_t gui_bitmap_button_2d_node_class_del(mp_obj_t self_in){
     // If this node is focused but being deleted, tell the GUI engine
     if(gui_button->focused) engine_gui_clear_focused();
 
-    engine_collections_untrack_gui(gui_button->gui_list_node);
+    engine_collections_untrack_gui(node_base);
 
     node_base_del(self_in);
 
@@ -208,7 +224,7 @@ bool bitmap_button_2d_node_load_attr(engine_node_base_t *self_node_base, qstr at
         break;
 
         case MP_QSTR_rotation:
-            destination[0] = self->rotation;
+            destination[0] = mp_obj_new_float(self->rotation);
             return true;
         break;
         case MP_QSTR_scale:
@@ -220,7 +236,7 @@ bool bitmap_button_2d_node_load_attr(engine_node_base_t *self_node_base, qstr at
             return true;
         break;
         case MP_QSTR_opacity:
-            destination[0] = self->opacity;
+            destination[0] = mp_obj_new_float(self->opacity);
             return true;
         break;
 
@@ -359,7 +375,7 @@ bool bitmap_button_2d_node_store_attr(engine_node_base_t *self_node_base, qstr a
         break;
 
         case MP_QSTR_rotation:
-            self->rotation = destination[1];
+            self->rotation = mp_obj_get_float(destination[1]);
             return true;
         break;
         case MP_QSTR_scale:
@@ -371,7 +387,7 @@ bool bitmap_button_2d_node_store_attr(engine_node_base_t *self_node_base, qstr a
             return true;
         break;
         case MP_QSTR_opacity:
-            self->opacity = destination[1];
+            self->opacity = mp_obj_get_float(destination[1]);
             return true;
         break;
 
@@ -513,7 +529,7 @@ static mp_attr_fun_t gui_bitmap_button_2d_node_class_attr(mp_obj_t self_in, qstr
     ATTR:   [type=function]                   [name={ref_link:on_just_released}]                    [value=function]
 
     ATTR:   [type={ref_link:Vector2}]         [name=position]                                       [value={ref_link:Vector2}]
-    ATTR:   [type={ref_link:Vector2}]         [name=global_position]                                [value={ref_link:Vector2} (read-only)]
+    ATTR:   [type={ref_link:Vector2}]         [name=global_position]                                [value={ref_link:Vector2} (read-only, the same Vector2 is updated and returned on every access)]
     ATTR:   [type={ref_link:FontResource}]    [name=font]                                           [value={ref_link:FontResource}]
     ATTR:   [type=string]                     [name=text]                                           [value=any]
     ATTR:   [type=float]                      [name=outline]                                        [value=any (how thick the outline should be, in px)]
@@ -641,7 +657,7 @@ mp_obj_t gui_bitmap_button_2d_node_class_new(const mp_obj_type_t *type, size_t n
     node_base->node = gui_bitmap_button_2d_node;
     node_base->attr_accessor = node_base;
 
-    gui_bitmap_button_2d_node->gui_list_node = engine_collections_track_gui(node_base);
+    engine_collections_track_gui(node_base);
 
     gui_bitmap_button_2d_node->tick_cb = mp_const_none;
     gui_bitmap_button_2d_node->on_before_focused_cb = mp_const_none;
@@ -666,10 +682,10 @@ mp_obj_t gui_bitmap_button_2d_node_class_new(const mp_obj_type_t *type, size_t n
 
     gui_bitmap_button_2d_node->transparent_color = engine_color_wrap(parsed_args[transparent_color].u_obj);
 
-    gui_bitmap_button_2d_node->rotation = parsed_args[rotation].u_obj;
+    gui_bitmap_button_2d_node->rotation = mp_obj_get_float(parsed_args[rotation].u_obj);
     gui_bitmap_button_2d_node->scale = parsed_args[scale].u_obj;
     gui_bitmap_button_2d_node->text_scale = parsed_args[text_scale].u_obj;
-    gui_bitmap_button_2d_node->opacity = parsed_args[opacity].u_obj;
+    gui_bitmap_button_2d_node->opacity = mp_obj_get_float(parsed_args[opacity].u_obj);
 
     gui_bitmap_button_2d_node->letter_spacing = parsed_args[letter_spacing].u_obj;
     gui_bitmap_button_2d_node->line_spacing = parsed_args[line_spacing].u_obj;
@@ -768,6 +784,9 @@ mp_obj_t gui_bitmap_button_2d_node_class_new(const mp_obj_type_t *type, size_t n
 
     gui_bitmap_button_2d_node_calculate_dimensions(gui_bitmap_button_2d_node);
 
+    // Always ticked, focus and press callbacks are also called from the tick loop
+    engine_set_object_ticking(node_base, true);
+
     return MP_OBJ_FROM_PTR(node_base);
 }
 
@@ -4,6 +4,7 @@
 #include "py/obj.h"
 #include "math/vector2.h"
 #include "nodes/node_base.h"
+#include "display/engine_display_common.h"
 #include "utility/linked_list.h"
 #include "io/engine_io_buttons.h"
 
@@ -26,9 +27,9 @@ typedef struct{
     mp_obj_t focused_outline_color;
     mp_obj_t pressed_outline_color;
 
-    mp_obj_t rotation;
+    float rotation;
     mp_obj_t scale;
-    mp_obj_t opacity;
+    float opacity;
 
     mp_obj_t letter_spacing;
     mp_obj_t line_spacing;
@@ -56,10 +57,10 @@ typedef struct{
     float width_outline;
     float height_outline;
 
-    linked_list_node *gui_list_node;
 }engine_gui_button_2d_node_class_obj_t;
 
 extern const mp_obj_type_t engine_gui_button_2d_node_class_type;
 void gui_button_2d_node_class_draw(mp_obj_t button_node_base_obj, mp_obj_t camera_node);
+bool gui_button_2d_node_class_get_bounds(mp_obj_t button_node_base_obj, mp_obj_t camera_node, engine_display_rect_t *bounds);
 
 #endif  // GUI_BUTTON_2D_NODE_H
\ No newline at end of file
@@ -21,7 +21,7 @@ void line_2d_node_class_draw(mp_obj_t line_node_base_obj, mp_obj_t camera_node){
     engine_line_2d_node_class_obj_t *line_2d = line_node_base->node;
 
     // Avoid drawing or doing anything if opacity is zero
-    float line_opacity = mp_obj_get_float(line_2d->opacity);
+    float line_opacity = line_2d->opacity;
     if(engine_math_compare_floats(line_opacity, 0.0f)){
         return;
     }
@@ -41,8 +41,8 @@ void line_2d_node_class_draw(mp_obj_t line_node_base_obj, mp_obj_t camera_node){
 
     // Grab camera
     rectangle_class_obj_t *camera_viewport = camera->viewport;
-    float camera_zoom = mp_obj_get_float(camera->zoom);
-    float camera_opacity = mp_obj_get_float(camera->opacity);
+    float camera_zoom = camera->zoom;
+    float camera_opacity = camera->opacity;
 
     // Get inherited properties
     engine_inheritable_2d_t inherited;
@@ -55,8 +55,8 @@ void line_2d_node_class_draw(mp_obj_t line_node_base_obj, mp_obj_t camera_node){
         camera_zoom = 1.0f;
     }
 
-    inherited.px += camera_viewport->width/2;
-    inherited.py += camera_viewport->height/2;
+    inherited.px += camera_viewport->x + camera_viewport->width/2;
+    inherited.py += camera_viewport->y + camera_viewport->height/2;
 
     line_opacity = inherited.opacity*camera_opacity;
 
@@ -117,8 +117,27 @@ void line_2d_node_class_draw(mp_obj_t line_node_base_obj, mp_obj_t camera_node){
 }
 
 
-void line_2d_recalculate_midpoint(void *line_obj){
-    engine_line_2d_node_class_obj_t *line = (engine_line_2d_node_class_obj_t*)line_obj;
+bool line_2d_node_class_get_bounds(mp_obj_t line_node_base_obj, mp_obj_t camera_node, engine_display_rect_t *bounds){
+    engine_node_base_t *line_node_base = line_node_base_obj;
+    engine_line_2d_node_class_obj_t *line_2d = line_node_base->node;
+
+    vector2_class_obj_t *line_start = line_2d->start;
+    vector2_class_obj_t *line_end = line_2d->end;
+
+    // The outlined line's corners can end up anywhere around its
+    // center, so use a square that fits the line at any angle
+    float line_length = engine_math_distance_between(line_start->x.value, line_start->y.value, line_end->x.value, line_end->y.value);
+    float line_thickness = fmaxf(mp_obj_get_float(line_2d->thickness), 1.0f);
+    float line_half_diagonal = 0.5f * sqrtf(line_length*line_length + line_thickness*line_thickness);
+
+    engine_camera_get_bounds_2d(line_node_base, camera_node, line_half_diagonal, line_half_diagonal, 0.0f, bounds);
+    return true;
+}
+
+
+void line_2d_recalculate_midpoint(void *line_node_base_obj){
+    engine_node_base_t *line_node_base = line_node_base_obj;
+    engine_line_2d_node_class_obj_t *line = line_node_base->node;
 
     vector2_class_obj_t *start = line->start;
     vector2_class_obj_t *position = line->position;
@@ -131,11 +150,14 @@ void line_2d_recalculate_midpoint(void *line_obj){
 
     position->x.value = mx;
     position->y.value = my;
+
+    node_base_set_transform_changed(line_node_base);
 }
 
 
-void line_2d_translate_endpoints(void *line_obj, float nx, float ny){
-    engine_line_2d_node_class_obj_t *line = (engine_line_2d_node_class_obj_t*)line_obj;
+void line_2d_translate_endpoints(void *line_node_base_obj, float nx, float ny){
+    engine_node_base_t *line_node_base = line_node_base_obj;
+    engine_line_2d_node_class_obj_t *line = line_node_base->node;
 
     vector2_class_obj_t *start = line->start;
     vector2_class_obj_t *position = line->position;
@@ -149,6 +171,8 @@ void line_2d_translate_endpoints(void *line_obj, float nx, float ny){
 
     start->y.value += dy;
     end->y.value += dy;
+
+    node_base_set_transform_changed(line_node_base);
 }
 
 
@@ -184,7 +208,7 @@ bool line_2d_load_attr(engine_node_base_t *self_node_base, qstr attribute, mp_ob
             return true;
         break;
         case MP_QSTR_opacity:
-            destination[0] = self->opacity;
+            destination[0] = mp_obj_new_float(self->opacity);
             return true;
         break;
         case MP_QSTR_outline:
@@ -205,21 +229,22 @@ bool line_2d_store_attr(engine_node_base_t *self_node_base, qstr attribute, mp_o
     switch(attribute){
         case MP_QSTR_tick:
             self->tick_cb = destination[1];
+            engine_set_object_ticking(self_node_base, self->tick_cb != mp_const_none);
             return true;
         break;
         case MP_QSTR_start:
             self->start = destination[1];
-            line_2d_recalculate_midpoint(self);
+            line_2d_recalculate_midpoint(self_node_base);
             return true;
         break;
         case MP_QSTR_end:
             self->end = destination[1];
-            line_2d_recalculate_midpoint(self);
+            line_2d_recalculate_midpoint(self_node_base);
             return true;
         break;
         case MP_QSTR_position:
             // Offset `start` and `end` based on new position
-            line_2d_translate_endpoints(self, ((vector2_class_obj_t*)destination[1])->x.value, ((vector2_class_obj_t*)destination[1])->y.value);
+            line_2d_translate_endpoints(self_node_base, ((vector2_class_obj_t*)destination[1])->x.value, ((vector2_class_obj_t*)destination[1])->y.value);
             self->position = destination[1];
             return true;
         break;
@@ -232,7 +257,7 @@ bool line_2d_store_attr(engine_node_base_t *self_node_base, qstr attribute, mp_o
             return true;
         break;
         case MP_QSTR_opacity:
-            self->opacity = destination[1];
+            self->opacity = mp_obj_get_float(destination[1]);
             return true;
         break;
         case MP_QSTR_outline:
@@ -281,7 +306,7 @@ static mp_attr_fun_t line_2d_node_class_attr(mp_obj_t self_in, qstr attribute, m
     ATTR:   [type={ref_link:Vector2}]               [name=start]                                        [value={ref_link:Vector2}]
     ATTR:   [type={ref_link:Vector2}]               [name=end]                                          [value={ref_link:Vector2}]
     ATTR:   [type={ref_link:Vector2}]               [name=position]                                     [value={ref_link:Vector2}]
-    ATTR:   [type={ref_link:Vector2}]               [name=global_position]                              [value={ref_link:Vector2} (read-only)]
+    ATTR:   [type={ref_link:Vector2}]               [name=global_position]                              [value={ref_link:Vector2} (read-only, the same Vector2 is updated and returned on every access)]
     ATTR:   [type=float]                            [name=thickness]                                    [value=any]
     ATTR:   [type={ref_link:Color}|int (RGB565)]    [name=color]                                        [value=color]
     ATTR:   [type=float]                            [name=opacity]                                      [value=0 ~ 1.0]
@@ -346,7 +371,7 @@ mp_obj_t line_2d_node_class_new(const mp_obj_type_t *type, size_t n_args, size_t
     line_2d_node->position = vector2_class_new(&vector2_class_type, 0, 0, NULL);
     line_2d_node->thickness = parsed_args[thickness].u_obj;
     line_2d_node->color = engine_color_wrap(parsed_args[color].u_obj);
-    line_2d_node->opacity = parsed_args[opacity].u_obj;
+    line_2d_node->opacity = mp_obj_get_float(parsed_args[opacity].u_obj);
     line_2d_node->outline = parsed_args[outline].u_obj;
     node_base_set_inherit_position(node_base, parsed_args[inherit_position].u_bool);
     node_base_set_inherit_opacity(node_base, parsed_args[inherit_opacity].u_bool);
@@ -387,7 +412,7 @@ mp_obj_t line_2d_node_class_new(const mp_obj_type_t *type, size_t n_args, size_t
 
     // Calculate midpoint/position based on endpoints
     // (only positions that can be set in the constructor)
-    line_2d_recalculate_midpoint(line_2d_node);
+    line_2d_recalculate_midpoint(node_base);
 
     // When any part of the any of these Vector2s change, make sure to
     // recalculate other components of the line
@@ -396,13 +421,15 @@ mp_obj_t line_2d_node_class_new(const mp_obj_type_t *type, size_t n_args, size_t
     vector2_class_obj_t *line_end = line_2d_node->end;
 
     line_start->on_changed = &line_2d_recalculate_midpoint;
-    line_start->on_change_user_ptr = line_2d_node;
+    line_start->on_change_user_ptr = node_base;
 
     line_position->on_changing = &line_2d_translate_endpoints;
-    line_position->on_change_user_ptr = line_2d_node;
+    line_position->on_change_user_ptr = node_base;
 
     line_end->on_changed = &line_2d_recalculate_midpoint;
-    line_end->on_change_user_ptr = line_2d_node;
+    line_end->on_change_user_ptr = node_base;
+
+    engine_set_object_ticking(node_base, line_2d_node->tick_cb != mp_const_none);
 
     return MP_OBJ_FROM_PTR(node_base);
 }
@@ -4,6 +4,7 @@
 #include "py/obj.h"
 #include "math/vector2.h"
 #include "nodes/node_base.h"
+#include "display/engine_display_common.h"
 
 // A basic 2d line node
 typedef struct{
@@ -12,12 +13,13 @@ typedef struct{
     mp_obj_t position;  // Vector2: midpoint between start and end
     mp_obj_t thickness; // How thick the line should be, in pixels (ceil to clamp up)
     mp_obj_t color;     // int The color of this line
-    mp_obj_t opacity;
+    float opacity;
     mp_obj_t outline;   // bool: if true, line is drawn as an outline, false by default
     mp_obj_t tick_cb;
 }engine_line_2d_node_class_obj_t;
 
 extern const mp_obj_type_t engine_line_2d_node_class_type;
 void line_2d_node_class_draw(mp_obj_t line_node_base_obj, mp_obj_t camera_node);
+bool line_2d_node_class_get_bounds(mp_obj_t line_node_base_obj, mp_obj_t camera_node, engine_display_rect_t *bounds);
 
 #endif  // LINE_2D_NODE_H
@@ -23,7 +23,7 @@ void physics_circle_2d_node_class_draw(mp_obj_t circle_node_base_obj, mp_obj_t c
     engine_node_base_t *circle_node_base = circle_node_base_obj;
     engine_physics_node_base_t *physics_node_base = circle_node_base->node;
     engine_physics_circle_2d_node_class_obj_t *physics_circle_2d_node = physics_node_base->unique_data;
-    bool circle_outlined = mp_obj_get_int(physics_node_base->outline);
+    bool circle_outlined = physics_node_base->outline;
 
     if(circle_outlined == false){
         return;
@@ -33,7 +33,7 @@ void physics_circle_2d_node_class_draw(mp_obj_t circle_node_base_obj, mp_obj_t c
     engine_camera_node_class_obj_t *camera = camera_node_base->node;
 
     rectangle_class_obj_t *camera_viewport = camera->viewport;
-    float camera_zoom = mp_obj_get_float(camera->zoom);
+    float camera_zoom = camera->zoom;
 
     float circle_radius =  mp_obj_get_float(physics_circle_2d_node->radius);
     uint16_t color = 0xffff;
@@ -53,8 +53,8 @@ void physics_circle_2d_node_class_draw(mp_obj_t circle_node_base_obj, mp_obj_t c
         camera_zoom = 1.0f;
     }
 
-    inherited.px += camera_viewport->width/2;
-    inherited.py += camera_viewport->height/2;
+    inherited.px += camera_viewport->x + camera_viewport->width/2;
+    inherited.py += camera_viewport->y + camera_viewport->height/2;
 
     // Scale circle radius by smallest inherited (not sure the best way to do this)
     float scale_radius_by = 1.0f;
@@ -76,12 +76,29 @@ void physics_circle_2d_node_class_draw(mp_obj_t circle_node_base_obj, mp_obj_t c
 }
 
 
+bool physics_circle_2d_node_class_get_bounds(mp_obj_t circle_node_base_obj, mp_obj_t camera_node, engine_display_rect_t *bounds){
+    engine_node_base_t *circle_node_base = circle_node_base_obj;
+    engine_physics_node_base_t *physics_node_base = circle_node_base->node;
+    engine_physics_circle_2d_node_class_obj_t *physics_circle_2d_node = physics_node_base->unique_data;
+
+    // Nothing is drawn, let the draw callback return early
+    if(physics_node_base->outline == false){
+        return false;
+    }
+
+    float circle_radius = mp_obj_get_float(physics_circle_2d_node->radius);
+
+    engine_camera_get_bounds_2d(circle_node_base, camera_node, circle_radius, circle_radius, 0.0f, bounds);
+    return true;
+}
+
+
 mp_obj_t physics_circle_2d_node_class_del(mp_obj_t self_in){
     ENGINE_INFO_PRINTF("PhysicsCircle2DNode: Deleted (garbage collected, removing self from active engine objects)");
 
     engine_node_base_t *node_base = self_in;
     engine_physics_node_base_t *physics_node_base = node_base->node;
-    engine_collections_untrack_physics(physics_node_base->physics_list_node);
+    engine_collections_untrack_physics(node_base);
     engine_physics_ids_give_back(physics_node_base->physics_id);
 
     node_base_del(self_in);
@@ -96,7 +113,7 @@ void physics_circle_2d_calculate_inverse_mass(engine_node_base_t *node_base){
     engine_physics_circle_2d_node_class_obj_t *physics_circle = physics_node_base->unique_data;
 
     float radius = mp_obj_get_float(physics_circle->radius);
-    float density = mp_obj_get_float(physics_node_base->density);
+    float density = physics_node_base->density;
     float area = PI * radius*radius;
     physics_node_base->mass = density * area;
 
@@ -163,7 +180,7 @@ bool physics_circle_2d_store_attr(engine_node_base_t *self_node_base, qstr attri
             return true;
         break;
         case MP_QSTR_density:
-            physics_node_base->density = destination[1];
+            physics_node_base->density = mp_obj_get_float(destination[1]);
             physics_circle_2d_calculate_inverse_mass(self_node_base);
             physics_circle_2d_calculate_inverse_inertia(self_node_base);
             return true;
@@ -216,7 +233,7 @@ static mp_attr_fun_t physics_circle_2d_node_class_attr(mp_obj_t self_in, qstr at
     ATTR:  [type=function]                               [name={ref_link:enable_collision_layer}]           [value=function]
     ATTR:  [type=function]                               [name={ref_link:disable_collision_layer}]          [value=function]
     ATTR:  [type={ref_link:Vector2}]                     [name=position]                                    [value={ref_link:Vector2}]
-    ATTR:  [type={ref_link:Vector2}]                     [name=global_position]                             [value={ref_link:Vector2} (read-only)]
+    ATTR:  [type={ref_link:Vector2}]                     [name=global_position]                             [value={ref_link:Vector2} (read-only, the same Vector2 is updated and returned on every access)]
     ATTR:  [type=float]                                  [name=radius]                                      [value=any]
     ATTR:  [type={ref_link:Vector2}]                     [name=velocity]                                    [value={ref_link:Vector2}]
     ATTR:  [type=float]                                  [name=rotation]                                    [value=any]
@@ -303,13 +320,13 @@ mp_obj_t physics_circle_2d_node_class_new(const mp_obj_type_t *type, size_t n_ar
     physics_node_base->velocity = parsed_args[velocity].u_obj;
     physics_node_base->angular_velocity = mp_obj_get_float(parsed_args[angular_velocity].u_obj);
     physics_node_base->rotation = mp_obj_get_float(parsed_args[rotation].u_obj);
-    physics_node_base->density = parsed_args[density].u_obj;
-    physics_node_base->friction = parsed_args[friction].u_obj;
-    physics_node_base->bounciness = parsed_args[bounciness].u_obj;
-    physics_node_base->dynamic = parsed_args[dynamic].u_obj;
-    physics_node_base->solid = parsed_args[solid].u_obj;
+    physics_node_base->density = mp_obj_get_float(parsed_args[density].u_obj);
+    physics_node_base->friction = mp_obj_get_float(parsed_args[friction].u_obj);
+    physics_node_base->bounciness = mp_obj_get_float(parsed_args[bounciness].u_obj);
+    physics_node_base->dynamic = mp_obj_is_true(parsed_args[dynamic].u_obj);
+    physics_node_base->solid = mp_obj_is_true(parsed_args[solid].u_obj);
     physics_node_base->gravity_scale = parsed_args[gravity_scale].u_obj;
-    physics_node_base->outline = parsed_args[outline].u_obj;
+    physics_node_base->outline = mp_obj_is_true(parsed_args[outline].u_obj);
     physics_node_base->outline_color = parsed_args[outline_color].u_obj;
     physics_node_base->collision_mask = parsed_args[collision_mask].u_int;
     node_base_set_inherit_position(node_base, parsed_args[inherit_position].u_bool);
@@ -324,12 +341,13 @@ mp_obj_t physics_circle_2d_node_class_new(const mp_obj_type_t *type, size_t n_ar
 
     // Track the node base for this physics node so that it can
     // be looped over quickly in a linked list
-    physics_node_base->physics_list_node = engine_collections_track_physics(node_base);
+    engine_collections_track_physics(node_base);
 
     physics_node_base->physics_tick_cb = mp_const_none;
     physics_node_base->tick_cb = mp_const_none;
     physics_node_base->on_collide_cb = mp_const_none;
     physics_node_base->on_separate_cb = mp_const_none;
+    physics_node_base->collision_contact = MP_OBJ_NULL;
     physics_node_base->was_colliding = false;
     physics_node_base->colliding = false;
 
@@ -392,6 +410,8 @@ mp_obj_t physics_circle_2d_node_class_new(const mp_obj_type_t *type, size_t n_ar
         node_base->attr_accessor = node_instance;
     }
 
+    engine_set_object_ticking(node_base, physics_node_base->tick_cb != mp_const_none);
+
     return MP_OBJ_FROM_PTR(node_base);
 }
 
@@ -4,6 +4,7 @@
 
 #include "py/obj.h"
 #include "nodes/node_base.h"
+#include "display/engine_display_common.h"
 #include "utility/linked_list.h"
 
 
@@ -19,5 +20,6 @@ extern const mp_obj_type_t engine_physics_circle_2d_node_class_type;
 void engine_physics_circle_2d_node_update(engine_physics_circle_2d_node_class_obj_t *self);
 
 void physics_circle_2d_node_class_draw(mp_obj_t circle_node_base_obj, mp_obj_t camera_node);
+bool physics_circle_2d_node_class_get_bounds(mp_obj_t circle_node_base_obj, mp_obj_t camera_node, engine_display_rect_t *bounds);
 
 #endif  // PHYSICS_CIRCLE_2D_NODE_H
\ No newline at end of file
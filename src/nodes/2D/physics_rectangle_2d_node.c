@@ -22,7 +22,7 @@ void physics_rectangle_2d_node_class_draw(mp_obj_t rectangle_node_base_obj, mp_o
     engine_node_base_t *rectangle_node_base = rectangle_node_base_obj;
     engine_physics_node_base_t *physics_node_base = rectangle_node_base->node;
     engine_physics_rectangle_2d_node_class_obj_t *physics_rectangle_2d_node = physics_node_base->unique_data;
-    bool rectangle_outlined = mp_obj_get_int(physics_node_base->outline);
+    bool rectangle_outlined = physics_node_base->outline;
 
     if(rectangle_outlined == false){
         return;
@@ -42,7 +42,7 @@ void physics_rectangle_2d_node_class_draw(mp_obj_t rectangle_node_base_obj, mp_o
     }
 
     rectangle_class_obj_t *camera_viewport = camera->viewport;
-    float camera_zoom = mp_obj_get_float(camera->zoom);
+    float camera_zoom = camera->zoom;
 
     // Get inherited properties
     engine_inheritable_2d_t inherited;
@@ -54,8 +54,8 @@ void physics_rectangle_2d_node_class_draw(mp_obj_t rectangle_node_base_obj, mp_o
         camera_zoom = 1.0f;
     }
 
-    inherited.px += camera_viewport->width/2;
-    inherited.py += camera_viewport->height/2;
+    inherited.px += camera_viewport->x + camera_viewport->width/2;
+    inherited.py += camera_viewport->y + camera_viewport->height/2;
 
     rectangle_width = (uint16_t)(rectangle_width*inherited.sx*camera_zoom);
     rectangle_height = (uint16_t)(rectangle_height*inherited.sy*camera_zoom);
@@ -92,6 +92,24 @@ void physics_rectangle_2d_node_class_draw(mp_obj_t rectangle_node_base_obj, mp_o
 }
 
 
+bool physics_rectangle_2d_node_class_get_bounds(mp_obj_t rectangle_node_base_obj, mp_obj_t camera_node, engine_display_rect_t *bounds){
+    engine_node_base_t *rectangle_node_base = rectangle_node_base_obj;
+    engine_physics_node_base_t *physics_node_base = rectangle_node_base->node;
+    engine_physics_rectangle_2d_node_class_obj_t *physics_rectangle_2d_node = physics_node_base->unique_data;
+
+    // Nothing is drawn, let the draw callback return early
+    if(physics_node_base->outline == false){
+        return false;
+    }
+
+    float rectangle_half_width = mp_obj_get_float(physics_rectangle_2d_node->width) * 0.5f;
+    float rectangle_half_height = mp_obj_get_float(physics_rectangle_2d_node->height) * 0.5f;
+
+    engine_camera_get_bounds_2d(rectangle_node_base, camera_node, rectangle_half_width, rectangle_half_height, 0.0f, bounds);
+    return true;
+}
+
+
 void engine_physics_rectangle_2d_node_calculate(engine_physics_node_base_t *physics_node_base, float scale_x, float scale_y, float *vertices_x, float *vertices_y, float *normals_x, float *normals_y, float rotation){
     engine_physics_rectangle_2d_node_class_obj_t *self = physics_node_base->unique_data;
 
@@ -148,7 +166,7 @@ mp_obj_t physics_rectangle_2d_node_class_del(mp_obj_t self_in){
     engine_node_base_t *node_base = self_in;
     engine_physics_node_base_t *physics_node_base = node_base->node;
     // engine_physics_rectangle_2d_node_class_obj_t *node = physics_node_base->unique_data;
-    engine_collections_untrack_physics(physics_node_base->physics_list_node);
+    engine_collections_untrack_physics(node_base);
     engine_physics_ids_give_back(physics_node_base->physics_id);
 
     node_base_del(self_in);
@@ -186,6 +204,7 @@ mp_obj_t physics_rectangle_2d_node_class_adjust_from_to(mp_obj_t self_in, mp_obj
     physics_node_base->rotation = rotation;
     position->x.value = mid_x;
     position->y.value = mid_y;
+    node_base_set_transform_changed(node_base);
 
     return mp_const_none;
 }
@@ -198,7 +217,7 @@ void physics_rectangle_2d_calculate_inverse_mass(engine_node_base_t *node_base){
 
     float width = mp_obj_get_float(physics_rectangle->width);
     float height = mp_obj_get_float(physics_rectangle->height);
-    float density = mp_obj_get_float(physics_node_base->density);
+    float density = physics_node_base->density;
     float area = width * height;
     physics_node_base->mass = density * area;
 
@@ -287,7 +306,7 @@ bool physics_rectangle_2d_store_attr(engine_node_base_t *self_node_base, qstr at
             return true;
         break;
         case MP_QSTR_density:
-            physics_node_base->density = destination[1];
+            physics_node_base->density = mp_obj_get_float(destination[1]);
             physics_rectangle_2d_calculate_inverse_mass(self_node_base);
             physics_rectangle_2d_calculate_inverse_inertia(self_node_base);
             return true;
@@ -343,7 +362,7 @@ static mp_attr_fun_t physics_rectangle_2d_node_class_attr(mp_obj_t self_in, qstr
     ATTR:  [type=function]                               [name={ref_link:disable_collision_layer}]          [value=function]
     ATTR:  [type=function]                               [name={ref_link:adjust_from_to}]                   [value=function]
     ATTR:  [type={ref_link:Vector2}]                     [name=position]                                    [value={ref_link:Vector2}]
-    ATTR:  [type={ref_link:Vector2}]                     [name=global_position]                             [value={ref_link:Vector2} (read-only)]
+    ATTR:  [type={ref_link:Vector2}]                     [name=global_position]                             [value={ref_link:Vector2} (read-only, the same Vector2 is updated and returned on every access)]
     ATTR:  [type=float]                                  [name=width]                                       [value=any]
     ATTR:  [type=float]                                  [name=height]                                      [value=any]
     ATTR:  [type={ref_link:Vector2}]                     [name=velocity]                                    [value={ref_link:Vector2}]
@@ -432,13 +451,13 @@ mp_obj_t physics_rectangle_2d_node_class_new(const mp_obj_type_t *type, size_t n
     physics_node_base->velocity = parsed_args[velocity].u_obj;
     physics_node_base->angular_velocity = mp_obj_get_float(parsed_args[angular_velocity].u_obj);
     physics_node_base->rotation = mp_obj_get_float(parsed_args[rotation].u_obj);
-    physics_node_base->density = parsed_args[density].u_obj;
-    physics_node_base->friction = parsed_args[friction].u_obj;
-    physics_node_base->bounciness = parsed_args[bounciness].u_obj;
-    physics_node_base->dynamic = parsed_args[dynamic].u_obj;
-    physics_node_base->solid = parsed_args[solid].u_obj;
+    physics_node_base->density = mp_obj_get_float(parsed_args[density].u_obj);
+    physics_node_base->friction = mp_obj_get_float(parsed_args[friction].u_obj);
+    physics_node_base->bounciness = mp_obj_get_float(parsed_args[bounciness].u_obj);
+    physics_node_base->dynamic = mp_obj_is_true(parsed_args[dynamic].u_obj);
+    physics_node_base->solid = mp_obj_is_true(parsed_args[solid].u_obj);
     physics_node_base->gravity_scale = parsed_args[gravity_scale].u_obj;
-    physics_node_base->outline = parsed_args[outline].u_obj;
+    physics_node_base->outline = mp_obj_is_true(parsed_args[outline].u_obj);
     physics_node_base->outline_color = parsed_args[outline_color].u_obj;
     physics_node_base->collision_mask = mp_obj_get_int(parsed_args[collision_mask].u_obj);
     node_base_set_inherit_position(node_base, parsed_args[inherit_position].u_bool);
@@ -455,12 +474,13 @@ mp_obj_t physics_rectangle_2d_node_class_new(const mp_obj_type_t *type, size_t n
 
     // Track the node base for this physics node so that it can
     // be looped over quickly in a linked list
-    physics_node_base->physics_list_node = engine_collections_track_physics(node_base);
+    engine_collections_track_physics(node_base);
 
     physics_node_base->physics_tick_cb = mp_const_none;
     physics_node_base->tick_cb = mp_const_none;
     physics_node_base->on_collide_cb = mp_const_none;
     physics_node_base->on_separate_cb = mp_const_none;
+    physics_node_base->collision_contact = MP_OBJ_NULL;
 
     physics_rectangle_2d_node->width = parsed_args[width].u_obj;
     physics_rectangle_2d_node->height = parsed_args[height].u_obj;
@@ -522,6 +542,8 @@ mp_obj_t physics_rectangle_2d_node_class_new(const mp_obj_type_t *type, size_t n
         node_base->attr_accessor = node_instance;
     }
 
+    engine_set_object_ticking(node_base, physics_node_base->tick_cb != mp_const_none);
+
     return MP_OBJ_FROM_PTR(node_base);
 }
 
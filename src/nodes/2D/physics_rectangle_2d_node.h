@@ -4,6 +4,7 @@
 
 #include "py/obj.h"
 #include "nodes/node_base.h"
+#include "display/engine_display_common.h"
 #include "nodes/physics_node_base.h"
 #include "utility/linked_list.h"
 
@@ -21,5 +22,6 @@ extern const mp_obj_type_t engine_physics_rectangle_2d_node_class_type;
 void engine_physics_rectangle_2d_node_calculate(engine_physics_node_base_t *physics_node_base, float scale_x, float scale_y, float *vertices_x, float *vertices_y, float *normals_x, float *normals_y, float rotation);
 
 void physics_rectangle_2d_node_class_draw(mp_obj_t rectangle_node_base_obj, mp_obj_t camera_node);
+bool physics_rectangle_2d_node_class_get_bounds(mp_obj_t rectangle_node_base_obj, mp_obj_t camera_node, engine_display_rect_t *bounds);
 
 #endif  // PHYSICS_RECTANGLE_2D_NODE_H
\ No newline at end of file
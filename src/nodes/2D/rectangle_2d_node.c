@@ -25,7 +25,7 @@ void rectangle_2d_node_class_draw(mp_obj_t rectangle_node_base_obj, mp_obj_t cam
     engine_rectangle_2d_node_class_obj_t *rectangle_2d_node = rectangle_node_base->node;
 
     // Avoid drawing or doing anything if opacity is zero
-    float rectangle_opacity = mp_obj_get_float(rectangle_2d_node->opacity);
+    float rectangle_opacity = rectangle_2d_node->opacity;
     if(engine_math_compare_floats(rectangle_opacity, 0.0f)){
         return;
     }
@@ -36,8 +36,8 @@ void rectangle_2d_node_class_draw(mp_obj_t rectangle_node_base_obj, mp_obj_t cam
     bool rectangle_outlined = mp_obj_get_int(rectangle_2d_node->outline);
 
     rectangle_class_obj_t *camera_viewport = camera->viewport;
-    float camera_zoom = mp_obj_get_float(camera->zoom);
-    float camera_opacity = mp_obj_get_float(camera->opacity);
+    float camera_zoom = camera->zoom;
+    float camera_opacity = camera->opacity;
 
     // Get inherited properties
     engine_inheritable_2d_t inherited;
@@ -49,8 +49,8 @@ void rectangle_2d_node_class_draw(mp_obj_t rectangle_node_base_obj, mp_obj_t cam
         camera_zoom = 1.0f;
     }
 
-    inherited.px += camera_viewport->width/2;
-    inherited.py += camera_viewport->height/2;
+    inherited.px += camera_viewport->x + camera_viewport->width/2;
+    inherited.py += camera_viewport->y + camera_viewport->height/2;
 
     rectangle_opacity = inherited.opacity * camera_opacity;
 
@@ -102,6 +102,18 @@ void rectangle_2d_node_class_draw(mp_obj_t rectangle_node_base_obj, mp_obj_t cam
 }
 
 
+bool rectangle_2d_node_class_get_bounds(mp_obj_t rectangle_node_base_obj, mp_obj_t camera_node, engine_display_rect_t *bounds){
+    engine_node_base_t *rectangle_node_base = rectangle_node_base_obj;
+    engine_rectangle_2d_node_class_obj_t *rectangle_2d_node = rectangle_node_base->node;
+
+    float rectangle_half_width = mp_obj_get_float(rectangle_2d_node->width) * 0.5f;
+    float rectangle_half_height = mp_obj_get_float(rectangle_2d_node->height) * 0.5f;
+
+    engine_camera_get_bounds_2d(rectangle_node_base, camera_node, rectangle_half_width, rectangle_half_height, 0.0f, bounds);
+    return true;
+}
+
+
 // Return `true` if handled loading the attr from internal structure, `false` otherwise
 bool rectangle_2d_node_load_attr(engine_node_base_t *self_node_base, qstr attribute, mp_obj_t *destination){
     // Get the underlying structure
@@ -130,7 +142,7 @@ bool rectangle_2d_node_load_attr(engine_node_base_t *self_node_base, qstr attrib
             return true;
         break;
         case MP_QSTR_opacity:
-            destination[0] = self->opacity;
+            destination[0] = mp_obj_new_float(self->opacity);
             return true;
         break;
         case MP_QSTR_outline:
@@ -138,7 +150,7 @@ bool rectangle_2d_node_load_attr(engine_node_base_t *self_node_base, qstr attrib
             return true;
         break;
         case MP_QSTR_rotation:
-            destination[0] = self->rotation;
+            destination[0] = mp_obj_new_float(self->rotation);
             return true;
         break;
         case MP_QSTR_scale:
@@ -159,6 +171,7 @@ bool rectangle_2d_node_store_attr(engine_node_base_t *self_node_base, qstr attri
     switch(attribute){
         case MP_QSTR_tick:
             self->tick_cb = destination[1];
+            engine_set_object_ticking(self_node_base, self->tick_cb != mp_const_none);
             return true;
         break;
         case MP_QSTR_position:
@@ -178,7 +191,7 @@ bool rectangle_2d_node_store_attr(engine_node_base_t *self_node_base, qstr attri
             return true;
         break;
         case MP_QSTR_opacity:
-            self->opacity = destination[1];
+            self->opacity = mp_obj_get_float(destination[1]);
             return true;
         break;
         case MP_QSTR_outline:
@@ -186,7 +199,7 @@ bool rectangle_2d_node_store_attr(engine_node_base_t *self_node_base, qstr attri
             return true;
         break;
         case MP_QSTR_rotation:
-            self->rotation = destination[1];
+            self->rotation = mp_obj_get_float(destination[1]);
             return true;
         break;
         case MP_QSTR_scale:
@@ -235,7 +248,7 @@ static mp_attr_fun_t rectangle_2d_node_class_attr(mp_obj_t self_in, qstr attribu
     ATTR:   [type=function]                         [name={ref_link:get_parent}]                        [value=function]
     ATTR:   [type=function]                         [name={ref_link:tick}]                              [value=function]
     ATTR:   [type={ref_link:Vector2}]               [name=position]                                     [value={ref_link:Vector2}]
-    ATTR:   [type={ref_link:Vector2}]               [name=global_position]                              [value={ref_link:Vector2} (read-only)]
+    ATTR:   [type={ref_link:Vector2}]               [name=global_position]                              [value={ref_link:Vector2} (read-only, the same Vector2 is updated and returned on every access)]
     ATTR:   [type=float]                            [name=width]                                        [value=any]
     ATTR:   [type=float]                            [name=height]                                       [value=any]
     ATTR:   [type={ref_link:Color}|int (RGB565)]    [name=color]                                        [value=color]
@@ -302,9 +315,9 @@ mp_obj_t rectangle_2d_node_class_new(const mp_obj_type_t *type, size_t n_args, s
     rectangle_2d_node->width = parsed_args[width].u_obj;
     rectangle_2d_node->height = parsed_args[height].u_obj;
     rectangle_2d_node->color = engine_color_wrap(parsed_args[color].u_obj);
-    rectangle_2d_node->opacity = parsed_args[opacity].u_obj;
+    rectangle_2d_node->opacity = mp_obj_get_float(parsed_args[opacity].u_obj);
     rectangle_2d_node->outline = parsed_args[outline].u_obj;
-    rectangle_2d_node->rotation = parsed_args[rotation].u_obj;
+    rectangle_2d_node->rotation = mp_obj_get_float(parsed_args[rotation].u_obj);
     rectangle_2d_node->scale = parsed_args[scale].u_obj;
     node_base_set_inherit_position(node_base, parsed_args[inherit_position].u_bool);
     node_base_set_inherit_opacity(node_base, parsed_args[inherit_opacity].u_bool);
@@ -343,6 +356,8 @@ mp_obj_t rectangle_2d_node_class_new(const mp_obj_type_t *type, size_t n_args, s
         node_base->attr_accessor = node_instance;
     }
 
+    engine_set_object_ticking(node_base, rectangle_2d_node->tick_cb != mp_const_none);
+
     return MP_OBJ_FROM_PTR(node_base);
 }
 
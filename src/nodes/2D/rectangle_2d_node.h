@@ -3,6 +3,7 @@
 
 #include "py/obj.h"
 #include "nodes/node_base.h"
+#include "display/engine_display_common.h"
 
 // A basic 2d rectangle node
 typedef struct{
@@ -10,15 +11,16 @@ typedef struct{
     mp_obj_t width;     // Rectangle width in px
     mp_obj_t height;    // Rectangle height in px
     mp_obj_t color;     // The color of this rectangle
-    mp_obj_t opacity;
+    float opacity;
     mp_obj_t outline;   // bool: if true, rectangle drawn as outline, if false, drawn filled (false by default)
-    mp_obj_t rotation;  // Rectangle rotation in radians
+    float rotation;     // Rectangle rotation in radians
     mp_obj_t scale;     // Vector2: 2d scale of the rectangle
     mp_obj_t tick_cb;
 }engine_rectangle_2d_node_class_obj_t;
 
 extern const mp_obj_type_t engine_rectangle_2d_node_class_type;
 void rectangle_2d_node_class_draw(mp_obj_t rectangle_node_base_obj, mp_obj_t camera_node);
+bool rectangle_2d_node_class_get_bounds(mp_obj_t rectangle_node_base_obj, mp_obj_t camera_node, engine_display_rect_t *bounds);
 
 
 #endif  // RECTANGLE_2D_NODE_H
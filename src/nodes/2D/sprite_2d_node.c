@@ -14,23 +14,20 @@
 #include "utility/engine_time.h"
 #include "draw/engine_color.h"
 #include "draw/engine_shader.h"
+#include "display/engine_display_damage.h"
 #include "py/obj.h"
 
 
 void sprite_2d_node_clamp_current_x(engine_sprite_2d_node_class_obj_t *sprite){
-    uint16_t count_x = mp_obj_get_int(sprite->frame_count_x);
-    uint16_t current_x = mp_obj_get_int(sprite->frame_current_x);
-    if(current_x >= count_x){
-        sprite->frame_current_x = mp_obj_new_int(count_x-1);
+    if(sprite->frame_current_x >= sprite->frame_count_x){
+        sprite->frame_current_x = sprite->frame_count_x-1;
     }
 }
 
 
 void sprite_2d_node_clamp_current_y(engine_sprite_2d_node_class_obj_t *sprite){
-    uint16_t count_y = mp_obj_get_int(sprite->frame_count_y);
-    uint16_t current_y = mp_obj_get_int(sprite->frame_current_y);
-    if(current_y >= count_y){
-        sprite->frame_current_y = mp_obj_new_int(count_y-1);
+    if(sprite->frame_current_y >= sprite->frame_count_y){
+        sprite->frame_current_y = sprite->frame_count_y-1;
     }
 }
 
@@ -45,7 +42,7 @@ void sprite_2d_node_class_draw(mp_obj_t sprite_node_base_obj, mp_obj_t camera_no
     engine_sprite_2d_node_class_obj_t *sprite_2d_node = sprite_node_base->node;
 
     // Avoid drawing or doing anything if opacity is zero
-    float sprite_opacity = mp_obj_get_float(sprite_2d_node->opacity);
+    float sprite_opacity = sprite_2d_node->opacity;
     if(engine_math_compare_floats(sprite_opacity, 0.0f)){
         return;
     }
@@ -57,15 +54,13 @@ void sprite_2d_node_class_draw(mp_obj_t sprite_node_base_obj, mp_obj_t camera_no
     texture_resource_class_obj_t *sprite_texture = sprite_2d_node->texture_resource;
 
     rectangle_class_obj_t *camera_viewport = camera->viewport;
-    float camera_zoom = mp_obj_get_float(camera->zoom);
-    float camera_opacity = mp_obj_get_float(camera->opacity);
+    float camera_zoom = camera->zoom;
+    float camera_opacity = camera->opacity;
 
-    uint16_t sprite_frame_count_x = mp_obj_get_int(sprite_2d_node->frame_count_x);
-    uint16_t sprite_frame_count_y = mp_obj_get_int(sprite_2d_node->frame_count_y);
-    uint16_t sprite_frame_current_x = mp_obj_get_int(sprite_2d_node->frame_current_x);
-    uint16_t sprite_frame_current_y = mp_obj_get_int(sprite_2d_node->frame_current_y);
-    bool sprite_playing = mp_obj_get_int(sprite_2d_node->playing);
-    bool sprite_looping = mp_obj_get_int(sprite_2d_node->loop);
+    uint16_t sprite_frame_count_x = sprite_2d_node->frame_count_x;
+    uint16_t sprite_frame_count_y = sprite_2d_node->frame_count_y;
+    uint16_t sprite_frame_current_x = sprite_2d_node->frame_current_x;
+    uint16_t sprite_frame_current_y = sprite_2d_node->frame_current_y;
 
     color_class_obj_t *transparent_color = sprite_2d_node->transparent_color;
     uint32_t spritesheet_width = sprite_texture->width;
@@ -87,8 +82,8 @@ void sprite_2d_node_class_draw(mp_obj_t sprite_node_base_obj, mp_obj_t camera_no
         camera_zoom = 1.0f;
     }
 
-    inherited.px += camera_viewport->width/2;
-    inherited.py += camera_viewport->height/2;
+    inherited.px += camera_viewport->x + camera_viewport->width/2;
+    inherited.py += camera_viewport->y + camera_viewport->height/2;
 
     sprite_opacity = inherited.opacity*camera_opacity;
 
@@ -110,10 +105,45 @@ void sprite_2d_node_class_draw(mp_obj_t sprite_node_base_obj, mp_obj_t camera_no
                      transparent_color->value,
                      sprite_opacity,
                      shader);
+}
+
+
+bool sprite_2d_node_class_get_bounds(mp_obj_t sprite_node_base_obj, mp_obj_t camera_node, engine_display_rect_t *bounds){
+    engine_node_base_t *sprite_node_base = sprite_node_base_obj;
+    engine_sprite_2d_node_class_obj_t *sprite_2d_node = sprite_node_base->node;
+
+    if(sprite_2d_node->texture_resource == mp_const_none){
+        return false;
+    }
+
+    texture_resource_class_obj_t *sprite_texture = sprite_2d_node->texture_resource;
+    float half_frame_width = (sprite_texture->width/sprite_2d_node->frame_count_x) * 0.5f;
+    float half_frame_height = (sprite_texture->height/sprite_2d_node->frame_count_y) * 0.5f;
+
+    engine_camera_get_bounds_2d(sprite_node_base, camera_node, half_frame_width, half_frame_height, 0.0f, bounds);
+    return true;
+}
+
 
-    // After drawing, go to the next frame if it is time to and the animation is playing
+void sprite_2d_node_class_step_animation(mp_obj_t sprite_node_base_obj){
+    engine_node_base_t *sprite_node_base = sprite_node_base_obj;
+    engine_sprite_2d_node_class_obj_t *sprite_2d_node = sprite_node_base->node;
+
+    // Sprites that aren't drawn don't play their animation either
+    if(engine_math_compare_floats(sprite_2d_node->opacity, 0.0f) || sprite_2d_node->texture_resource == mp_const_none){
+        return;
+    }
+
+    uint16_t sprite_frame_count_x = sprite_2d_node->frame_count_x;
+    uint16_t sprite_frame_count_y = sprite_2d_node->frame_count_y;
+    uint16_t sprite_frame_current_x = sprite_2d_node->frame_current_x;
+    uint16_t sprite_frame_current_y = sprite_2d_node->frame_current_y;
+    bool sprite_playing = sprite_2d_node->playing;
+    bool sprite_looping = sprite_2d_node->loop;
+
+    // Go to the next frame if it is time to and the animation is playing
     if(sprite_playing == true){
-        float sprite_fps = mp_obj_get_float(mp_load_attr(sprite_node_base->attr_accessor, MP_QSTR_fps));
+        float sprite_fps = sprite_2d_node->fps;
         uint16_t sprite_period = (uint16_t)((1.0f/sprite_fps) * 1000.0f);
 
         uint32_t current_ms_time = millis();
@@ -133,7 +163,7 @@ void sprite_2d_node_class_draw(mp_obj_t sprite_node_base_obj, mp_obj_t camera_no
                 sprite_frame_current_y = 0;
 
                 if(sprite_looping == false){
-                    mp_store_attr(sprite_node_base->attr_accessor, MP_QSTR_playing, mp_obj_new_bool(false));
+                    sprite_2d_node->playing = false;
 
                     // Reached the end and looping is false, do not increment frame
                     increment_frame = false;
@@ -143,8 +173,8 @@ void sprite_2d_node_class_draw(mp_obj_t sprite_node_base_obj, mp_obj_t camera_no
             // Update/store the current frame index only if looping
             // so that we stay on the last from when loop ends
             if(increment_frame){
-                mp_store_attr(sprite_node_base->attr_accessor, MP_QSTR_frame_current_x, mp_obj_new_int(sprite_frame_current_x));
-                mp_store_attr(sprite_node_base->attr_accessor, MP_QSTR_frame_current_y, mp_obj_new_int(sprite_frame_current_y));
+                sprite_2d_node->frame_current_x = sprite_frame_current_x;
+                sprite_2d_node->frame_current_y = sprite_frame_current_y;
             }
 
             sprite_2d_node->time_at_last_animation_update_ms = millis();
@@ -153,6 +183,15 @@ void sprite_2d_node_class_draw(mp_obj_t sprite_node_base_obj, mp_obj_t camera_no
 }
 
 
+void sprite_2d_node_class_animate(mp_obj_t sprite_node_base_obj){
+    // With damage tracking the draw callbacks can run twice per
+    // frame, only step the animation in the pass that always runs
+    if(engine_display_damage_is_enabled() == false || engine_display_damage_is_recording()){
+        sprite_2d_node_class_step_animation(sprite_node_base_obj);
+    }
+}
+
+
 // Return `true` if handled loading the attr from internal structure, `false` otherwise
 bool sprite_2d_node_load_attr(engine_node_base_t *self_node_base, qstr attribute, mp_obj_t *destination){
     // Get the underlying structure
@@ -177,19 +216,19 @@ bool sprite_2d_node_load_attr(engine_node_base_t *self_node_base, qstr attribute
             return true;
         break;
         case MP_QSTR_fps:
-            destination[0] = self->fps;
+            destination[0] = mp_obj_new_float(self->fps);
             return true;
         break;
         case MP_QSTR_frame_count_x:
-            destination[0] = self->frame_count_x;
+            destination[0] = mp_obj_new_int(self->frame_count_x);
             return true;
         break;
         case MP_QSTR_frame_count_y:
-            destination[0] = self->frame_count_y;
+            destination[0] = mp_obj_new_int(self->frame_count_y);
             return true;
         break;
         case MP_QSTR_rotation:
-            destination[0] = self->rotation;
+            destination[0] = mp_obj_new_float(self->rotation);
             return true;
         break;
         case MP_QSTR_scale:
@@ -197,23 +236,23 @@ bool sprite_2d_node_load_attr(engine_node_base_t *self_node_base, qstr attribute
             return true;
         break;
         case MP_QSTR_opacity:
-            destination[0] = self->opacity;
+            destination[0] = mp_obj_new_float(self->opacity);
             return true;
         break;
         case MP_QSTR_playing:
-            destination[0] = self->playing;
+            destination[0] = mp_obj_new_bool(self->playing);
             return true;
         break;
         case MP_QSTR_loop:
-            destination[0] = self->loop;
+            destination[0] = mp_obj_new_bool(self->loop);
             return true;
         break;
         case MP_QSTR_frame_current_x:
-            destination[0] = self->frame_current_x;
+            destination[0] = mp_obj_new_int(self->frame_current_x);
             return true;
         break;
         case MP_QSTR_frame_current_y:
-            destination[0] = self->frame_current_y;
+            destination[0] = mp_obj_new_int(self->frame_current_y);
             return true;
         break;
         default:
@@ -230,6 +269,7 @@ bool sprite_2d_node_store_attr(engine_node_base_t *self_node_base, qstr attribut
     switch(attribute){
         case MP_QSTR_tick:
             self->tick_cb = destination[1];
+            engine_set_object_ticking(self_node_base, self->tick_cb != mp_const_none);
             return true;
         break;
         case MP_QSTR_position:
@@ -245,25 +285,25 @@ bool sprite_2d_node_store_attr(engine_node_base_t *self_node_base, qstr attribut
             return true;
         break;
         case MP_QSTR_fps:
-            self->fps = destination[1];
+            self->fps = mp_obj_get_float(destination[1]);
             return true;
         break;
         case MP_QSTR_frame_count_x:
         {
-            self->frame_count_x = destination[1];
+            self->frame_count_x = mp_obj_get_int(destination[1]);
             sprite_2d_node_clamp_current_x(self);
             return true;
         }
         break;
         case MP_QSTR_frame_count_y:
         {
-            self->frame_count_y = destination[1];
+            self->frame_count_y = mp_obj_get_int(destination[1]);
             sprite_2d_node_clamp_current_y(self);
             return true;
         }
         break;
         case MP_QSTR_rotation:
-            self->rotation = destination[1];
+            self->rotation = mp_obj_get_float(destination[1]);
             return true;
         break;
         case MP_QSTR_scale:
@@ -271,27 +311,27 @@ bool sprite_2d_node_store_attr(engine_node_base_t *self_node_base, qstr attribut
             return true;
         break;
         case MP_QSTR_opacity:
-            self->opacity = destination[1];
+            self->opacity = mp_obj_get_float(destination[1]);
             return true;
         break;
         case MP_QSTR_playing:
-            self->playing = destination[1];
+            self->playing = mp_obj_is_true(destination[1]);
             return true;
         break;
         case MP_QSTR_loop:
-            self->loop = destination[1];
+            self->loop = mp_obj_is_true(destination[1]);
             return true;
         break;
         case MP_QSTR_frame_current_x:
         {
-            self->frame_current_x = destination[1];
+            self->frame_current_x = mp_obj_get_int(destination[1]);
             sprite_2d_node_clamp_current_x(self);
             return true;
         }
         break;
         case MP_QSTR_frame_current_y:
         {
-            self->frame_current_y = destination[1];
+            self->frame_current_y = mp_obj_get_int(destination[1]);
             sprite_2d_node_clamp_current_y(self);
             return true;
         }
@@ -340,7 +380,7 @@ static mp_attr_fun_t sprite_2d_node_class_attr(mp_obj_t self_in, qstr attribute,
     ATTR:   [type=function]                         [name={ref_link:get_parent}]                        [value=function]
     ATTR:   [type=function]                         [name={ref_link:tick}]                              [value=function]
     ATTR:   [type={ref_link:Vector2}]               [name=position]                                     [value={ref_link:Vector2}]
-    ATTR:   [type={ref_link:Vector2}]               [name=global_position]                              [value={ref_link:Vector2} (read-only)]
+    ATTR:   [type={ref_link:Vector2}]               [name=global_position]                              [value={ref_link:Vector2} (read-only, the same Vector2 is updated and returned on every access)]
     ATTR:   [type={ref_link:TextureResource}]       [name=texture]                                      [value={ref_link:TextureResource}]
     ATTR:   [type={ref_link:Color}|int (RGB565)]    [name=transparent_color]                            [value=color]
     ATTR:   [type=float]                            [name=fps]                                          [value=any]
@@ -415,21 +455,21 @@ mp_obj_t sprite_2d_node_class_new(const mp_obj_type_t *type, size_t n_args, size
     sprite_2d_node->position = parsed_args[position].u_obj;
     sprite_2d_node->texture_resource = parsed_args[texture].u_obj;
     sprite_2d_node->transparent_color = engine_color_wrap(parsed_args[transparent_color].u_obj);
-    sprite_2d_node->fps = parsed_args[fps].u_obj;
-    sprite_2d_node->frame_count_x = parsed_args[frame_count_x].u_obj;
-    sprite_2d_node->frame_count_y = parsed_args[frame_count_y].u_obj;
-    sprite_2d_node->rotation = parsed_args[rotation].u_obj;
+    sprite_2d_node->fps = mp_obj_get_float(parsed_args[fps].u_obj);
+    sprite_2d_node->frame_count_x = mp_obj_get_int(parsed_args[frame_count_x].u_obj);
+    sprite_2d_node->frame_count_y = mp_obj_get_int(parsed_args[frame_count_y].u_obj);
+    sprite_2d_node->rotation = mp_obj_get_float(parsed_args[rotation].u_obj);
     sprite_2d_node->scale = parsed_args[scale].u_obj;
-    sprite_2d_node->opacity = parsed_args[opacity].u_obj;
-    sprite_2d_node->playing = parsed_args[playing].u_obj;
-    sprite_2d_node->loop = parsed_args[loop].u_obj;
+    sprite_2d_node->opacity = mp_obj_get_float(parsed_args[opacity].u_obj);
+    sprite_2d_node->playing = mp_obj_is_true(parsed_args[playing].u_obj);
+    sprite_2d_node->loop = mp_obj_is_true(parsed_args[loop].u_obj);
     node_base_set_inherit_position(node_base, parsed_args[inherit_position].u_bool);
     node_base_set_inherit_opacity(node_base, parsed_args[inherit_opacity].u_bool);
     node_base_set_inherit_rotation(node_base, parsed_args[inherit_rotation].u_bool);
     node_base_set_inherit_scale(node_base, parsed_args[inherit_scale].u_bool);
 
-    sprite_2d_node->frame_current_x = mp_obj_new_int(0);
-    sprite_2d_node->frame_current_y = mp_obj_new_int(0);
+    sprite_2d_node->frame_current_x = 0;
+    sprite_2d_node->frame_current_y = 0;
 
     if(inherited == true){  // Inherited (use existing object)
         // Get the Python class instance
@@ -463,6 +503,8 @@ mp_obj_t sprite_2d_node_class_new(const mp_obj_type_t *type, size_t n_args, size
         node_base->attr_accessor = node_instance;
     }
 
+    engine_set_object_ticking(node_base, sprite_2d_node->tick_cb != mp_const_none);
+
     return MP_OBJ_FROM_PTR(node_base);
 }
 
@@ -3,27 +3,35 @@
 
 #include "py/obj.h"
 #include "nodes/node_base.h"
+#include "display/engine_display_common.h"
 
 // A basic 2d sprite node
 typedef struct{
     mp_obj_t position;              // Vector2: 2d xy position of this node
     mp_obj_t texture_resource;      // TextureResource
     mp_obj_t transparent_color;     // 16-bit integer representing which exact color in the BMP to not render
-    mp_obj_t fps;                   // How many frames per second the sprite should play its animation (if possible)
-    mp_obj_t frame_count_x;
-    mp_obj_t frame_count_y;
-    mp_obj_t frame_current_x;
-    mp_obj_t frame_current_y;
-    mp_obj_t rotation;              // Rotation about into screen/z-axis in degrees
+    float fps;                      // How many frames per second the sprite should play its animation (if possible)
+    uint16_t frame_count_x;
+    uint16_t frame_count_y;
+    uint16_t frame_current_x;
+    uint16_t frame_current_y;
+    float rotation;                 // Rotation about into screen/z-axis in degrees
     mp_obj_t scale;                 // Vector2
-    mp_obj_t opacity;
-    mp_obj_t playing;               // Bool: is the animation running or not
-    mp_obj_t loop;
+    float opacity;
+    bool playing;                   // Bool: is the animation running or not
+    bool loop;
     mp_obj_t tick_cb;
     uint32_t time_at_last_animation_update_ms;
 }engine_sprite_2d_node_class_obj_t;
 
 extern const mp_obj_type_t engine_sprite_2d_node_class_type;
 void sprite_2d_node_class_draw(mp_obj_t sprite_node_base_obj, mp_obj_t camera_node);
+bool sprite_2d_node_class_get_bounds(mp_obj_t sprite_node_base_obj, mp_obj_t camera_node, engine_display_rect_t *bounds);
+
+// Steps the animation, called once per frame after drawing
+void sprite_2d_node_class_animate(mp_obj_t sprite_node_base_obj);
+
+// Goes to the next frame if it's time to, no matter which draw pass this is
+void sprite_2d_node_class_step_animation(mp_obj_t sprite_node_base_obj);
 
 #endif  // SPRITE_2D_NODE_H
\ No newline at end of file
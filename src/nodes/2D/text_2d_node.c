@@ -31,7 +31,7 @@ void text_2d_node_class_draw(mp_obj_t text_2d_node_base_obj, mp_obj_t camera_nod
         return;
     }
 
-    float text_opacity = mp_obj_get_float(text_2d_node->opacity);
+    float text_opacity = text_2d_node->opacity;
 
     // Avoid drawing or doing anything if opacity is zero
     if(engine_math_compare_floats(text_opacity, 0.0f)){
@@ -47,8 +47,8 @@ void text_2d_node_class_draw(mp_obj_t text_2d_node_base_obj, mp_obj_t camera_nod
     engine_camera_node_class_obj_t *camera = camera_node_base->node;
 
     rectangle_class_obj_t *camera_viewport = camera->viewport;
-    float camera_zoom = mp_obj_get_float(camera->zoom);
-    float camera_opacity = mp_obj_get_float(camera->opacity);
+    float camera_zoom = camera->zoom;
+    float camera_opacity = camera->opacity;
 
     // Get inherited properties
     engine_inheritable_2d_t inherited;
@@ -60,8 +60,8 @@ void text_2d_node_class_draw(mp_obj_t text_2d_node_base_obj, mp_obj_t camera_nod
         camera_zoom = 1.0f;
     }
 
-    inherited.px += camera_viewport->width/2;
-    inherited.py += camera_viewport->height/2;
+    inherited.px += camera_viewport->x + camera_viewport->width/2;
+    inherited.py += camera_viewport->y + camera_viewport->height/2;
 
     text_opacity = inherited.opacity*camera_opacity;
 
@@ -73,13 +73,7 @@ void text_2d_node_class_draw(mp_obj_t text_2d_node_base_obj, mp_obj_t camera_nod
 
     if(text_color != mp_const_none){
         text_shader = engine_get_builtin_shader(BLEND_OPACITY_SHADER);
-
-        float t = 1.0f;
-
-        text_shader->program[1] = (text_color->value >> 8) & 0b11111111;
-        text_shader->program[2] = (text_color->value >> 0) & 0b11111111;
-
-        memcpy(text_shader->program+3, &t, sizeof(float));
+        engine_shader_set_interpolate(text_shader, text_color->value, 1.0f);
     }else if(text_opacity < 1.0f || text_font->texture_resource->alpha_mask != 0){
         text_shader = engine_get_builtin_shader(OPACITY_SHADER);   
     }else{
@@ -96,6 +90,24 @@ void text_2d_node_class_draw(mp_obj_t text_2d_node_base_obj, mp_obj_t camera_nod
 }
 
 
+bool text_2d_node_class_get_bounds(mp_obj_t text_2d_node_base_obj, mp_obj_t camera_node, engine_display_rect_t *bounds){
+    engine_node_base_t *text_2d_node_base = text_2d_node_base_obj;
+    engine_text_2d_node_class_obj_t *text_2d_node = text_2d_node_base->node;
+
+    if(text_2d_node->font_resource == mp_const_none){
+        return false;
+    }
+
+    // Padded by a glyph for letter spacing and rounding
+    font_resource_class_obj_t *text_font = text_2d_node->font_resource;
+    float text_box_half_width = mp_obj_get_float(text_2d_node->width) * 0.5f + text_font->glyph_height;
+    float text_box_half_height = mp_obj_get_float(text_2d_node->height) * 0.5f + text_font->glyph_height;
+
+    engine_camera_get_bounds_2d(text_2d_node_base, camera_node, text_box_half_width, text_box_half_height, 0.0f, bounds);
+    return true;
+}
+
+
 // `native`     == instance of this built-in type (`Text2DNode`)
 // `not native` == instance of a Python class that inherits this built-in type (`Text2DNode`)
 static void text_2d_node_class_calculate_dimensions(engine_text_2d_node_class_obj_t *text_2d_node){
@@ -142,7 +154,7 @@ bool text_2d_node_load_attr(engine_node_base_t *self_node_base, qstr attribute,
             return true;
         break;
         case MP_QSTR_rotation:
-            destination[0] = self->rotation;
+            destination[0] = mp_obj_new_float(self->rotation);
             return true;
         break;
         case MP_QSTR_scale:
@@ -150,7 +162,7 @@ bool text_2d_node_load_attr(engine_node_base_t *self_node_base, qstr attribute,
             return true;
         break;
         case MP_QSTR_opacity:
-            destination[0] = self->opacity;
+            destination[0] = mp_obj_new_float(self->opacity);
             return true;
         break;
         case MP_QSTR_letter_spacing:
@@ -187,6 +199,7 @@ bool text_2d_node_store_attr(engine_node_base_t *self_node_base, qstr attribute,
     switch(attribute){
         case MP_QSTR_tick:
             self->tick_cb = destination[1];
+            engine_set_object_ticking(self_node_base, self->tick_cb != mp_const_none);
             return true;
         break;
         case MP_QSTR_position:
@@ -204,7 +217,7 @@ bool text_2d_node_store_attr(engine_node_base_t *self_node_base, qstr attribute,
             return true;
         break;
         case MP_QSTR_rotation:
-            self->rotation = destination[1];
+            self->rotation = mp_obj_get_float(destination[1]);
             return true;
         break;
         case MP_QSTR_scale:
@@ -212,7 +225,7 @@ bool text_2d_node_store_attr(engine_node_base_t *self_node_base, qstr attribute,
             return true;
         break;
         case MP_QSTR_opacity:
-            self->opacity = destination[1];
+            self->opacity = mp_obj_get_float(destination[1]);
             return true;
         break;
         case MP_QSTR_letter_spacing:
@@ -280,7 +293,7 @@ static mp_attr_fun_t text_2d_node_class_attr(mp_obj_t self_in, qstr attribute, m
     ATTR:   [type=float]                            [name=width]                                        [value=any (read-only)]
     ATTR:   [type=float]                            [name=height]                                       [value=any (read-only)]
     ATTR:   [type={ref_link:Vector2}]               [name=position]                                     [value={ref_link:Vector2}]
-    ATTR:   [type={ref_link:Vector2}]               [name=global_position]                              [value={ref_link:Vector2} (read-only)]
+    ATTR:   [type={ref_link:Vector2}]               [name=global_position]                              [value={ref_link:Vector2} (read-only, the same Vector2 is updated and returned on every access)]
     ATTR:   [type={ref_link:FontResource}]          [name=font]                                         [value={ref_link:FontResource}]
     ATTR:   [type=string]                           [name=text]                                         [value=any]
     ATTR:   [type=float]                            [name=rotation]                                     [value=any (radians)]
@@ -348,9 +361,9 @@ mp_obj_t text_2d_node_class_new(const mp_obj_type_t *type, size_t n_args, size_t
     text_2d_node->position = parsed_args[position].u_obj;
     text_2d_node->font_resource = parsed_args[font].u_obj;
     text_2d_node->text = parsed_args[text].u_obj;
-    text_2d_node->rotation = parsed_args[rotation].u_obj;
+    text_2d_node->rotation = mp_obj_get_float(parsed_args[rotation].u_obj);
     text_2d_node->scale = parsed_args[scale].u_obj;
-    text_2d_node->opacity = parsed_args[opacity].u_obj;
+    text_2d_node->opacity = mp_obj_get_float(parsed_args[opacity].u_obj);
     text_2d_node->letter_spacing = parsed_args[letter_spacing].u_obj;
     text_2d_node->line_spacing = parsed_args[line_spacing].u_obj;
     text_2d_node->color = engine_color_wrap_opt(parsed_args[color].u_obj);
@@ -396,6 +409,8 @@ mp_obj_t text_2d_node_class_new(const mp_obj_type_t *type, size_t n_args, size_t
         node_base->attr_accessor = node_instance;
     }
 
+    engine_set_object_ticking(node_base, text_2d_node->tick_cb != mp_const_none);
+
     return MP_OBJ_FROM_PTR(node_base);
 }
 
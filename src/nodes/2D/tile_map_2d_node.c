@@ -0,0 +1,629 @@
+#include "tile_map_2d_node.h"
+
+#include "nodes/node_types.h"
+#include "debug/debug_print.h"
+#include "engine_object_layers.h"
+#include "nodes/3D/camera_node.h"
+#include "math/vector2.h"
+#include "math/rectangle.h"
+#include "draw/engine_display_draw.h"
+#include "resources/engine_texture_resource.h"
+#include "math/engine_math.h"
+#include "utility/engine_time.h"
+#include "draw/engine_color.h"
+#include "draw/engine_shader.h"
+#include "py/objarray.h"
+#include "py/obj.h"
+
+#include <math.h>
+
+
+// Everything in the draw loop only reads these through the
+// node, setting them checks they make sense once instead
+static void tile_map_2d_node_check_tiles(mp_obj_t tiles, mp_obj_t flips){
+    if(tiles != mp_const_none && mp_obj_is_type(tiles, &mp_type_bytearray) == false){
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("TileMap2DNode: ERROR: `tiles` must be a bytearray or None"));
+    }
+
+    if(flips == mp_const_none){
+        return;
+    }
+
+    if(mp_obj_is_type(flips, &mp_type_bytearray) == false){
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("TileMap2DNode: ERROR: `flips` must be a bytearray or None"));
+    }
+
+    if(tiles == mp_const_none || ((mp_obj_array_t*)flips)->len != ((mp_obj_array_t*)tiles)->len){
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("TileMap2DNode: ERROR: `flips` must be the same length as `tiles` (set it to None first when changing both)"));
+    }
+}
+
+
+static uint16_t tile_map_2d_node_get_size(mp_obj_t size){
+    mp_int_t value = mp_obj_get_int(size);
+
+    if(value < 1 || value > UINT16_MAX){
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("TileMap2DNode: ERROR: Tile and map sizes must be from 1 to 65535"));
+    }
+
+    return value;
+}
+
+
+static void tile_map_2d_node_set_animations(engine_tile_map_2d_node_class_obj_t *tile_map, mp_obj_t animations){
+    tile_map_2d_animation_t ranges[TILE_MAP_2D_MAX_ANIMATIONS];
+    size_t range_count = 0;
+
+    if(animations != mp_const_none){
+        mp_obj_t *items;
+        mp_obj_get_array(animations, &range_count, &items);
+
+        if(range_count > TILE_MAP_2D_MAX_ANIMATIONS){
+            mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("TileMap2DNode: ERROR: Too many animated tile ranges, up to 16 are supported"));
+        }
+
+        for(size_t index=0; index<range_count; index++){
+            mp_obj_t *range;
+            mp_obj_get_array_fixed_n(items[index], 3, &range);
+
+            mp_int_t first = mp_obj_get_int(range[0]);
+            mp_int_t count = mp_obj_get_int(range[1]);
+            float fps = mp_obj_get_float(range[2]);
+
+            if(first < 0 || count < 1 || first + count > TILE_MAP_2D_EMPTY){
+                mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("TileMap2DNode: ERROR: Animated tiles must be from 0 to 254"));
+            }
+
+            if(fps <= 0.0f){
+                mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("TileMap2DNode: ERROR: Animated tile fps must be more than 0"));
+            }
+
+            ranges[index].first = first;
+            ranges[index].count = count;
+            ranges[index].period_ms = MAX(1, (uint32_t)(1000.0f / fps));
+        }
+    }
+
+    for(size_t index=0; index<range_count; index++){
+        tile_map->animation_ranges[index] = ranges[index];
+    }
+
+    tile_map->animation_count = range_count;
+    tile_map->animations = animations;
+}
+
+
+void tile_map_2d_node_class_draw(mp_obj_t tile_map_node_base_obj, mp_obj_t camera_node){
+    ENGINE_INFO_PRINTF("TileMap2DNode: Drawing");
+
+    engine_node_base_t *tile_map_node_base = tile_map_node_base_obj;
+    engine_node_base_t *camera_node_base = camera_node;
+    engine_camera_node_class_obj_t *camera = camera_node_base->node;
+
+    engine_tile_map_2d_node_class_obj_t *tile_map = tile_map_node_base->node;
+
+    // Avoid drawing or doing anything if opacity is zero
+    float tile_map_opacity = tile_map->opacity;
+    if(engine_math_compare_floats(tile_map_opacity, 0.0f)){
+        return;
+    }
+
+    if(tile_map->tileset == mp_const_none || tile_map->tiles == mp_const_none){
+        return;
+    }
+
+    texture_resource_class_obj_t *tileset = tile_map->tileset;
+    mp_obj_array_t *tiles = tile_map->tiles;
+    const uint8_t *tile_flips = (tile_map->flips == mp_const_none) ? NULL : ((mp_obj_array_t*)tile_map->flips)->items;
+
+    int32_t tile_width = tile_map->tile_width;
+    int32_t tile_height = tile_map->tile_height;
+    int32_t map_width = tile_map->map_width;
+    int32_t map_height = tiles->len / map_width;
+
+    uint32_t tileset_columns = tileset->width / tile_width;
+    uint32_t tileset_count = tileset_columns * (tileset->height / tile_height);
+
+    if(map_height == 0 || tileset_count == 0){
+        return;
+    }
+
+    rectangle_class_obj_t *camera_viewport = camera->viewport;
+    float camera_zoom = camera->zoom;
+    float camera_opacity = camera->opacity;
+
+    color_class_obj_t *transparent_color = tile_map->transparent_color;
+
+    // Get inherited properties
+    engine_inheritable_2d_t inherited;
+    node_base_inherit_2d(tile_map_node_base, &inherited);
+
+    if(inherited.is_camera_child == false){
+        engine_camera_transform_2d(camera_node, &inherited.px, &inherited.py, &inherited.rotation);
+    }else{
+        camera_zoom = 1.0f;
+    }
+
+    inherited.px += camera_viewport->x + camera_viewport->width/2;
+    inherited.py += camera_viewport->y + camera_viewport->height/2;
+
+    tile_map_opacity = inherited.opacity*camera_opacity;
+
+    float scale_x = inherited.sx*camera_zoom;
+    float scale_y = inherited.sy*camera_zoom;
+
+    if(engine_math_compare_floats(scale_x, 0.0f) || engine_math_compare_floats(scale_y, 0.0f)){
+        return;
+    }
+
+    // Decide which shader to use per-pixel
+    engine_shader_t *shader = NULL;
+    if(tile_map_opacity < 1.0f || tileset->alpha_mask != 0){
+        shader = engine_get_builtin_shader(OPACITY_SHADER);
+    }else{
+        shader = engine_get_builtin_shader(EMPTY_SHADER);
+    }
+
+    float half_map_width = map_width * tile_width * 0.5f;
+    float half_map_height = map_height * tile_height * 0.5f;
+
+    float sin_rotation = sinf(inherited.rotation);
+    float cos_rotation = cosf(inherited.rotation);
+
+    // Only the tiles under the camera's viewport are gone through. Move
+    // its corners into the map (same rotation as children get, see
+    // `engine_math_rotate_point`, undone) to find which those are
+    float corners[4][2] = {
+        {camera_viewport->x,                            camera_viewport->y},
+        {camera_viewport->x + camera_viewport->width,   camera_viewport->y},
+        {camera_viewport->x,                            camera_viewport->y + camera_viewport->height},
+        {camera_viewport->x + camera_viewport->width,   camera_viewport->y + camera_viewport->height},
+    };
+
+    float map_x0 = INFINITY;
+    float map_y0 = INFINITY;
+    float map_x1 = -INFINITY;
+    float map_y1 = -INFINITY;
+
+    for(uint8_t index=0; index<4; index++){
+        float dx = corners[index][0] - inherited.px;
+        float dy = corners[index][1] - inherited.py;
+
+        float map_x = (dx * cos_rotation - dy * sin_rotation) / scale_x + half_map_width;
+        float map_y = (dx * sin_rotation + dy * cos_rotation) / scale_y + half_map_height;
+
+        map_x0 = fminf(map_x0, map_x);
+        map_y0 = fminf(map_y0, map_y);
+        map_x1 = fmaxf(map_x1, map_x);
+        map_y1 = fmaxf(map_y1, map_y);
+    }
+
+    int32_t column_start = (int32_t)engine_math_clamp(floorf(map_x0 / tile_width), 0, map_width);
+    int32_t column_end = (int32_t)engine_math_clamp(floorf(map_x1 / tile_width) + 1, 0, map_width);
+    int32_t row_start = (int32_t)engine_math_clamp(floorf(map_y0 / tile_height), 0, map_height);
+    int32_t row_end = (int32_t)engine_math_clamp(floorf(map_y1 / tile_height) + 1, 0, map_height);
+
+    // Which tile each index shows right now, only
+    // made if some of them are animated
+    uint8_t animated[256];
+
+    if(tile_map->animation_count > 0){
+        for(uint16_t index=0; index<256; index++){
+            animated[index] = index;
+        }
+
+        uint32_t current_ms_time = millis();
+
+        for(uint8_t index=0; index<tile_map->animation_count; index++){
+            tile_map_2d_animation_t *range = &tile_map->animation_ranges[index];
+            uint32_t frame = (current_ms_time / range->period_ms) % range->count;
+
+            for(uint8_t tile=0; tile<range->count; tile++){
+                animated[range->first + tile] = range->first + (tile + frame) % range->count;
+            }
+        }
+    }
+
+    // Without rotation or scale each tile lands on whole pixels and
+    // can be copied a row at a time, otherwise each is blitted
+    bool axis_aligned = (sin_rotation == 0.0f && cos_rotation == 1.0f && scale_x == 1.0f && scale_y == 1.0f);
+
+    int32_t map_left = (int32_t)floorf(inherited.px - half_map_width);
+    int32_t map_top = (int32_t)floorf(inherited.py - half_map_height);
+
+    uint16_t transparent = transparent_color->value;
+
+    for(int32_t row=row_start; row<row_end; row++){
+        const uint8_t *row_tiles = tiles->items + row * map_width;
+
+        for(int32_t column=column_start; column<column_end; column++){
+            uint8_t tile = row_tiles[column];
+
+            if(tile == TILE_MAP_2D_EMPTY){
+                continue;
+            }
+
+            if(tile_map->animation_count > 0){
+                tile = animated[tile];
+            }
+
+            if(tile >= tileset_count){
+                continue;
+            }
+
+            uint32_t offset = (tile / tileset_columns) * tile_height * tileset->pixel_stride + (tile % tileset_columns) * tile_width;
+            uint8_t flips = (tile_flips == NULL) ? 0 : tile_flips[row * map_width + column];
+            bool flip_x = flips & TILE_MAP_2D_FLIP_X;
+            bool flip_y = flips & TILE_MAP_2D_FLIP_Y;
+
+            if(axis_aligned){
+                engine_draw_tile(tileset, offset,
+                                 map_left + column * tile_width, map_top + row * tile_height,
+                                 tile_width, tile_height,
+                                 tileset->pixel_stride,
+                                 flip_x, flip_y,
+                                 transparent,
+                                 tile_map_opacity,
+                                 shader);
+            }else{
+                // Center of the tile placed the same way a child node would be
+                float tile_x = ((column + 0.5f) * tile_width - half_map_width) * scale_x;
+                float tile_y = ((row + 0.5f) * tile_height - half_map_height) * scale_y;
+
+                engine_draw_blit(tileset, offset,
+                                 floorf(inherited.px + tile_x * cos_rotation + tile_y * sin_rotation),
+                                 floorf(inherited.py - tile_x * sin_rotation + tile_y * cos_rotation),
+                                 tile_width, tile_height,
+                                 tileset->pixel_stride,
+                                 flip_x ? -scale_x : scale_x,
+                                 flip_y ? -scale_y : scale_y,
+                                -inherited.rotation,
+                                 transparent,
+                                 tile_map_opacity,
+                                 shader);
+            }
+        }
+    }
+}
+
+
+bool tile_map_2d_node_class_get_bounds(mp_obj_t tile_map_node_base_obj, mp_obj_t camera_node, engine_display_rect_t *bounds){
+    engine_node_base_t *tile_map_node_base = tile_map_node_base_obj;
+    engine_tile_map_2d_node_class_obj_t *tile_map = tile_map_node_base->node;
+
+    if(tile_map->tiles == mp_const_none){
+        return false;
+    }
+
+    uint32_t map_height = ((mp_obj_array_t*)tile_map->tiles)->len / tile_map->map_width;
+    float half_map_width = tile_map->map_width * tile_map->tile_width * 0.5f;
+    float half_map_height = map_height * tile_map->tile_height * 0.5f;
+
+    engine_camera_get_bounds_2d(tile_map_node_base, camera_node, half_map_width, half_map_height, 0.0f, bounds);
+    return true;
+}
+
+
+// Return `true` if handled loading the attr from internal structure, `false` otherwise
+bool tile_map_2d_node_load_attr(engine_node_base_t *self_node_base, qstr attribute, mp_obj_t *destination){
+    // Get the underlying structure
+    engine_tile_map_2d_node_class_obj_t *self = self_node_base->node;
+
+    switch(attribute){
+        case MP_QSTR_tick:
+            destination[0] = self->tick_cb;
+            destination[1] = self_node_base->attr_accessor;
+            return true;
+        break;
+        case MP_QSTR_position:
+            destination[0] = self->position;
+            return true;
+        break;
+        case MP_QSTR_tileset:
+            destination[0] = self->tileset;
+            return true;
+        break;
+        case MP_QSTR_tile_width:
+            destination[0] = mp_obj_new_int(self->tile_width);
+            return true;
+        break;
+        case MP_QSTR_tile_height:
+            destination[0] = mp_obj_new_int(self->tile_height);
+            return true;
+        break;
+        case MP_QSTR_tiles:
+            destination[0] = self->tiles;
+            return true;
+        break;
+        case MP_QSTR_flips:
+            destination[0] = self->flips;
+            return true;
+        break;
+        case MP_QSTR_map_width:
+            destination[0] = mp_obj_new_int(self->map_width);
+            return true;
+        break;
+        case MP_QSTR_map_height:
+            destination[0] = mp_obj_new_int((self->tiles == mp_const_none) ? 0 : ((mp_obj_array_t*)self->tiles)->len / self->map_width);
+            return true;
+        break;
+        case MP_QSTR_animations:
+            destination[0] = self->animations;
+            return true;
+        break;
+        case MP_QSTR_transparent_color:
+            destination[0] = self->transparent_color;
+            return true;
+        break;
+        case MP_QSTR_rotation:
+            destination[0] = mp_obj_new_float(self->rotation);
+            return true;
+        break;
+        case MP_QSTR_scale:
+            destination[0] = self->scale;
+            return true;
+        break;
+        case MP_QSTR_opacity:
+            destination[0] = mp_obj_new_float(self->opacity);
+            return true;
+        break;
+        default:
+            return false; // Fail
+    }
+}
+
+
+// Return `true` if handled storing the attr from internal structure, `false` otherwise
+bool tile_map_2d_node_store_attr(engine_node_base_t *self_node_base, qstr attribute, mp_obj_t *destination){
+    // Get the underlying structure
+    engine_tile_map_2d_node_class_obj_t *self = self_node_base->node;
+
+    switch(attribute){
+        case MP_QSTR_tick:
+            self->tick_cb = destination[1];
+            engine_set_object_ticking(self_node_base, self->tick_cb != mp_const_none);
+            return true;
+        break;
+        case MP_QSTR_position:
+            self->position = destination[1];
+            return true;
+        break;
+        case MP_QSTR_tileset:
+            self->tileset = destination[1];
+            return true;
+        break;
+        case MP_QSTR_tile_width:
+            self->tile_width = tile_map_2d_node_get_size(destination[1]);
+            return true;
+        break;
+        case MP_QSTR_tile_height:
+            self->tile_height = tile_map_2d_node_get_size(destination[1]);
+            return true;
+        break;
+        case MP_QSTR_tiles:
+            tile_map_2d_node_check_tiles(destination[1], self->flips);
+            self->tiles = destination[1];
+            return true;
+        break;
+        case MP_QSTR_flips:
+            tile_map_2d_node_check_tiles(self->tiles, destination[1]);
+            self->flips = destination[1];
+            return true;
+        break;
+        case MP_QSTR_map_width:
+            self->map_width = tile_map_2d_node_get_size(destination[1]);
+            return true;
+        break;
+        case MP_QSTR_map_height:
+            mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("TileMap2DNode: ERROR: `map_height` follows from the length of `tiles` and `map_width`, it can't be set"));
+        break;
+        case MP_QSTR_animations:
+            tile_map_2d_node_set_animations(self, destination[1]);
+            return true;
+        break;
+        case MP_QSTR_transparent_color:
+            self->transparent_color = engine_color_wrap(destination[1]);
+            return true;
+        break;
+        case MP_QSTR_rotation:
+            self->rotation = mp_obj_get_float(destination[1]);
+            return true;
+        break;
+        case MP_QSTR_scale:
+            self->scale = destination[1];
+            return true;
+        break;
+        case MP_QSTR_opacity:
+            self->opacity = mp_obj_get_float(destination[1]);
+            return true;
+        break;
+        default:
+            return false; // Fail
+    }
+}
+
+
+static mp_attr_fun_t tile_map_2d_node_class_attr(mp_obj_t self_in, qstr attribute, mp_obj_t *destination){
+    ENGINE_INFO_PRINTF("Accessing TileMap2DNode attr");
+    node_base_attr_handler(self_in, attribute, destination,
+                          (attr_handler_func[]){node_base_load_attr, tile_map_2d_node_load_attr},
+                          (attr_handler_func[]){node_base_store_attr, tile_map_2d_node_store_attr}, 2);
+    return mp_const_none;
+}
+
+
+/*  --- doc ---
+    NAME: TileMap2DNode
+    ID: TileMap2DNode
+    DESC: Grid of tiles from a tileset texture drawn as a single node, for levels and backgrounds that would otherwise take a {ref_link:Sprite2DNode} per tile. Only the tiles under each camera's viewport are drawn and, when the map isn't rotated or scaled, their rows are copied straight from the tileset. The tileset holds `tile_width` by `tile_height` tiles left to right then top to bottom, tile 0 is the top-left one. `position` is the center of the map
+    PARAM:  [type={ref_link:Vector2}]               [name=position]                                     [value={ref_link:Vector2}]
+    PARAM:  [type={ref_link:TextureResource}]       [name=tileset]                                      [value={ref_link:TextureResource}]
+    PARAM:  [type=int]                              [name=tile_width]                                   [value=any positive integer (16 by default)]
+    PARAM:  [type=int]                              [name=tile_height]                                  [value=any positive integer (16 by default)]
+    PARAM:  [type=int]                              [name=map_width]                                    [value=any positive integer (tiles per row of the map)]
+    PARAM:  [type=bytearray]                        [name=tiles]                                        [value=bytearray (tileset index of each tile of the map, row by row, `map_width` per row. 255 (`engine_nodes.TILE_EMPTY`) and indices past the end of the tileset are left empty) or None]
+    PARAM:  [type=bytearray]                        [name=flips]                                        [value=bytearray (same length as `tiles`, `engine_nodes.TILE_FLIP_X` and/or `engine_nodes.TILE_FLIP_Y` bits to mirror each tile) or None (default)]
+    PARAM:  [type=list]                             [name=animations]                                   [value=list of (first, count, fps) tuples or None (default). Tiles `first` to `first+count-1` cycle through each other at `fps`, up to 16 ranges]
+    PARAM:  [type={ref_link:Color}|int (RGB565)]    [name=transparent_color]                            [value=color]
+    PARAM:  [type=float]                            [name=rotation]                                     [value=any (radians)]
+    PARAM:  [type={ref_link:Vector2}]               [name=scale]                                        [value={ref_link:Vector2}]
+    PARAM:  [type=float]                            [name=opacity]                                      [value=0 ~ 1.0]
+    PARAM:  [type=int]                              [name=layer]                                        [value=0 ~ 127]
+    PARAM:  [type=bool]                             [name=inherit_position]                             [value=True or False]
+    PARAM:  [type=bool]                             [name=inherit_opacity]                              [value=True or False]
+    PARAM:  [type=bool]                             [name=inherit_rotation]                             [value=True or False]
+    PARAM:  [type=bool]                             [name=inherit_scale]                                [value=True or False]
+    ATTR:   [type=function]                         [name={ref_link:add_child}]                         [value=function]
+    ATTR:   [type=function]                         [name={ref_link:get_child}]                         [value=function]
+    ATTR:   [type=function]                         [name={ref_link:get_child_count}]                   [value=function]
+    ATTR:   [type=function]                         [name={ref_link:node_base_mark_destroy}]            [value=function]
+    ATTR:   [type=function]                         [name={ref_link:node_base_mark_destroy_all}]        [value=function]
+    ATTR:   [type=function]                         [name={ref_link:node_base_mark_destroy_children}]   [value=function]
+    ATTR:   [type=function]                         [name={ref_link:remove_child}]                      [value=function]
+    ATTR:   [type=function]                         [name={ref_link:get_parent}]                        [value=function]
+    ATTR:   [type=function]                         [name={ref_link:tick}]                              [value=function]
+    ATTR:   [type={ref_link:Vector2}]               [name=position]                                     [value={ref_link:Vector2}]
+    ATTR:   [type={ref_link:Vector2}]               [name=global_position]                              [value={ref_link:Vector2} (read-only, the same Vector2 is updated and returned on every access)]
+    ATTR:   [type={ref_link:TextureResource}]       [name=tileset]                                      [value={ref_link:TextureResource}]
+    ATTR:   [type=int]                              [name=tile_width]                                   [value=any positive integer]
+    ATTR:   [type=int]                              [name=tile_height]                                  [value=any positive integer]
+    ATTR:   [type=int]                              [name=map_width]                                    [value=any positive integer]
+    ATTR:   [type=int]                              [name=map_height]                                   [value=int (read-only, full rows in `tiles`)]
+    ATTR:   [type=bytearray]                        [name=tiles]                                        [value=bytearray or None (edit it in place to change tiles)]
+    ATTR:   [type=bytearray]                        [name=flips]                                        [value=bytearray or None (set it to None first when changing `tiles` to a different length)]
+    ATTR:   [type=list]                             [name=animations]                                   [value=list of (first, count, fps) tuples or None]
+    ATTR:   [type={ref_link:Color}|int (RGB565)]    [name=transparent_color]                            [value=color]
+    ATTR:   [type=float]                            [name=rotation]                                     [value=any (radians)]
+    ATTR:   [type={ref_link:Vector2}]               [name=scale]                                        [value={ref_link:Vector2}]
+    ATTR:   [type=float]                            [name=opacity]                                      [value=0 ~ 1.0]
+    ATTR:   [type=int]                              [name=layer]                                        [value=0 ~ 127]
+    ATTR:   [type=bool]                             [name=inherit_position]                             [value=True or False]
+    ATTR:   [type=bool]                             [name=inherit_opacity]                              [value=True or False]
+    ATTR:   [type=bool]                             [name=inherit_rotation]                             [value=True or False]
+    ATTR:   [type=bool]                             [name=inherit_scale]                                [value=True or False]
+    OVRR:   [type=function]                         [name={ref_link:tick}]                              [value=function]
+*/
+mp_obj_t tile_map_2d_node_class_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args){
+    ENGINE_INFO_PRINTF("New TileMap2DNode");
+
+    mp_arg_t allowed_args[] = {
+        { MP_QSTR_child_class,          MP_ARG_OBJ,  {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_position,             MP_ARG_OBJ,  {.u_obj = vector2_class_new(&vector2_class_type, 0, 0, NULL)} },
+        { MP_QSTR_tileset,              MP_ARG_OBJ,  {.u_obj = mp_const_none} },
+        { MP_QSTR_tile_width,           MP_ARG_OBJ,  {.u_obj = mp_obj_new_int(16)} },
+        { MP_QSTR_tile_height,          MP_ARG_OBJ,  {.u_obj = mp_obj_new_int(16)} },
+        { MP_QSTR_map_width,            MP_ARG_OBJ,  {.u_obj = mp_obj_new_int(1)} },
+        { MP_QSTR_tiles,                MP_ARG_OBJ,  {.u_obj = mp_const_none} },
+        { MP_QSTR_flips,                MP_ARG_OBJ,  {.u_obj = mp_const_none} },
+        { MP_QSTR_animations,           MP_ARG_OBJ,  {.u_obj = mp_const_none} },
+        { MP_QSTR_transparent_color,    MP_ARG_OBJ,  {.u_obj = MP_OBJ_NEW_SMALL_INT(ENGINE_NO_TRANSPARENCY_COLOR)} },
+        { MP_QSTR_rotation,             MP_ARG_OBJ,  {.u_obj = mp_obj_new_float(0.0f)} },
+        { MP_QSTR_scale,                MP_ARG_OBJ,  {.u_obj = vector2_class_new(&vector2_class_type, 2, 0, (mp_obj_t[]){mp_obj_new_float(1.0f), mp_obj_new_float(1.0f)})} },
+        { MP_QSTR_opacity,              MP_ARG_OBJ,  {.u_obj = mp_obj_new_float(1.0f)} },
+        { MP_QSTR_layer,                MP_ARG_INT,  {.u_int = 0} },
+        { MP_QSTR_inherit_position,     MP_ARG_BOOL, {.u_bool = true} },
+        { MP_QSTR_inherit_opacity,      MP_ARG_BOOL, {.u_bool = true} },
+        { MP_QSTR_inherit_rotation,     MP_ARG_BOOL, {.u_bool = true} },
+        { MP_QSTR_inherit_scale,        MP_ARG_BOOL, {.u_bool = true} },
+    };
+    mp_arg_val_t parsed_args[MP_ARRAY_SIZE(allowed_args)];
+    enum arg_ids {child_class, position, tileset, tile_width, tile_height, map_width, tiles, flips, animations, transparent_color, rotation, scale, opacity, layer, inherit_position, inherit_opacity, inherit_rotation, inherit_scale};
+    bool inherited = false;
+
+    // If there is one positional argument and it isn't the first
+    // expected argument (as is expected when using positional
+    // arguments) then define which way to parse the arguments
+    if(n_args >= 1 && mp_obj_get_type(args[0]) != &vector2_class_type){
+        // Using positional arguments but the type of the first one isn't
+        // as expected. Must be the child class
+        mp_arg_parse_all_kw_array(n_args, n_kw, args, MP_ARRAY_SIZE(allowed_args), allowed_args, parsed_args);
+        inherited = true;
+    }else{
+        // Whether we're using positional arguments or not, prase them this
+        // way. It's a requirement that the child class be passed using position.
+        // Adjust what and where the arguments are parsed, since not inherited based
+        // on the first argument
+        mp_arg_parse_all_kw_array(n_args, n_kw, args, MP_ARRAY_SIZE(allowed_args)-1, allowed_args+1, parsed_args+1);
+        inherited = false;
+    }
+
+    tile_map_2d_node_check_tiles(parsed_args[tiles].u_obj, parsed_args[flips].u_obj);
+
+    // All nodes are a engine_node_base_t node. Specific node data is stored in engine_node_base_t->node
+    engine_node_base_t *node_base = mp_obj_malloc_with_finaliser(engine_node_base_t, &engine_tile_map_2d_node_class_type);
+    node_base_init(node_base, &engine_tile_map_2d_node_class_type, NODE_TYPE_TILE_MAP_2D, parsed_args[layer].u_int);
+    engine_tile_map_2d_node_class_obj_t *tile_map_2d_node = m_malloc(sizeof(engine_tile_map_2d_node_class_obj_t));
+    node_base->node = tile_map_2d_node;
+    node_base->attr_accessor = node_base;
+
+    tile_map_2d_node->tick_cb = mp_const_none;
+    tile_map_2d_node->position = parsed_args[position].u_obj;
+    tile_map_2d_node->tileset = parsed_args[tileset].u_obj;
+    tile_map_2d_node->tile_width = tile_map_2d_node_get_size(parsed_args[tile_width].u_obj);
+    tile_map_2d_node->tile_height = tile_map_2d_node_get_size(parsed_args[tile_height].u_obj);
+    tile_map_2d_node->map_width = tile_map_2d_node_get_size(parsed_args[map_width].u_obj);
+    tile_map_2d_node->tiles = parsed_args[tiles].u_obj;
+    tile_map_2d_node->flips = parsed_args[flips].u_obj;
+    tile_map_2d_node_set_animations(tile_map_2d_node, parsed_args[animations].u_obj);
+    tile_map_2d_node->transparent_color = engine_color_wrap(parsed_args[transparent_color].u_obj);
+    tile_map_2d_node->rotation = mp_obj_get_float(parsed_args[rotation].u_obj);
+    tile_map_2d_node->scale = parsed_args[scale].u_obj;
+    tile_map_2d_node->opacity = mp_obj_get_float(parsed_args[opacity].u_obj);
+    node_base_set_inherit_position(node_base, parsed_args[inherit_position].u_bool);
+    node_base_set_inherit_opacity(node_base, parsed_args[inherit_opacity].u_bool);
+    node_base_set_inherit_rotation(node_base, parsed_args[inherit_rotation].u_bool);
+    node_base_set_inherit_scale(node_base, parsed_args[inherit_scale].u_bool);
+
+    if(inherited == true){  // Inherited (use existing object)
+        // Get the Python class instance
+        mp_obj_t node_instance = parsed_args[child_class].u_obj;
+
+        // Because the instance doesn't have a `node_base` yet, restore the
+        // instance type original attr function for now (otherwise get core abort)
+        node_base_set_attr_handler_default(node_instance);
+
+        // Look for function overrides otherwise use the defaults
+        mp_obj_t dest[2];
+        mp_load_method_maybe(node_instance, MP_QSTR_tick, dest);
+        if(dest[0] == MP_OBJ_NULL && dest[1] == MP_OBJ_NULL){   // Did not find method (set to default)
+            tile_map_2d_node->tick_cb = mp_const_none;
+        }else{                                                  // Likely found method (could be attribute)
+            tile_map_2d_node->tick_cb = dest[0];
+        }
+
+        // Store one pointer on the instance. Need to be able to get the
+        // node base that contains a pointer to the engine specific data we
+        // care about
+        mp_store_attr(node_instance, MP_QSTR_node_base, node_base);
+
+        // Store default Python class instance attr function
+        // and override with custom intercept attr function
+        // so that certain callbacks/code can run (see py/objtype.c:mp_obj_instance_attr(...))
+        node_base_set_attr_handler(node_instance, tile_map_2d_node_class_attr);
+
+        // Need a way to access the object node instance instead of the native type for callbacks (tick, draw, collision)
+        node_base->attr_accessor = node_instance;
+    }
+
+    engine_set_object_ticking(node_base, tile_map_2d_node->tick_cb != mp_const_none);
+
+    return MP_OBJ_FROM_PTR(node_base);
+}
+
+
+// Class attributes
+static const mp_rom_map_elem_t tile_map_2d_node_class_locals_dict_table[] = {
+
+};
+static MP_DEFINE_CONST_DICT(tile_map_2d_node_class_locals_dict, tile_map_2d_node_class_locals_dict_table);
+
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    engine_tile_map_2d_node_class_type,
+    MP_QSTR_TileMap2DNode,
+    MP_TYPE_FLAG_NONE,
+
+    make_new, tile_map_2d_node_class_new,
+    attr, tile_map_2d_node_class_attr,
+    locals_dict, &tile_map_2d_node_class_locals_dict
+);
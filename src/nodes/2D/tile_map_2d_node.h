@@ -0,0 +1,48 @@
+#ifndef TILE_MAP_2D_NODE_H
+#define TILE_MAP_2D_NODE_H
+
+#include "py/obj.h"
+#include "nodes/node_base.h"
+#include "display/engine_display_common.h"
+
+// Tile index that is never drawn (the tileset can use 0 ~ 254)
+#define TILE_MAP_2D_EMPTY       255
+
+// Bits of each byte in 'flips'
+#define TILE_MAP_2D_FLIP_X      0b00000001
+#define TILE_MAP_2D_FLIP_Y      0b00000010
+
+#define TILE_MAP_2D_MAX_ANIMATIONS 16
+
+// Tiles 'first' ~ 'first'+'count'-1 cycle through each other, moving
+// one tile along every 'period_ms' milliseconds
+typedef struct{
+    uint8_t first;
+    uint8_t count;
+    uint32_t period_ms;
+}tile_map_2d_animation_t;
+
+// A grid of tiles from a tileset texture, drawn as one node
+typedef struct{
+    mp_obj_t position;              // Vector2: 2d xy position of the center of the map
+    mp_obj_t tileset;               // TextureResource: tiles left to right, top to bottom
+    uint16_t tile_width;            // Size of each tile in the tileset and on the map in px
+    uint16_t tile_height;
+    mp_obj_t tiles;                 // bytearray: tileset index of each tile, 'map_width' per row
+    mp_obj_t flips;                 // bytearray: TILE_MAP_2D_FLIP_* bits of each tile, or None
+    uint16_t map_width;             // Tiles per row of the map, rows follow from the length of 'tiles'
+    mp_obj_t animations;            // list: (first, count, fps) tuples as they were set, or None
+    tile_map_2d_animation_t animation_ranges[TILE_MAP_2D_MAX_ANIMATIONS];
+    uint8_t animation_count;
+    mp_obj_t transparent_color;     // 16-bit integer representing which exact color in the tileset to not render
+    float rotation;                 // Rotation about into screen/z-axis in radians
+    mp_obj_t scale;                 // Vector2
+    float opacity;
+    mp_obj_t tick_cb;
+}engine_tile_map_2d_node_class_obj_t;
+
+extern const mp_obj_type_t engine_tile_map_2d_node_class_type;
+void tile_map_2d_node_class_draw(mp_obj_t tile_map_node_base_obj, mp_obj_t camera_node);
+bool tile_map_2d_node_class_get_bounds(mp_obj_t tile_map_node_base_obj, mp_obj_t camera_node, engine_display_rect_t *bounds);
+
+#endif  // TILE_MAP_2D_NODE_H
@@ -8,6 +8,11 @@
 #include "display/engine_display_common.h"
 #include "math/engine_math.h"
 #include "engine_collections.h"
+#include "draw/engine_display_draw.h"
+#include "draw/engine_color.h"
+#include "display/engine_display_damage.h"
+#include "resources/engine_texture_resource.h"
+#include "py/objarray.h"
 
 
 // https://stackoverflow.com/a/54958473
@@ -102,8 +107,7 @@ mp_obj_t camera_node_class_del(mp_obj_t self_in){
     ENGINE_INFO_PRINTF("CameraNode: Deleted (garbage collected, removing self from active engine objects)");
 
     engine_node_base_t *node_base = self_in;
-    engine_camera_node_class_obj_t *camera_node = node_base->node;
-    engine_collections_untrack_camera(camera_node->camera_list_node);
+    engine_collections_untrack_camera(node_base);
 
     node_base_del(self_in);
 
@@ -112,6 +116,44 @@ mp_obj_t camera_node_class_del(mp_obj_t self_in){
 static MP_DEFINE_CONST_FUN_OBJ_1(camera_node_class_del_obj, camera_node_class_del);
 
 
+/*  --- doc ---
+    NAME: render
+    ID: camera_node_render
+    DESC: Draws the scene into the camera's `render_target` next frame even if nothing changed. Use this to update targets with `auto_render` off, for example every few frames for something expensive to draw
+    RETURN: None
+*/
+static mp_obj_t camera_node_class_render(mp_obj_t self_in){
+    engine_node_base_t *node_base = self_in;
+    engine_camera_node_class_obj_t *camera = node_base->node;
+    camera->render_requested = true;
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(camera_node_class_render_obj, camera_node_class_render);
+
+
+// Render targets are drawn into the same way as the screen
+// buffer, they need to use the same pixel format and fit
+static void camera_node_check_render_target(mp_obj_t render_target){
+    if(render_target == mp_const_none){
+        return;
+    }
+
+    if(mp_obj_is_type(render_target, &texture_resource_class_type) == false){
+        mp_raise_msg_varg(&mp_type_RuntimeError, MP_ERROR_TEXT("CameraNode: ERROR: Expected `render_target` to be a `TextureResource` or `None`, got: %s"), mp_obj_get_type_str(render_target));
+    }
+
+    texture_resource_class_obj_t *texture = render_target;
+
+    if(texture->get_pixel != texture_resource_get_16bit_rgb565 || texture->in_ram == false){
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("CameraNode: ERROR: `render_target` needs to be a 16-bit RGB565 `TextureResource` in RAM, like `TextureResource(width, height)`"));
+    }
+
+    if(texture->width < 1 || texture->height < 1 || texture->width > SCREEN_WIDTH || texture->height > SCREEN_HEIGHT){
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("CameraNode: ERROR: `render_target` can't be bigger than the screen"));
+    }
+}
+
+
 // Return `true` if handled loading the attr from internal structure, `false` otherwise
 bool camera_node_load_attr(engine_node_base_t *self_node_base, qstr attribute, mp_obj_t *destination){
     // Get the underlying structure
@@ -128,6 +170,11 @@ bool camera_node_load_attr(engine_node_base_t *self_node_base, qstr attribute, m
         //     destination[1] = self_node_base;
         //     return true;
         // break;
+        case MP_QSTR_render:
+            destination[0] = MP_OBJ_FROM_PTR(&camera_node_class_render_obj);
+            destination[1] = self_node_base;
+            return true;
+        break;
         case MP_QSTR_tick:
             destination[0] = self->tick_cb;
             destination[1] = self_node_base->attr_accessor;
@@ -138,7 +185,7 @@ bool camera_node_load_attr(engine_node_base_t *self_node_base, qstr attribute, m
             return true;
         break;
         case MP_QSTR_zoom:
-            destination[0] = self->zoom;
+            destination[0] = mp_obj_new_float(self->zoom);
             return true;
         break;
         case MP_QSTR_viewport:
@@ -150,15 +197,27 @@ bool camera_node_load_attr(engine_node_base_t *self_node_base, qstr attribute, m
             return true;
         break;
         case MP_QSTR_fov:
-            destination[0] = self->fov;
+            destination[0] = mp_obj_new_float(self->fov);
             return true;
         break;
         case MP_QSTR_view_distance:
-            destination[0] = self->view_distance;
+            destination[0] = mp_obj_new_float(self->view_distance);
             return true;
         break;
         case MP_QSTR_opacity:
-            destination[0] = self->opacity;
+            destination[0] = mp_obj_new_float(self->opacity);
+            return true;
+        break;
+        case MP_QSTR_render_target:
+            destination[0] = self->render_target;
+            return true;
+        break;
+        case MP_QSTR_render_clear_color:
+            destination[0] = self->render_clear_color;
+            return true;
+        break;
+        case MP_QSTR_auto_render:
+            destination[0] = mp_obj_new_bool(self->auto_render);
             return true;
         break;
         case MP_QSTR_global_position:
@@ -179,6 +238,7 @@ bool camera_node_store_attr(engine_node_base_t *self_node_base, qstr attribute,
     switch(attribute){
         case MP_QSTR_tick:
             self->tick_cb = destination[1];
+            engine_set_object_ticking(self_node_base, self->tick_cb != mp_const_none);
             return true;
         break;
         case MP_QSTR_position:
@@ -186,7 +246,7 @@ bool camera_node_store_attr(engine_node_base_t *self_node_base, qstr attribute,
             return true;
         break;
         case MP_QSTR_zoom:
-            self->zoom = destination[1];
+            self->zoom = mp_obj_get_float(destination[1]);
             return true;
         break;
         case MP_QSTR_viewport:
@@ -198,15 +258,29 @@ bool camera_node_store_attr(engine_node_base_t *self_node_base, qstr attribute,
             return true;
         break;
         case MP_QSTR_fov:
-            self->fov = destination[1];
+            self->fov = mp_obj_get_float(destination[1]);
             return true;
         break;
         case MP_QSTR_view_distance:
-            self->view_distance = destination[1];
+            self->view_distance = mp_obj_get_float(destination[1]);
             return true;
         break;
         case MP_QSTR_opacity:
-            self->opacity = destination[1];
+            self->opacity = mp_obj_get_float(destination[1]);
+            return true;
+        break;
+        case MP_QSTR_render_target:
+            camera_node_check_render_target(destination[1]);
+            self->render_target = destination[1];
+            self->render_requested = true;
+            return true;
+        break;
+        case MP_QSTR_render_clear_color:
+            self->render_clear_color = engine_color_wrap(destination[1]);
+            return true;
+        break;
+        case MP_QSTR_auto_render:
+            self->auto_render = mp_obj_is_true(destination[1]);
             return true;
         break;
         case MP_QSTR_global_position:
@@ -234,12 +308,15 @@ static mp_attr_fun_t camera_node_class_attr(mp_obj_t self_in, qstr attribute, mp
     DESC: Node that defines the perspective the scene is drawn at. There can be multiple but this will impact performance if rendering the same scene twice. To make other nodes not move when the camera moves, make the other nodes children of the camera. Note: 3D nodes do not currently support inheritance between each other, attributes like position, rotation, scale, and opacity will not work in parent/child inheritance.
     PARAM: [type={ref_link:Vector3}]             [name=position]                                    [value={ref_link:Vector3}]
     PARAM: [type=float]                          [name=zoom]                                        [value=any (scales all nodes by this factor, 1.0 by default)]
-    PARAM: [type={ref_link:Rectangle}]           [name=viewport]                                    [value={ref_link:Rectangle} (not used currently, TODO)]
+    PARAM: [type={ref_link:Rectangle}]           [name=viewport]                                    [value={ref_link:Rectangle} (area of the screen this camera draws to, nothing is drawn outside of it. Nodes are centered in it. Full screen by default)]
     PARAM: [type={ref_link:Vector3}]             [name=rotation]                                    [value={ref_link:Vector3}]
     PARAM: [type=float]                          [name=fov]                                         [value=any (sets the field fo view for rendering some nodes, not all nodes use this)]
     PARAM: [type=float]                          [name=view_distance]                               [value=any (sets the view distance for some nodes, not all nodes use this)]
     PARAM: [type=float]                          [name=opacity]                                     [value=0.0 ~ 1.0 (this opacity is applied to all nodes rendered by this camera)]
     PARAM: [type=int]                            [name=layer]                                       [value=0 ~ 127]
+    PARAM: [type={ref_link:TextureResource}|None] [name=render_target]                              [value={ref_link:TextureResource} (16-bit RGB565 in RAM, no bigger than the screen) or None (default). When set, this camera draws the scene into the texture instead of the screen, a {ref_link:Sprite2DNode} can then show it. The viewport is in the texture's pixels, it covers the whole texture when this is passed in here]
+    PARAM: [type={ref_link:Color}|int (RGB565)]  [name=render_clear_color]                          [value=color (the render target is filled with this before drawing into it, black by default)]
+    PARAM: [type=bool]                           [name=auto_render]                                 [value=True or False (True by default: re-render the target only when something drawn into it changed. When False, only re-rendered after calling {ref_link:camera_node_render})]
     ATTR:  [type=function]                       [name={ref_link:add_child}]                        [value=function] 
     ATTR:  [type=function]                       [name={ref_link:get_child}]                        [value=function]
     ATTR:  [type=function]                       [name={ref_link:get_child_count}]                  [value=function]
@@ -252,11 +329,15 @@ static mp_attr_fun_t camera_node_class_attr(mp_obj_t self_in, qstr attribute, mp
     ATTR:  [type={ref_link:Vector3}]             [name=position]                                    [value={ref_link:Vector3}]
     ATTR:  [type={ref_link:Vector3}]             [name=rotation]                                    [value={ref_link:Vector3}]
     ATTR:  [type=float]                          [name=zoom]                                        [value=any (scales all nodes by this factor, 1.0 by default)]
-    ATTR:  [type={ref_link:Rectangle}]           [name=viewport]                                    [value={ref_link:Rectangle} (not used currently, TODO)]
+    ATTR:  [type={ref_link:Rectangle}]           [name=viewport]                                    [value={ref_link:Rectangle} (area of the screen this camera draws to, nothing is drawn outside of it. Nodes are centered in it. Full screen by default)]
     ATTR:  [type=float]                          [name=fov]                                         [value=any (sets the field fo view for rendering some nodes, not all nodes use this)]
     ATTR:  [type=float]                          [name=view_distance]                               [value=any (sets the view distance for some nodes, not all nodes use this)]
     ATTR:  [type=float]                          [name=opacity]                                     [value=0.0 ~ 1.0 (this opacity is applied to all nodes rendered by this camera)]
     ATTR:  [type=int]                            [name=layer]                                       [value=0 ~ 127]
+    ATTR:  [type={ref_link:TextureResource}|None] [name=render_target]                              [value={ref_link:TextureResource} or None]
+    ATTR:  [type={ref_link:Color}|int (RGB565)]  [name=render_clear_color]                          [value=color]
+    ATTR:  [type=bool]                           [name=auto_render]                                 [value=True or False]
+    ATTR:  [type=function]                       [name={ref_link:camera_node_render}]               [value=function]
     OVRR:  [type=function]                       [name={ref_link:tick}]                             [value=function]
 */
 mp_obj_t camera_node_class_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args){
@@ -267,14 +348,17 @@ mp_obj_t camera_node_class_new(const mp_obj_type_t *type, size_t n_args, size_t
         { MP_QSTR_position,         MP_ARG_OBJ, {.u_obj = vector3_class_new(&vector3_class_type, 0, 0, NULL)} },
         { MP_QSTR_rotation,         MP_ARG_OBJ, {.u_obj = vector3_class_new(&vector3_class_type, 0, 0, NULL)} },
         { MP_QSTR_zoom,             MP_ARG_OBJ, {.u_obj = mp_obj_new_float(1.0f)} },
-        { MP_QSTR_viewport,         MP_ARG_OBJ, {.u_obj = rectangle_class_new(&rectangle_class_type, 4, 0, (mp_obj_t[]){mp_obj_new_float(0.0f), mp_obj_new_float(0.0f), mp_obj_new_float((float)SCREEN_WIDTH), mp_obj_new_float((float)SCREEN_HEIGHT)})} },
+        { MP_QSTR_viewport,         MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_fov,              MP_ARG_OBJ, {.u_obj = mp_obj_new_float(PI/2.0f)} },
         { MP_QSTR_view_distance,    MP_ARG_OBJ, {.u_obj = mp_obj_new_float(256.0f)} },
-        { MP_QSTR_opacity,          MP_ARG_INT, {.u_obj = mp_obj_new_float(1.0f)} },
-        { MP_QSTR_layer,            MP_ARG_INT, {.u_int = 0} }
+        { MP_QSTR_opacity,          MP_ARG_OBJ, {.u_obj = mp_obj_new_float(1.0f)} },
+        { MP_QSTR_layer,            MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_render_target,    MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_render_clear_color, MP_ARG_OBJ, {.u_obj = MP_OBJ_NEW_SMALL_INT(0x0000)} },
+        { MP_QSTR_auto_render,      MP_ARG_OBJ, {.u_obj = mp_const_true} }
     };
     mp_arg_val_t parsed_args[MP_ARRAY_SIZE(allowed_args)];
-    enum arg_ids {child_class, position, rotation, zoom, viewport, fov, view_distance, opacity, layer};
+    enum arg_ids {child_class, position, rotation, zoom, viewport, fov, view_distance, opacity, layer, render_target, render_clear_color, auto_render};
     bool inherited = false;
 
     // If there is one positional argument and it isn't the first 
@@ -294,6 +378,22 @@ mp_obj_t camera_node_class_new(const mp_obj_type_t *type, size_t n_args, size_t
         inherited = false;
     }
 
+    camera_node_check_render_target(parsed_args[render_target].u_obj);
+
+    // Covers all of what is drawn into unless given
+    if(parsed_args[viewport].u_obj == MP_OBJ_NULL){
+        float width = SCREEN_WIDTH;
+        float height = SCREEN_HEIGHT;
+
+        if(parsed_args[render_target].u_obj != mp_const_none){
+            texture_resource_class_obj_t *texture = parsed_args[render_target].u_obj;
+            width = texture->width;
+            height = texture->height;
+        }
+
+        parsed_args[viewport].u_obj = rectangle_class_new(&rectangle_class_type, 4, 0, (mp_obj_t[]){mp_obj_new_float(0.0f), mp_obj_new_float(0.0f), mp_obj_new_float(width), mp_obj_new_float(height)});
+    }
+
     // All nodes are a engine_node_base_t node. Specific node data is stored in engine_node_base_t->node
     engine_node_base_t *node_base = mp_obj_malloc_with_finaliser(engine_node_base_t, &engine_camera_node_class_type);
     node_base_init(node_base, &engine_camera_node_class_type, NODE_TYPE_CAMERA, parsed_args[layer].u_int);
@@ -304,15 +404,23 @@ mp_obj_t camera_node_class_new(const mp_obj_type_t *type, size_t n_args, size_t
     // Track the node base for this camera so that it can be
     // passed to draw callbacks, determined if inherited or not,
     // and then atributes looked up and used for drawing
-    camera_node->camera_list_node = engine_collections_track_camera(node_base);
+    engine_collections_track_camera(node_base);
     camera_node->tick_cb = mp_const_none;
     camera_node->position = parsed_args[position].u_obj;
-    camera_node->zoom = parsed_args[zoom].u_obj;
+    camera_node->zoom = mp_obj_get_float(parsed_args[zoom].u_obj);
     camera_node->viewport = parsed_args[viewport].u_obj;
     camera_node->rotation = parsed_args[rotation].u_obj;
-    camera_node->fov = parsed_args[fov].u_obj;
-    camera_node->view_distance = parsed_args[view_distance].u_obj;
-    camera_node->opacity = parsed_args[opacity].u_obj;
+    camera_node->fov = mp_obj_get_float(parsed_args[fov].u_obj);
+    camera_node->view_distance = mp_obj_get_float(parsed_args[view_distance].u_obj);
+    camera_node->opacity = mp_obj_get_float(parsed_args[opacity].u_obj);
+    camera_node->view_2d_version = 0;
+    camera_node->render_target = parsed_args[render_target].u_obj;
+    camera_node->render_clear_color = engine_color_wrap(parsed_args[render_clear_color].u_obj);
+    camera_node->auto_render = mp_obj_is_true(parsed_args[auto_render].u_obj);
+    camera_node->render_requested = true;
+    camera_node->render_fingerprint = 0;
+    camera_node->render_depth = NULL;
+    camera_node->render_depth_length = 0;
     
     if(inherited == true){  // Inherited (use existing object)
         // Get the Python class instance
@@ -347,10 +455,78 @@ mp_obj_t camera_node_class_new(const mp_obj_type_t *type, size_t n_args, size_t
         node_base->attr_accessor = node_instance;
     }
 
+    engine_set_object_ticking(node_base, camera_node->tick_cb != mp_const_none);
+
     return MP_OBJ_FROM_PTR(node_base);
 }
 
 
+// Times a node was skipped for a camera because
+// it was outside of what the camera could draw
+static uint32_t engine_camera_culled_count = 0;
+
+// Only camera being drawn for, like while its render target is being
+// drawn into. NULL for all cameras that draw to the screen
+static engine_node_base_t *engine_camera_drawing_only_node = NULL;
+
+
+engine_node_base_t *engine_camera_set_drawing_only(engine_node_base_t *camera_node_base){
+    engine_node_base_t *previous = engine_camera_drawing_only_node;
+    engine_camera_drawing_only_node = camera_node_base;
+    return previous;
+}
+
+
+// Cameras with a render target are only drawn
+// for while their own texture is being drawn into
+bool engine_camera_is_drawing(engine_node_base_t *camera_node_base){
+    engine_camera_node_class_obj_t *camera = camera_node_base->node;
+
+    if(engine_camera_drawing_only_node == NULL){
+        return camera->render_target == mp_const_none;
+    }
+
+    return camera_node_base == engine_camera_drawing_only_node;
+}
+
+
+// Gets the part of the camera's viewport that is on the
+// screen. Returns false when none of it is (nothing to draw)
+static bool engine_camera_get_screen_viewport(engine_node_base_t *camera_node_base, engine_display_rect_t *screen_viewport){
+    engine_camera_node_class_obj_t *camera = camera_node_base->node;
+    rectangle_class_obj_t *viewport = camera->viewport;
+
+    int32_t x0 = MAX(0, (int32_t)floorf(viewport->x));
+    int32_t y0 = MAX(0, (int32_t)floorf(viewport->y));
+    int32_t x1 = MIN(engine_display_target_width, (int32_t)ceilf(viewport->x + viewport->width));
+    int32_t y1 = MIN(engine_display_target_height, (int32_t)ceilf(viewport->y + viewport->height));
+
+    if(x0 >= x1 || y0 >= y1){
+        return false;
+    }
+
+    *screen_viewport = (engine_display_rect_t){x0, y0, x1, y1};
+    return true;
+}
+
+
+// Limits drawing to the part of the camera's viewport that is on
+// the screen. Returns false when none of it is (nothing to draw)
+static bool engine_camera_set_scissor(engine_node_base_t *camera_node_base, engine_display_rect_t *screen_viewport){
+    if(engine_camera_get_screen_viewport(camera_node_base, screen_viewport) == false){
+        return false;
+    }
+
+    engine_draw_set_scissor(screen_viewport->x0, screen_viewport->y0, screen_viewport->x1, screen_viewport->y1);
+    return true;
+}
+
+
+static inline bool engine_camera_rects_overlap(engine_display_rect_t *a, engine_display_rect_t *b){
+    return a->x0 < b->x1 && a->x1 > b->x0 && a->y0 < b->y1 && a->y1 > b->y0;
+}
+
+
 void engine_camera_draw_for_each_obj(mp_obj_t dest[2]){
     linked_list *camera_list = engine_collections_get_camera_list();
 
@@ -366,14 +542,21 @@ void engine_camera_draw_for_each_obj(mp_obj_t dest[2]){
     while(current_camera_list_node != NULL){
         engine_node_base_t *camera_node_base = current_camera_list_node->object;
         arguments[2] = camera_node_base;
-        
-        mp_call_method_n_kw(1, 0, arguments);
+
+        engine_display_rect_t screen_viewport;
+
+        if(engine_camera_is_drawing(camera_node_base) && engine_camera_set_scissor(camera_node_base, &screen_viewport)){
+            mp_call_method_n_kw(1, 0, arguments);
+        }
+
         current_camera_list_node = current_camera_list_node->next;
     }
+
+    engine_draw_reset_scissor();
 }
 
 
-void engine_camera_draw_for_each(void (*draw_cb)(mp_obj_t, mp_obj_t), engine_node_base_t *node_base){
+void engine_camera_draw_for_each(void (*draw_cb)(mp_obj_t, mp_obj_t), bool (*bounds_cb)(mp_obj_t, mp_obj_t, engine_display_rect_t*), engine_node_base_t *node_base){
     linked_list *camera_list = engine_collections_get_camera_list();
     linked_list_node *current_camera_list_node = camera_list->start;
     if(current_camera_list_node == NULL){
@@ -382,35 +565,261 @@ void engine_camera_draw_for_each(void (*draw_cb)(mp_obj_t, mp_obj_t), engine_nod
 
     while(current_camera_list_node != NULL){
         engine_node_base_t *camera_node_base = current_camera_list_node->object;
-        
-        draw_cb(node_base, camera_node_base);
+
+        engine_display_rect_t screen_viewport;
+
+        if(engine_camera_is_drawing(camera_node_base) && engine_camera_set_scissor(camera_node_base, &screen_viewport)){
+            engine_display_rect_t bounds;
+            bool has_bounds = bounds_cb != NULL && bounds_cb(node_base, camera_node_base, &bounds);
+
+            // Seen by the camera or not, the areas that damage tracking
+            // is redrawing don't matter for this. 2D nodes without a size
+            // to draw fall back to checking their position
+            if(bounds_cb == NULL){
+                node_base_set_if_on_screen(node_base, true);
+            }else if(has_bounds){
+                if(engine_camera_rects_overlap(&bounds, &screen_viewport)){
+                    node_base_set_if_on_screen(node_base, true);
+                }
+            }else{
+                engine_display_rect_t position;
+                engine_camera_get_bounds_2d(node_base, camera_node_base, 0.0f, 0.0f, 0.0f, &position);
+
+                if(engine_camera_rects_overlap(&position, &screen_viewport)){
+                    node_base_set_if_on_screen(node_base, true);
+                }
+            }
+
+            if(has_bounds && engine_draw_clip_overlaps(bounds.x0, bounds.y0, bounds.x1, bounds.y1) == false){
+                engine_camera_culled_count++;
+            }else{
+                draw_cb(node_base, camera_node_base);
+            }
+        }
 
         current_camera_list_node = current_camera_list_node->next;
     }
+
+    engine_draw_reset_scissor();
 }
 
 
-void engine_camera_transform_2d(mp_obj_t camera_node, float *px, float *py, float *rotation){
+void engine_camera_check_on_screen_2d(engine_node_base_t *node_base){
+    linked_list_node *current_camera_list_node = engine_collections_get_camera_list()->start;
+
+    while(current_camera_list_node != NULL){
+        engine_node_base_t *camera_node_base = current_camera_list_node->object;
+        engine_display_rect_t screen_viewport;
+
+        if(engine_camera_is_drawing(camera_node_base) && engine_camera_get_screen_viewport(camera_node_base, &screen_viewport)){
+            engine_display_rect_t bounds;
+            engine_camera_get_bounds_2d(node_base, camera_node_base, 0.0f, 0.0f, 0.0f, &bounds);
+
+            if(engine_camera_rects_overlap(&bounds, &screen_viewport)){
+                node_base_set_if_on_screen(node_base, true);
+                return;
+            }
+        }
+
+        current_camera_list_node = current_camera_list_node->next;
+    }
+}
+
+
+bool engine_camera_is_near_2d(engine_node_base_t *node_base, float distance){
+    engine_inheritable_2d_t inherited;
+    node_base_inherit_2d(node_base, &inherited);
+
+    float distance_sqr = distance * distance;
+    linked_list_node *current_camera_list_node = engine_collections_get_camera_list()->start;
+
+    while(current_camera_list_node != NULL){
+        engine_camera_view_2d_t *view = engine_camera_get_view_2d(current_camera_list_node->object);
+
+        float dx = inherited.px - view->px;
+        float dy = inherited.py - view->py;
+
+        if(dx*dx + dy*dy <= distance_sqr){
+            return true;
+        }
+
+        current_camera_list_node = current_camera_list_node->next;
+    }
+
+    return false;
+}
+
+
+void engine_camera_render_offscreen(uint16_t *pixels, uint16_t width, uint16_t height, uint16_t clear_color, uint16_t **depth, uint32_t *depth_length, void (*draw_layers)()){
+    uint32_t pixel_count = width * height;
+
+    engine_display_target_t previous_target;
+    engine_draw_clip_state_t previous_clip;
+    engine_display_get_target(&previous_target);
+    engine_draw_save_clip(&previous_clip);
+
+    // Nodes that depth test create the screen's depth buffer,
+    // without one there's nothing that needs the offscreen one
+    uint16_t *offscreen_depth = NULL;
+
+    if(engine_display_get_depth_buffer() != NULL){
+        if(*depth_length < pixel_count){
+            *depth = m_new(uint16_t, pixel_count);
+            *depth_length = pixel_count;
+        }
+
+        offscreen_depth = *depth;
+
+        for(uint32_t index=0; index<pixel_count; index++){
+            offscreen_depth[index] = UINT16_MAX;
+        }
+    }
+
+    for(uint32_t index=0; index<pixel_count; index++){
+        pixels[index] = clear_color;
+    }
+
+    engine_display_set_target(pixels, offscreen_depth, width, height);
+    draw_layers();
+
+    engine_display_set_target(previous_target.buffer, previous_target.depth, previous_target.width, previous_target.height);
+    engine_draw_restore_clip(&previous_clip);
+}
+
+
+void engine_camera_render_targets(void (*draw_layers)()){
+    linked_list_node *current_camera_list_node = engine_collections_get_camera_list()->start;
+
+    while(current_camera_list_node != NULL){
+        engine_node_base_t *camera_node_base = current_camera_list_node->object;
+        engine_camera_node_class_obj_t *camera = camera_node_base->node;
+        current_camera_list_node = current_camera_list_node->next;
+
+        if(camera->render_target == mp_const_none){
+            continue;
+        }
+
+        texture_resource_class_obj_t *target = camera->render_target;
+        uint16_t *pixels = (uint16_t*)((mp_obj_array_t*)target->data)->items;
+        uint16_t clear_color = ((color_class_obj_t*)camera->render_clear_color)->value;
+
+        engine_camera_drawing_only_node = camera_node_base;
+        engine_display_set_target(pixels, NULL, target->width, target->height);
+
+        bool render = camera->render_requested;
+
+        // Going through the nodes without drawing costs a lot less
+        // than drawing them, only draw if any of it would change
+        if(camera->auto_render){
+            engine_display_damage_start_fingerprint();
+            draw_layers();
+            uint32_t fingerprint = engine_display_damage_stop_fingerprint(NULL);
+            fingerprint = engine_display_damage_hash(fingerprint, &clear_color, sizeof(uint16_t));
+
+            render = render || fingerprint != camera->render_fingerprint;
+            camera->render_fingerprint = fingerprint;
+        }
+
+        if(render){
+            engine_camera_render_offscreen(pixels, target->width, target->height, clear_color, &camera->render_depth, &camera->render_depth_length, draw_layers);
+            target->revision++;
+            camera->render_requested = false;
+        }
+
+        engine_display_reset_target();
+    }
+
+    // Also puts things back if a draw callback raised last frame
+    engine_camera_drawing_only_node = NULL;
+    engine_display_reset_target();
+}
+
+
+uint32_t engine_camera_get_culled_count(){
+    return engine_camera_culled_count;
+}
+
+
+void engine_camera_reset_culled_count(){
+    engine_camera_culled_count = 0;
+}
+
+
+void engine_camera_get_bounds_2d(engine_node_base_t *node_base, mp_obj_t camera_node, float half_width, float half_height, float rotation, engine_display_rect_t *bounds){
     engine_node_base_t *camera_node_base = camera_node;
     engine_camera_node_class_obj_t *camera = camera_node_base->node;
 
-    // vector3_class_obj_t *camera_position = camera->position;
-    float camera_zoom = mp_obj_get_float(camera->zoom);
+    rectangle_class_obj_t *camera_viewport = camera->viewport;
+    float camera_zoom = engine_camera_get_view_2d(camera_node)->zoom;
+
+    // Same steps the draw callbacks take to place the node
+    engine_inheritable_2d_t inherited;
+    node_base_inherit_2d(node_base, &inherited);
+    inherited.rotation += rotation;
+
+    if(inherited.is_camera_child == false){
+        engine_camera_transform_2d(camera_node, &inherited.px, &inherited.py, &inherited.rotation);
+    }else{
+        camera_zoom = 1.0f;
+    }
+
+    inherited.px += camera_viewport->x + camera_viewport->width/2;
+    inherited.py += camera_viewport->y + camera_viewport->height/2;
+
+    half_width *= fabsf(inherited.sx * camera_zoom);
+    half_height *= fabsf(inherited.sy * camera_zoom);
+
+    // Half size of the box that fits around the rotated box
+    float sin_angle = fabsf(sinf(inherited.rotation));
+    float cos_angle = fabsf(cosf(inherited.rotation));
+    float extent_x = cos_angle * half_width + sin_angle * half_height;
+    float extent_y = sin_angle * half_width + cos_angle * half_height;
+
+    // Padded for the rounding the primitives do and clamped
+    // so that nodes far off the screen don't wrap around
+    bounds->x0 = (int16_t)engine_math_clamp(floorf(inherited.px - extent_x) - 2.0f, INT16_MIN, INT16_MAX);
+    bounds->y0 = (int16_t)engine_math_clamp(floorf(inherited.py - extent_y) - 2.0f, INT16_MIN, INT16_MAX);
+    bounds->x1 = (int16_t)engine_math_clamp(ceilf(inherited.px + extent_x) + 2.0f, INT16_MIN, INT16_MAX);
+    bounds->y1 = (int16_t)engine_math_clamp(ceilf(inherited.py + extent_y) + 2.0f, INT16_MIN, INT16_MAX);
+}
+
+
+engine_camera_view_2d_t *engine_camera_get_view_2d(mp_obj_t camera_node){
+    engine_node_base_t *camera_node_base = camera_node;
+    engine_camera_node_class_obj_t *camera = camera_node_base->node;
+    engine_camera_view_2d_t *view = &camera->view_2d;
 
     engine_inheritable_2d_t camera_inherited;
     node_base_inherit_2d(camera_node, &camera_inherited);
-    camera_inherited.rotation = -camera_inherited.rotation;
 
-    *px -= camera_inherited.px;
-    *py -= camera_inherited.py;
+    if(camera->view_2d_version == camera_node_base->inherited_2d_version && view->zoom == camera->zoom){
+        return view;
+    }
+
+    view->px = camera_inherited.px;
+    view->py = camera_inherited.py;
+    view->rotation = -camera_inherited.rotation;
+    view->sin_rotation = sinf(view->rotation);
+    view->cos_rotation = cosf(view->rotation);
+    view->zoom = camera->zoom;
+
+    camera->view_2d_version = camera_node_base->inherited_2d_version;
+    return view;
+}
+
+
+void engine_camera_transform_2d(mp_obj_t camera_node, float *px, float *py, float *rotation){
+    engine_camera_view_2d_t *view = engine_camera_get_view_2d(camera_node);
 
-    // Scale transformation due to camera zoom
-    engine_math_scale_point(px, py, 0, 0, camera_zoom, camera_zoom);
+    // Translate relative to the camera and scale due to camera zoom
+    float x = (*px - view->px) * view->zoom;
+    float y = (*py - view->py) * view->zoom;
 
-    // Rotate node origin about the camera
-    engine_math_rotate_point(px, py, 0, 0, camera_inherited.rotation);
+    // Rotate node origin about the camera (same as `engine_math_rotate_point()`)
+    *px = x * view->cos_rotation + y * view->sin_rotation;
+    *py = y * view->cos_rotation - x * view->sin_rotation;
 
-    *rotation += camera_inherited.rotation;
+    *rotation += view->rotation;
 }
 
 
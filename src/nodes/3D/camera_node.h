@@ -6,19 +6,41 @@
 #include "math/vector3.h"
 #include "utility/engine_mp.h"
 #include "nodes/node_base.h"
+#include "display/engine_display_common.h"
+
+
+// World-space view of a camera that 2D nodes are drawn through. Only
+// worked out again when the camera moved or zoomed rather than once
+// for every node and camera pair
+typedef struct{
+    float px;                       // World position of the camera
+    float py;
+    float rotation;                 // Inverse (negated) world rotation of the camera
+    float sin_rotation;             // Of 'rotation'
+    float cos_rotation;
+    float zoom;
+}engine_camera_view_2d_t;
 
 
 // Node the defines view that the world is rendered about
 typedef struct{
     mp_obj_t position;              // Vector3: xyz position of this node
     mp_obj_t rotation;              // Vector3: rotation of this node in space
-    mp_obj_t zoom;                  // float: factor to scale drawing nodes by and also scale translation
+    float zoom;                     // float: factor to scale drawing nodes by and also scale translation
     mp_obj_t viewport;              // Rectangle: position, width and height in screen buffer
-    mp_obj_t fov;                   // Only applies to certain nodes, like voxelspace (units are radians in that case)
-    mp_obj_t view_distance;         // Only applies to certain nodes, like voxelspace (units are pixels in that case)
-    mp_obj_t opacity;               // Opacity to apply to all nodes rendered by this camera
+    float fov;                      // Only applies to certain nodes, like voxelspace (units are radians in that case)
+    float view_distance;            // Only applies to certain nodes, like voxelspace (units are pixels in that case)
+    float opacity;                  // Opacity to apply to all nodes rendered by this camera
     mp_obj_t tick_cb;
-    linked_list_node *camera_list_node;
+    engine_camera_view_2d_t view_2d;
+    uint32_t view_2d_version;       // The camera's 'inherited_2d_version' 'view_2d' was worked out from, 0 if never
+    mp_obj_t render_target;         // TextureResource drawn into instead of the screen, or None
+    mp_obj_t render_clear_color;    // Color: what the render target is filled with before drawing into it
+    bool auto_render;               // Re-render the target whenever what would be drawn into it changes
+    bool render_requested;          // Re-render the target next frame no matter what (`render()` or new target)
+    uint32_t render_fingerprint;    // Of everything that was drawn into the target last time
+    uint16_t *render_depth;         // Depth buffer the size of the target, only made if the scene uses depth
+    uint32_t render_depth_length;   // Pixels in 'render_depth'
 }engine_camera_node_class_obj_t;
 
 extern const mp_obj_type_t engine_camera_node_class_type;
@@ -27,7 +49,50 @@ extern const mp_obj_type_t engine_camera_node_class_type;
 // pass each camera to the draw callback
 void engine_camera_draw_for_each_obj(mp_obj_t dest[2]);
 
-void engine_camera_draw_for_each(void (*draw_cb)(mp_obj_t, mp_obj_t), engine_node_base_t *node_base);
+// Draws into the texture of each camera that has a `render_target`,
+// when asked to with `render()` or (with `auto_render`) when what it
+// would draw changed. `draw_layers` should draw every node, it is called
+// with only that camera being drawn for. Cameras with a render target
+// are skipped when drawing to the screen
+void engine_camera_render_targets(void (*draw_layers)());
+
+// Fills `pixels` (`width` x `height`) with `clear_color` and makes it the
+// draw target while `draw_layers` runs. If the scene uses depth, `depth`
+// is grown to fit (`depth_length` pixels) and used as the depth buffer.
+// The draw target and clipping are put back to what they were after
+void engine_camera_render_offscreen(uint16_t *pixels, uint16_t width, uint16_t height, uint16_t clear_color, uint16_t **depth, uint32_t *depth_length, void (*draw_layers)());
+
+// True if nodes are being drawn for the camera right now
+bool engine_camera_is_drawing(engine_node_base_t *camera_node_base);
+
+// Only draw for this camera (NULL for every camera that draws
+// to the screen) until set again. Returns what was set before
+engine_node_base_t *engine_camera_set_drawing_only(engine_node_base_t *camera_node_base);
+
+// Same as above but for engine nodes. When `bounds_cb` is given it fills
+// in the area of the screen the node would cover for a camera (returning
+// false if it can't tell) and the node isn't drawn when that misses
+// everywhere that can be drawn to (counted as culled)
+void engine_camera_draw_for_each(void (*draw_cb)(mp_obj_t, mp_obj_t), bool (*bounds_cb)(mp_obj_t, mp_obj_t, engine_display_rect_t*), engine_node_base_t *node_base);
+
+// Marks a node that isn't drawn as on screen (see `node_base_is_on_screen`)
+// if its position is inside of any camera's viewport
+void engine_camera_check_on_screen_2d(engine_node_base_t *node_base);
+
+// True if the node's 2D position is within `distance` of any camera's
+bool engine_camera_is_near_2d(engine_node_base_t *node_base, float distance);
+
+// Number of times a node was culled for a camera since the last reset
+uint32_t engine_camera_get_culled_count();
+void engine_camera_reset_culled_count();
+
+// Screen area covered by a 2D node's box (`half_width` and `half_height`
+// before scaling, turned by `rotation` plus the node's rotation) through
+// the camera, including its zoom and viewport. Used by the bounds callbacks
+void engine_camera_get_bounds_2d(engine_node_base_t *node_base, mp_obj_t camera_node, float half_width, float half_height, float rotation, engine_display_rect_t *bounds);
+
+// Returns the camera's cached view, recomputed if the camera moved or zoomed
+engine_camera_view_2d_t *engine_camera_get_view_2d(mp_obj_t camera_node);
 
 // Scale passed position and rotation due to camera zoom and rotation
 void engine_camera_transform_2d(mp_obj_t camera_node, float *px, float *py, float *rotation);
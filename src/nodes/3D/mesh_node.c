@@ -15,6 +15,7 @@
 #include "display/engine_display_common.h"
 #include "draw/engine_display_draw.h"
 #include "draw/engine_shader.h"
+#include "display/engine_display_damage.h"
 
 #define CGLM_CLIPSPACE_INCLUDE_ALL 1
 #include "../lib/cglm/include/cglm/cglm.h"
@@ -28,6 +29,13 @@ extern const vector3_class_obj_t world_north;
 
 
 void mesh_node_class_draw(mp_obj_t mesh_node_base_obj, mp_obj_t camera_node){
+    // Projected triangles depend on the camera and every vertex,
+    // the whole screen is redrawn instead of tracking them
+    if(engine_display_damage_is_recording()){
+        engine_display_damage_record_always(0, 0, engine_display_target_width, engine_display_target_height);
+        return;
+    }
+
     engine_node_base_t *mesh_node_base = mesh_node_base_obj;
     engine_mesh_node_class_obj_t *mesh_node = mesh_node_base->node;
 
@@ -37,7 +45,8 @@ void mesh_node_class_draw(mp_obj_t mesh_node_base_obj, mp_obj_t camera_node){
     engine_shader_t *shader = engine_get_builtin_shader(EMPTY_SHADER);
 
     vector3_class_obj_t *camera_position = camera->position;
-    float camera_view_distance = mp_obj_get_float(camera->view_distance);
+    float camera_view_distance = camera->view_distance;
+    rectangle_class_obj_t *camera_viewport = camera->viewport;
 
     vec3 cam_position = {camera_position->x.value, camera_position->y.value, camera_position->z.value};
     vec3 cam_target = GLM_VEC3_ZERO_INIT;
@@ -51,7 +60,7 @@ void mesh_node_class_draw(mp_obj_t mesh_node_base_obj, mp_obj_t camera_node){
     glm_lookat(cam_position, cam_target, cam_up, m_view);
 
     mat4 m_projection = GLM_MAT4_ZERO_INIT;
-    glm_perspective(1.571f, SCREEN_WIDTH/SCREEN_HEIGHT, 0.5f, camera_view_distance, m_projection);
+    glm_perspective(1.571f, camera_viewport->width/camera_viewport->height, 0.5f, camera_view_distance, m_projection);
 
     // mat4 m_model = GLM_MAT4_IDENTITY_INIT;
 
@@ -59,7 +68,7 @@ void mesh_node_class_draw(mp_obj_t mesh_node_base_obj, mp_obj_t camera_node){
     glm_mat4_mul(m_projection, m_view, mvp);
     // glm_mat4_mul(mvp, m_model, mvp);
 
-    vec4 v_viewport = {0.0f, 0.0f, SCREEN_WIDTH, SCREEN_HEIGHT};
+    vec4 v_viewport = {camera_viewport->x, camera_viewport->y, camera_viewport->width, camera_viewport->height};
 
 
     for(uint16_t ivx=0; ivx<mesh_node->vertices->len; ivx+=3){
@@ -163,6 +172,7 @@ bool mesh_store_attr(engine_node_base_t *self_node_base, qstr attribute, mp_obj_
     switch(attribute){
         case MP_QSTR_tick:
             self->tick_cb = destination[1];
+            engine_set_object_ticking(self_node_base, self->tick_cb != mp_const_none);
             return true;
         break;
         case MP_QSTR_position:
@@ -291,6 +301,8 @@ mp_obj_t mesh_node_class_new(const mp_obj_type_t *type, size_t n_args, size_t n_
         node_base->attr_accessor = node_instance;
     }
 
+    engine_set_object_ticking(node_base, mesh_node->tick_cb != mp_const_none);
+
     return MP_OBJ_FROM_PTR(node_base);
 }
 
@@ -11,6 +11,8 @@
 #include "resources/engine_texture_resource.h"
 #include "draw/engine_display_draw.h"
 #include "draw/engine_shader.h"
+#include "display/engine_display_damage.h"
+#include "math/rectangle.h"
 #include "py/objarray.h"
 
 #include <string.h>
@@ -25,11 +27,34 @@ const float perspective_factor = 1.0f / SCREEN_HEIGHT_HALF;
 void voxelspace_node_class_draw(mp_obj_t voxelspace_node_base_obj, mp_obj_t camera_node){
     ENGINE_INFO_PRINTF("VoxelSpaceNode: Drawing");
 
-    engine_node_base_t *voxelspace_node_base = voxelspace_node_base_obj;
-
     engine_node_base_t *camera_node_base = camera_node;
     engine_camera_node_class_obj_t *camera = camera_node_base->node;
 
+    // Terrain spans the camera's viewport, only the columns
+    // and rows of it that are on the screen are drawn
+    rectangle_class_obj_t *camera_viewport = camera->viewport;
+    int16_t view_x = (int16_t)floorf(camera_viewport->x);
+    int16_t view_width = (int16_t)camera_viewport->width;
+    float view_center_y = camera_viewport->y + camera_viewport->height * 0.5f;
+
+    int16_t column_start = MAX(0, -view_x);
+    int16_t column_end = MIN(view_width, engine_display_target_width - view_x);
+    int16_t row_top = MAX(0, (int16_t)floorf(camera_viewport->y));
+    int16_t row_bottom = MIN(engine_display_target_height, (int16_t)ceilf(camera_viewport->y + camera_viewport->height));
+
+    if(column_start >= column_end || row_top >= row_bottom){
+        return;
+    }
+
+    // Terrain is drawn column by column with occlusion, too much
+    // to sum up as a signature so the whole viewport is redrawn
+    if(engine_display_damage_is_recording()){
+        engine_display_damage_record_always(view_x+column_start, row_top, view_x+column_end, row_bottom);
+        return;
+    }
+
+    engine_node_base_t *voxelspace_node_base = voxelspace_node_base_obj;
+
     engine_voxelspace_node_class_obj_t *voxelspace_node = voxelspace_node_base->node;
 
     texture_resource_class_obj_t *texture = voxelspace_node->texture_resource;
@@ -46,20 +71,22 @@ void voxelspace_node_class_draw(mp_obj_t voxelspace_node_base_obj, mp_obj_t came
 
     vector3_class_obj_t *camera_rotation = camera->rotation;
     vector3_class_obj_t *camera_position = camera->position;
-    float camera_fov_half = mp_obj_get_float(camera->fov) * 0.5f;
-    float camera_view_distance = mp_obj_get_float(camera->view_distance);
+    float camera_fov_half = camera->fov * 0.5f;
+    float camera_view_distance = camera->view_distance;
 
     engine_shader_t *shader = engine_get_builtin_shader(EMPTY_SHADER);
 
     // memset(height_buffer, SCREEN_HEIGHT, SCREEN_WIDTH*2);
     for(uint16_t i=0; i<SCREEN_WIDTH; i++){
         if(flip){
-            height_buffer[i] = 0;
+            height_buffer[i] = row_top;
         }else{
-            height_buffer[i] = SCREEN_HEIGHT;
+            height_buffer[i] = row_bottom;
         }
     }
 
+    float inverse_view_width = 1.0f / view_width;
+
     float dz = 1.0f;
     float z = 1.0f;
 
@@ -88,7 +115,7 @@ void voxelspace_node_class_draw(mp_obj_t voxelspace_node_base_obj, mp_obj_t came
 
     // https://news.ycombinator.com/item?id=21945633
     float skew_roll_line_dy = sinf(camera_rotation->z.value);
-    float skew_roll_start_offset = -SCREEN_WIDTH_HALF * tanf(camera_rotation->z.value);
+    float skew_roll_start_offset = -(view_width * 0.5f) * tanf(camera_rotation->z.value);
 
     float view_left_x = cosf(camera_rotation->y.value-camera_fov_half) * inverse_x_scale;
     float view_left_y = sinf(camera_rotation->y.value-camera_fov_half) * inverse_z_scale;
@@ -114,14 +141,15 @@ void voxelspace_node_class_draw(mp_obj_t voxelspace_node_base_obj, mp_obj_t came
         float pright_x = z * view_right_x;
         float pright_y = z * view_right_y;
 
-        float dx = (pright_x - pleft_x) * SCREEN_WIDTH_INVERSE;
-        float dy = (pright_y - pleft_y) * SCREEN_WIDTH_INVERSE;
+        float dx = (pright_x - pleft_x) * inverse_view_width;
+        float dy = (pright_y - pleft_y) * inverse_view_width;
 
-        pleft_x += camera_position->x.value * inverse_x_scale;
-        pleft_y += camera_position->z.value * inverse_z_scale;
+        // Skip the columns of the viewport that are off the screen
+        pleft_x += camera_position->x.value * inverse_x_scale + dx * column_start;
+        pleft_y += camera_position->z.value * inverse_z_scale + dy * column_start;
 
-        // Cumulative offset for roll skew as the screen width is traversed
-        float skew_roll_offset = skew_roll_start_offset;
+        // Cumulative offset for roll skew as the viewport width is traversed
+        float skew_roll_offset = skew_roll_start_offset + skew_roll_line_dy * column_start;
 
         // Factor to scale certain objects/lines/distances as the render distance gets further away
         float perspective = z * perspective_factor;
@@ -130,7 +158,8 @@ void voxelspace_node_class_draw(mp_obj_t voxelspace_node_base_obj, mp_obj_t came
         // and then scale to the max allowed in the depth buffer
         uint16_t depth = (uint16_t)((z / hypot) * UINT16_MAX);
 
-        for(uint8_t i=0; i<SCREEN_WIDTH; i++){
+        for(int16_t column=column_start; column<column_end; column++){
+            int16_t i = view_x + column;
             int32_t x = 0;
             int32_t y = 0;
 
@@ -169,16 +198,16 @@ void voxelspace_node_class_draw(mp_obj_t voxelspace_node_base_obj, mp_obj_t came
             altitude += camera_position->y.value;                       // Apply camera view translation
 
             // Use camera_rotation for on x-axis for pitch (head going in up/down in 'yes' motion)
-            int16_t height_on_screen = (int16_t)(((SCREEN_HEIGHT_HALF + (altitude / perspective)) + view_angle) + curvature + skew_roll_offset);
+            int16_t height_on_screen = (int16_t)(((view_center_y + (altitude / perspective)) + view_angle) + curvature + skew_roll_offset);
             skew_roll_offset += skew_roll_line_dy;
 
             int16_t ipx = height_on_screen;
 
-            // Clip to screen bounds so we don't draw more than needed
-            if(height_on_screen >= SCREEN_HEIGHT){
-                ipx = SCREEN_HEIGHT;
-            }else if(height_on_screen < 0){
-                ipx = -1;
+            // Clip to viewport bounds so we don't draw more than needed
+            if(height_on_screen >= row_bottom){
+                ipx = row_bottom;
+            }else if(height_on_screen < row_top){
+                ipx = row_top-1;
             }
 
             if(flip){
@@ -356,6 +385,7 @@ bool voxelspace_node_store_attr(engine_node_base_t *self_node_base, qstr attribu
     switch(attribute){
         case MP_QSTR_tick:
             self->tick_cb = destination[1];
+            engine_set_object_ticking(self_node_base, self->tick_cb != mp_const_none);
             return true;
         break;
         case MP_QSTR_position:
@@ -543,6 +573,8 @@ mp_obj_t voxelspace_node_class_new(const mp_obj_type_t *type, size_t n_args, siz
         node_base->attr_accessor = node_instance;
     }
 
+    engine_set_object_ticking(node_base, voxelspace_node->tick_cb != mp_const_none);
+
     return MP_OBJ_FROM_PTR(node_base);
 }
 
@@ -16,6 +16,7 @@
 #include "draw/engine_color.h"
 #include "draw/engine_shader.h"
 #include "display/engine_display_common.h"
+#include "display/engine_display_damage.h"
 
 
 extern const float perspective_factor;
@@ -50,8 +51,9 @@ void voxelspace_sprite_node_class_draw(mp_obj_t sprite_node_base_obj, mp_obj_t c
 
     vector3_class_obj_t *camera_position = camera->position;
     vector3_class_obj_t *camera_rotation = camera->rotation;
-    float camera_fov_half = mp_obj_get_float(camera->fov) * 0.5f;
-    float view_distance = mp_obj_get_float(camera->view_distance);
+    float camera_fov_half = camera->fov * 0.5f;
+    float view_distance = camera->view_distance;
+    rectangle_class_obj_t *camera_viewport = camera->viewport;
 
     uint16_t sprite_frame_count_x = mp_obj_get_int(voxelspace_sprite_node->frame_count_x);
     uint16_t sprite_frame_count_y = mp_obj_get_int(voxelspace_sprite_node->frame_count_y);
@@ -189,7 +191,7 @@ void voxelspace_sprite_node_class_draw(mp_obj_t sprite_node_base_obj, mp_obj_t c
 
     float max = engine_math_dot_product(e1x, e1z, e1x, e1z);
     float value = engine_math_dot_product(e1x, e1z, e2x, e2z);
-    float sprite_rotated_x = ((value/max) * SCREEN_WIDTH);
+    float sprite_rotated_x = camera_viewport->x + ((value/max) * camera_viewport->width);
 
     // Figure out the scale
     // This scales everything so that if you're one projected
@@ -214,7 +216,7 @@ void voxelspace_sprite_node_class_draw(mp_obj_t sprite_node_base_obj, mp_obj_t c
 
     // Figure out the y on screen
     float altitude = -sprite_position->y.value + camera_position->y.value;
-    int16_t height_on_screen = (int16_t)((SCREEN_HEIGHT_HALF + (altitude * inverse_perspective)) + view_angle);
+    int16_t height_on_screen = (int16_t)(((camera_viewport->y + camera_viewport->height * 0.5f) + (altitude * inverse_perspective)) + view_angle);
 
     // Apply x and y
     sprite_rotated_x += (sprite_texture_offset->x.value * scale_x);
@@ -240,8 +242,12 @@ void voxelspace_sprite_node_class_draw(mp_obj_t sprite_node_base_obj, mp_obj_t c
                      depth,
                      shader);
 
+    // With damage tracking the draw callbacks can run twice per
+    // frame, only step the animation in the pass that always runs
+    bool stepping_pass = engine_display_damage_is_enabled() == false || engine_display_damage_is_recording();
+
     // After drawing, go to the next frame if it is time to and the animation is playing
-    if(sprite_playing == 1){
+    if(sprite_playing == 1 && stepping_pass){
         float sprite_fps = mp_obj_get_float(mp_load_attr(sprite_node_base->attr_accessor, MP_QSTR_fps));
         uint16_t sprite_period = (uint16_t)((1.0f/sprite_fps) * 1000.0f);
 
@@ -354,6 +360,7 @@ bool voxelspace_sprite_node_store_attr(engine_node_base_t *self_node_base, qstr
     switch(attribute){
         case MP_QSTR_tick:
             self->tick_cb = destination[1];
+            engine_set_object_ticking(self_node_base, self->tick_cb != mp_const_none);
             return true;
         break;
         case MP_QSTR_position:
@@ -574,6 +581,8 @@ mp_obj_t voxelspace_sprite_node_class_new(const mp_obj_type_t *type, size_t n_ar
         node_base->attr_accessor = node_instance;
     }
 
+    engine_set_object_ticking(node_base, voxelspace_sprite_node->tick_cb != mp_const_none);
+
     return MP_OBJ_FROM_PTR(node_base);
 }
 
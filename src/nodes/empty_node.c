@@ -43,6 +43,7 @@ bool empty_node_store_attr(engine_node_base_t *self_node_base, qstr attribute, m
     switch(attribute){
         case MP_QSTR_tick:
             self->tick_cb = destination[1];
+            engine_set_object_ticking(self_node_base, self->tick_cb != mp_const_none);
             return true;
         break;
         case MP_QSTR_position:
@@ -167,6 +168,8 @@ static mp_obj_t empty_node_class_new(const mp_obj_type_t *type, size_t n_args, s
         node_base->attr_accessor = node_instance;
     }
 
+    engine_set_object_ticking(node_base, empty_node->tick_cb != mp_const_none);
+
     return MP_OBJ_FROM_PTR(node_base);
 }
 
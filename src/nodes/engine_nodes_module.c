@@ -14,6 +14,7 @@
 #include "2D/text_2d_node.h"
 #include "2D/gui_button_2d_node.h"
 #include "2D/gui_bitmap_button_2d_node.h"
+#include "2D/tile_map_2d_node.h"
 #include "engine_main.h"
 
 
@@ -27,7 +28,7 @@ MP_DEFINE_CONST_FUN_OBJ_0(engine_nodes_module_init_obj, engine_nodes_module_init
 /*  --- doc ---
     NAME: engine_nodes
     ID: engine_nodes
-    DESC: Module containing nodes that get drawn to the framebuffer. Each node also has a tick function that can be overridden to run code every game loop.
+    DESC: Module containing nodes that get drawn to the framebuffer. Each node also has a tick function that can be overridden to run code every game loop. Setting `cache_as_bitmap` to True on any node draws it and all of its children into a buffer that is copied to the screen instead of drawing them again, until something in it changes (good for HUDs and other mostly static groups of 2D nodes). Changes are found from moved nodes and stored attributes, data changed in place (like the pixels of a TextureResource) isn't seen until an attribute of a node in the subtree is stored again. The subtree is drawn where the node is in the layer order, partly transparent parts blend against black and 3D nodes in it are drawn every frame
     ATTR: [type=object]   [name={ref_link:EmptyNode}]               [value=object] 
     ATTR: [type=object]   [name={ref_link:CameraNode}]              [value=object]
     ATTR: [type=object]   [name={ref_link:VoxelSpaceNode}]          [value=object]
@@ -42,6 +43,14 @@ MP_DEFINE_CONST_FUN_OBJ_0(engine_nodes_module_init_obj, engine_nodes_module_init
     ATTR: [type=object]   [name={ref_link:Text2DNode}]              [value=object]
     ATTR: [type=object]   [name={ref_link:GUIButton2DNode}]         [value=object]
     ATTR: [type=object]   [name={ref_link:GUIBitmapButton2DNode}]   [value=object]
+    ATTR: [type=object]   [name={ref_link:TileMap2DNode}]           [value=object]
+    ATTR: [type=enum/int] [name=TICK_ALWAYS]                        [value=0 (default `tick_policy` of every node, `tick` is called every frame)]
+    ATTR: [type=enum/int] [name=TICK_VISIBLE]                       [value=1 (`tick` is only called if a camera saw the node the last time nodes were drawn)]
+    ATTR: [type=enum/int] [name=TICK_NEAR_CAMERA]                   [value=2 (`tick` is only called if the node is within `tick_distance` pixels of a camera, 128 by default)]
+    ATTR: [type=enum/int] [name=TICK_INTERVAL]                      [value=3 (`tick` is called every `tick_interval` frames with a `dt` that covers all of them, nodes are spread out over those frames)]
+    ATTR: [type=enum/int] [name=TILE_EMPTY]                         [value=255 (tile index that {ref_link:TileMap2DNode} leaves empty)]
+    ATTR: [type=enum/int] [name=TILE_FLIP_X]                        [value=1 (bit in {ref_link:TileMap2DNode} `flips` that mirrors a tile left to right)]
+    ATTR: [type=enum/int] [name=TILE_FLIP_Y]                        [value=2 (bit in {ref_link:TileMap2DNode} `flips` that mirrors a tile top to bottom)]
 */
 static const mp_rom_map_elem_t engine_nodes_globals_table[] = {
     { MP_OBJ_NEW_QSTR(MP_QSTR___name__), MP_OBJ_NEW_QSTR(MP_QSTR_engine_nodes) },
@@ -60,6 +69,14 @@ static const mp_rom_map_elem_t engine_nodes_globals_table[] = {
     { MP_OBJ_NEW_QSTR(MP_QSTR_Text2DNode), (mp_obj_t)&engine_text_2d_node_class_type },
     { MP_OBJ_NEW_QSTR(MP_QSTR_GUIButton2DNode), (mp_obj_t)&engine_gui_button_2d_node_class_type },
     { MP_OBJ_NEW_QSTR(MP_QSTR_GUIBitmapButton2DNode), (mp_obj_t)&engine_gui_bitmap_button_2d_node_class_type },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_TileMap2DNode), (mp_obj_t)&engine_tile_map_2d_node_class_type },
+    { MP_ROM_QSTR(MP_QSTR_TICK_ALWAYS), MP_ROM_INT(NODE_BASE_TICK_ALWAYS) },
+    { MP_ROM_QSTR(MP_QSTR_TICK_VISIBLE), MP_ROM_INT(NODE_BASE_TICK_VISIBLE) },
+    { MP_ROM_QSTR(MP_QSTR_TICK_NEAR_CAMERA), MP_ROM_INT(NODE_BASE_TICK_NEAR_CAMERA) },
+    { MP_ROM_QSTR(MP_QSTR_TICK_INTERVAL), MP_ROM_INT(NODE_BASE_TICK_INTERVAL) },
+    { MP_ROM_QSTR(MP_QSTR_TILE_EMPTY), MP_ROM_INT(TILE_MAP_2D_EMPTY) },
+    { MP_ROM_QSTR(MP_QSTR_TILE_FLIP_X), MP_ROM_INT(TILE_MAP_2D_FLIP_X) },
+    { MP_ROM_QSTR(MP_QSTR_TILE_FLIP_Y), MP_ROM_INT(TILE_MAP_2D_FLIP_Y) },
 };
 
 // Module init
@@ -9,12 +9,26 @@
 #include "utility/engine_mp.h"
 #include "py/misc.h"
 #include "engine_collections.h"
+#include "nodes/physics_node_base.h"
+#include "nodes/2D/physics_rectangle_2d_node.h"
+#include "nodes/2D/physics_circle_2d_node.h"
+#include "nodes/node_bitmap_cache.h"
+#include "nodes/empty_node.h"
+#include "nodes/3D/camera_node.h"
+#include "nodes/2D/rectangle_2d_node.h"
+#include "nodes/2D/circle_2d_node.h"
+#include "nodes/2D/line_2d_node.h"
+#include "nodes/2D/sprite_2d_node.h"
+#include "nodes/2D/text_2d_node.h"
+#include "nodes/2D/gui_button_2d_node.h"
+#include "nodes/2D/gui_bitmap_button_2d_node.h"
+#include "nodes/2D/tile_map_2d_node.h"
 
 
 /*  --- doc ---
     NAME: tick
     ID: tick
-    DESC: Overridable tick callback
+    DESC: Overridable tick callback. Called every frame unless the node's `tick_policy` says otherwise (see {ref_link:engine_nodes})
     PARAM: [type=object] [name=self] [value=object]
     PARAM: [type=float]  [name=dt] [value=positive float in seconds]                                                                                                  
     RETURN: None
@@ -28,21 +42,55 @@
 */ 
 void (*default_instance_attr_func)(mp_obj_t self_in, qstr attribute, mp_obj_t *destination) = NULL;
 
+// Handed out to nodes in turn so that nodes ticking every N
+// frames don't all tick on the same frame
+static uint8_t node_base_next_tick_phase = 0;
+
 
 void node_base_init(engine_node_base_t *node_base, const mp_obj_type_t *mp_type, uint8_t node_type, uint8_t layer){
     node_base->base.type = mp_type;
     node_base->layer = layer;
     node_base->type = node_type;
-    node_base->object_list_node = engine_add_object_to_layer(node_base, node_base->layer);
-    node_base->deletable_list_node = NULL;
+    linked_list_node_init(&node_base->layer_link);
+    linked_list_node_init(&node_base->deletable_link);
+    linked_list_node_init(&node_base->collection_link);
+    linked_list_node_init(&node_base->parent_link);
+    linked_list_node_init(&node_base->tick_link);
+    linked_list_init(&node_base->children_node_bases);
+    engine_add_object_to_layer(node_base, node_base->layer);
     node_base->parent_node_base = NULL;
     node_base_set_if_visible(node_base, true);
     node_base_set_if_disabled(node_base, false);
     node_base_set_if_just_added(node_base, true);
+
+    // Worked out the first time it's asked for
+    node_base_set_if_transform_dirty(node_base, true);
+    node_base->inherited_2d_version = 0;
+    node_base->watched_2d[0] = MP_OBJ_NULL;
+    node_base->watched_2d[1] = MP_OBJ_NULL;
+    node_base->watched_2d[2] = MP_OBJ_NULL;
+
     node_base_set_inherit_opacity(node_base, true);
     node_base_set_inherit_scale(node_base, true);
     node_base_set_inherit_position(node_base, true);
     node_base_set_inherit_rotation(node_base, true);
+
+    node_base->global_position = MP_OBJ_NULL;
+
+    node_base->tick_policy = NODE_BASE_TICK_ALWAYS;
+    node_base->tick_interval = 1;
+    node_base->tick_phase = node_base_next_tick_phase++;
+    node_base->tick_distance = 128.0f;
+    node_base->tick_dt_ms = 0.0f;
+
+    node_base->bitmap_cache = NULL;
+    node_base_set_if_draw_dirty(node_base, true);
+    node_base_set_if_bitmap_cached(node_base, false);
+    node_base_set_if_bitmap_cache_drawing(node_base, false);
+
+    // Until drawn, count as seen so that nodes that only tick
+    // when on screen get their first tick
+    node_base_set_if_on_screen(node_base, true);
 }
 
 
@@ -107,6 +155,8 @@ void node_base_set_inherit_opacity(engine_node_base_t *node_base, bool inherit_o
     }else{
         BIT_SET_FALSE(node_base->meta_data, NODE_BASE_INHERIT_OPACITY_BIT_INDEX);
     }
+
+    node_base_set_transform_changed(node_base);
 }
 
 bool node_base_does_inherit_scale(engine_node_base_t *node_base){
@@ -119,6 +169,8 @@ void node_base_set_inherit_scale(engine_node_base_t *node_base, bool inherit_sca
     }else{
         BIT_SET_FALSE(node_base->meta_data, NODE_BASE_INHERIT_SCALE_BIT_INDEX);
     }
+
+    node_base_set_transform_changed(node_base);
 }
 
 bool node_base_does_inherit_position(engine_node_base_t *node_base){
@@ -131,6 +183,8 @@ void node_base_set_inherit_position(engine_node_base_t *node_base, bool inherit_
     }else{
         BIT_SET_FALSE(node_base->meta_data, NODE_BASE_INHERIT_POSITION_BIT_INDEX);
     }
+
+    node_base_set_transform_changed(node_base);
 }
 
 bool node_base_does_inherit_rotation(engine_node_base_t *node_base){
@@ -143,6 +197,222 @@ void node_base_set_inherit_rotation(engine_node_base_t *node_base, bool inherit_
     }else{
         BIT_SET_FALSE(node_base->meta_data, NODE_BASE_INHERIT_ROTATION_BIT_INDEX);
     }
+
+    node_base_set_transform_changed(node_base);
+}
+
+bool node_base_is_transform_dirty(engine_node_base_t *node_base){
+    return BIT_GET(node_base->meta_data, NODE_BASE_TRANSFORM_DIRTY_BIT_INDEX);
+}
+
+void node_base_set_if_transform_dirty(engine_node_base_t *node_base, bool is_transform_dirty){
+    if(is_transform_dirty){
+        BIT_SET_TRUE(node_base->meta_data, NODE_BASE_TRANSFORM_DIRTY_BIT_INDEX);
+    }else{
+        BIT_SET_FALSE(node_base->meta_data, NODE_BASE_TRANSFORM_DIRTY_BIT_INDEX);
+    }
+}
+
+void node_base_set_transform_changed(engine_node_base_t *node_base){
+    // A node is only cleaned after its parents are, so
+    // the children of a dirty node are all dirty too
+    if(node_base_is_transform_dirty(node_base)){
+        return;
+    }
+
+    node_base_set_if_transform_dirty(node_base, true);
+
+    linked_list_node *current_child_link_node = node_base->children_node_bases.start;
+
+    while(current_child_link_node != NULL){
+        node_base_set_transform_changed(current_child_link_node->object);
+        current_child_link_node = current_child_link_node->next;
+    }
+}
+
+
+// Links a node into the change callback of a Vector2 or Vector3 that is
+// part of its transform, so that changing `x`/`y`/`z` in place marks it
+// changed. More than one node can watch the same vector, each watcher
+// calls the one that was there before it
+typedef void (*node_base_vector_changed_t)(void *on_change_user_ptr);
+
+typedef struct{
+    engine_node_base_t *node_base;
+    node_base_vector_changed_t next_on_changed;
+    void *next_on_change_user_ptr;
+}node_base_vector_watcher_t;
+
+
+static void node_base_on_vector_changed(void *on_change_user_ptr){
+    node_base_vector_watcher_t *watcher = on_change_user_ptr;
+    node_base_set_transform_changed(watcher->node_base);
+
+    if(watcher->next_on_changed != NULL){
+        watcher->next_on_changed(watcher->next_on_change_user_ptr);
+    }
+}
+
+
+// Gets where the change callback of `vector` is kept. Returns false if it
+// isn't a vector or its callbacks are used for something else (like the
+// ends of a `Line2DNode`), the owner of those marks the node changed
+static bool node_base_get_vector_callback(mp_obj_t vector, node_base_vector_changed_t **on_changed, void ***on_change_user_ptr){
+    if(mp_obj_is_type(vector, &vector2_class_type)){
+        vector2_class_obj_t *vector2 = vector;
+
+        if(vector2->on_changing != NULL){
+            return false;
+        }
+
+        *on_changed = &vector2->on_changed;
+        *on_change_user_ptr = &vector2->on_change_user_ptr;
+    }else if(mp_obj_is_type(vector, &vector3_class_type)){
+        vector3_class_obj_t *vector3 = vector;
+        *on_changed = &vector3->on_changed;
+        *on_change_user_ptr = &vector3->on_change_user_ptr;
+    }else{
+        return false;
+    }
+
+    return **on_changed == NULL || **on_changed == node_base_on_vector_changed;
+}
+
+
+static void node_base_watch_vector(engine_node_base_t *node_base, mp_obj_t vector){
+    node_base_vector_changed_t *on_changed;
+    void **on_change_user_ptr;
+
+    if(node_base_get_vector_callback(vector, &on_changed, &on_change_user_ptr) == false){
+        return;
+    }
+
+    // Only watch once
+    node_base_vector_changed_t current_on_changed = *on_changed;
+    void *current_on_change_user_ptr = *on_change_user_ptr;
+
+    while(current_on_changed == node_base_on_vector_changed){
+        node_base_vector_watcher_t *watcher = current_on_change_user_ptr;
+
+        if(watcher->node_base == node_base){
+            return;
+        }
+
+        current_on_changed = watcher->next_on_changed;
+        current_on_change_user_ptr = watcher->next_on_change_user_ptr;
+    }
+
+    node_base_vector_watcher_t *watcher = m_new(node_base_vector_watcher_t, 1);
+    watcher->node_base = node_base;
+    watcher->next_on_changed = *on_changed;
+    watcher->next_on_change_user_ptr = *on_change_user_ptr;
+
+    *on_changed = node_base_on_vector_changed;
+    *on_change_user_ptr = watcher;
+}
+
+
+static void node_base_unwatch_vector(engine_node_base_t *node_base, mp_obj_t vector){
+    node_base_vector_changed_t *on_changed;
+    void **on_change_user_ptr;
+
+    if(node_base_get_vector_callback(vector, &on_changed, &on_change_user_ptr) == false){
+        return;
+    }
+
+    while(*on_changed == node_base_on_vector_changed){
+        node_base_vector_watcher_t *watcher = *on_change_user_ptr;
+
+        if(watcher->node_base == node_base){
+            *on_changed = watcher->next_on_changed;
+            *on_change_user_ptr = watcher->next_on_change_user_ptr;
+            return;
+        }
+
+        on_changed = &watcher->next_on_changed;
+        on_change_user_ptr = &watcher->next_on_change_user_ptr;
+    }
+}
+
+
+// Watches the objects in `objects` (position, scale and rotation) in
+// place of the ones watched before, MP_OBJ_NULL to stop watching
+static void node_base_watch_2d(engine_node_base_t *node_base, mp_obj_t objects[3]){
+    for(uint8_t index=0; index<3; index++){
+        if(node_base->watched_2d[index] == objects[index]){
+            continue;
+        }
+
+        if(node_base->watched_2d[index] != MP_OBJ_NULL){
+            node_base_unwatch_vector(node_base, node_base->watched_2d[index]);
+        }
+
+        if(objects[index] != MP_OBJ_NULL){
+            node_base_watch_vector(node_base, objects[index]);
+        }
+
+        node_base->watched_2d[index] = objects[index];
+    }
+}
+
+bool node_base_is_ticking(engine_node_base_t *node_base){
+    return BIT_GET(node_base->meta_data, NODE_BASE_TICKING_BIT_INDEX);
+}
+
+void node_base_set_if_ticking(engine_node_base_t *node_base, bool is_ticking){
+    if(is_ticking){
+        BIT_SET_TRUE(node_base->meta_data, NODE_BASE_TICKING_BIT_INDEX);
+    }else{
+        BIT_SET_FALSE(node_base->meta_data, NODE_BASE_TICKING_BIT_INDEX);
+    }
+}
+
+bool node_base_is_on_screen(engine_node_base_t *node_base){
+    return BIT_GET(node_base->meta_data, NODE_BASE_ON_SCREEN_BIT_INDEX);
+}
+
+void node_base_set_if_on_screen(engine_node_base_t *node_base, bool is_on_screen){
+    if(is_on_screen){
+        BIT_SET_TRUE(node_base->meta_data, NODE_BASE_ON_SCREEN_BIT_INDEX);
+    }else{
+        BIT_SET_FALSE(node_base->meta_data, NODE_BASE_ON_SCREEN_BIT_INDEX);
+    }
+}
+
+bool node_base_is_draw_dirty(engine_node_base_t *node_base){
+    return BIT_GET(node_base->meta_data, NODE_BASE_DRAW_DIRTY_BIT_INDEX);
+}
+
+void node_base_set_if_draw_dirty(engine_node_base_t *node_base, bool is_draw_dirty){
+    if(is_draw_dirty){
+        BIT_SET_TRUE(node_base->meta_data, NODE_BASE_DRAW_DIRTY_BIT_INDEX);
+    }else{
+        BIT_SET_FALSE(node_base->meta_data, NODE_BASE_DRAW_DIRTY_BIT_INDEX);
+    }
+}
+
+bool node_base_is_bitmap_cached(engine_node_base_t *node_base){
+    return BIT_GET(node_base->meta_data, NODE_BASE_BITMAP_CACHED_BIT_INDEX);
+}
+
+void node_base_set_if_bitmap_cached(engine_node_base_t *node_base, bool is_bitmap_cached){
+    if(is_bitmap_cached){
+        BIT_SET_TRUE(node_base->meta_data, NODE_BASE_BITMAP_CACHED_BIT_INDEX);
+    }else{
+        BIT_SET_FALSE(node_base->meta_data, NODE_BASE_BITMAP_CACHED_BIT_INDEX);
+    }
+}
+
+bool node_base_is_bitmap_cache_drawing(engine_node_base_t *node_base){
+    return BIT_GET(node_base->meta_data, NODE_BASE_BITMAP_CACHE_DRAWING_BIT_INDEX);
+}
+
+void node_base_set_if_bitmap_cache_drawing(engine_node_base_t *node_base, bool is_bitmap_cache_drawing){
+    if(is_bitmap_cache_drawing){
+        BIT_SET_TRUE(node_base->meta_data, NODE_BASE_BITMAP_CACHE_DRAWING_BIT_INDEX);
+    }else{
+        BIT_SET_FALSE(node_base->meta_data, NODE_BASE_BITMAP_CACHE_DRAWING_BIT_INDEX);
+    }
 }
 
 
@@ -164,6 +434,119 @@ engine_node_base_t *node_base_get(mp_obj_t object, bool *is_obj_instance){
 }
 
 
+float *node_base_get_float_attr(mp_obj_t object, qstr attr, engine_node_base_t **node_base){
+    if(mp_obj_is_obj(object) == false){
+        return NULL;
+    }
+
+    // Python class instances of nodes keep their node base as an
+    // attribute, anything else without one isn't a node
+    mp_obj_t node_base_obj = object;
+    if(mp_obj_is_instance_type(mp_obj_get_type(object))){
+        node_base_obj = engine_mp_load_attr_maybe(object, MP_QSTR_node_base);
+
+        if(node_base_obj == MP_OBJ_NULL || mp_obj_is_obj(node_base_obj) == false){
+            return NULL;
+        }
+    }
+
+    const mp_obj_type_t *type = mp_obj_get_type(node_base_obj);
+    if(type != &engine_camera_node_class_type &&
+       type != &engine_physics_rectangle_2d_node_class_type &&
+       type != &engine_physics_circle_2d_node_class_type &&
+       type != &engine_rectangle_2d_node_class_type &&
+       type != &engine_line_2d_node_class_type &&
+       type != &engine_circle_2d_node_class_type &&
+       type != &engine_sprite_2d_node_class_type &&
+       type != &engine_text_2d_node_class_type &&
+       type != &engine_gui_button_2d_node_class_type &&
+       type != &engine_gui_bitmap_button_2d_node_class_type &&
+       type != &engine_tile_map_2d_node_class_type){
+        return NULL;
+    }
+
+    *node_base = node_base_obj;
+    float *rotation = NULL;
+    float *opacity = NULL;
+
+    switch((*node_base)->type){
+        case NODE_TYPE_CAMERA:
+        {
+            engine_camera_node_class_obj_t *node = (*node_base)->node;
+            if(attr == MP_QSTR_zoom) return &node->zoom;
+            opacity = &node->opacity;
+        }
+        break;
+        case NODE_TYPE_PHYSICS_RECTANGLE_2D:
+        case NODE_TYPE_PHYSICS_CIRCLE_2D:
+        {
+            engine_physics_node_base_t *node = (*node_base)->node;
+            rotation = &node->rotation;
+        }
+        break;
+        case NODE_TYPE_RECTANGLE_2D:
+        {
+            engine_rectangle_2d_node_class_obj_t *node = (*node_base)->node;
+            rotation = &node->rotation;
+            opacity = &node->opacity;
+        }
+        break;
+        case NODE_TYPE_LINE_2D:
+        {
+            engine_line_2d_node_class_obj_t *node = (*node_base)->node;
+            opacity = &node->opacity;
+        }
+        break;
+        case NODE_TYPE_CIRCLE_2D:
+        {
+            engine_circle_2d_node_class_obj_t *node = (*node_base)->node;
+            rotation = &node->rotation;
+            opacity = &node->opacity;
+        }
+        break;
+        case NODE_TYPE_SPRITE_2D:
+        {
+            engine_sprite_2d_node_class_obj_t *node = (*node_base)->node;
+            rotation = &node->rotation;
+            opacity = &node->opacity;
+        }
+        break;
+        case NODE_TYPE_TEXT_2D:
+        {
+            engine_text_2d_node_class_obj_t *node = (*node_base)->node;
+            rotation = &node->rotation;
+            opacity = &node->opacity;
+        }
+        break;
+        case NODE_TYPE_GUI_BUTTON_2D:
+        {
+            engine_gui_button_2d_node_class_obj_t *node = (*node_base)->node;
+            rotation = &node->rotation;
+            opacity = &node->opacity;
+        }
+        break;
+        case NODE_TYPE_GUI_BITMAP_BUTTON_2D:
+        {
+            engine_gui_bitmap_button_2d_node_class_obj_t *node = (*node_base)->node;
+            rotation = &node->rotation;
+            opacity = &node->opacity;
+        }
+        break;
+        case NODE_TYPE_TILE_MAP_2D:
+        {
+            engine_tile_map_2d_node_class_obj_t *node = (*node_base)->node;
+            rotation = &node->rotation;
+            opacity = &node->opacity;
+        }
+        break;
+    }
+
+    if(attr == MP_QSTR_rotation) return rotation;
+    if(attr == MP_QSTR_opacity) return opacity;
+    return NULL;
+}
+
+
 mp_obj_t node_base_del(mp_obj_t self_in){
     ENGINE_INFO_PRINTF("Node Base: Deleted (garbage collected, removing self from active engine objects): %s", mp_obj_get_type_str(self_in));
 
@@ -173,32 +556,25 @@ mp_obj_t node_base_del(mp_obj_t self_in){
     if(node_base->parent_node_base != NULL){
         engine_node_base_t *parent_node_base = node_base->parent_node_base;
 
-        linked_list_del_list_node(&parent_node_base->children_node_bases, node_base->location_in_parents_children);
-
-        node_base->location_in_parents_children = NULL;
+        linked_list_remove_node(&parent_node_base->children_node_bases, &node_base->parent_link);
         node_base->parent_node_base = NULL;
     }
 
     // If this node has child nodes, go through all children and unlink to this as a parent
-    if(node_base->children_node_bases.count != 0){
-        linked_list_node *current_child_node_base = node_base->children_node_bases.start;
-
-        while(current_child_node_base != NULL){
-            engine_node_base_t *child_node_base = current_child_node_base->object;
-            child_node_base->parent_node_base = NULL;
-            child_node_base->location_in_parents_children = NULL;
-
-            linked_list_node *next_child_node_base = current_child_node_base->next;
+    while(node_base->children_node_bases.start != NULL){
+        engine_node_base_t *child_node_base = node_base->children_node_bases.start->object;
+        linked_list_remove_node(&node_base->children_node_bases, &child_node_base->parent_link);
+        child_node_base->parent_node_base = NULL;
+        node_base_set_transform_changed(child_node_base);
+    }
 
-            // This linked list is being deleted, free each node as we go
-            free(current_child_node_base);
+    // Vectors kept elsewhere would still point here
+    node_base_watch_2d(node_base, (mp_obj_t[3]){MP_OBJ_NULL, MP_OBJ_NULL, MP_OBJ_NULL});
 
-            current_child_node_base = next_child_node_base;
-        }
-    }
+    node_bitmap_cache_set_enabled(node_base, false);
 
-    engine_remove_object_from_layer(node_base->object_list_node, node_base->layer);
-    engine_collections_untrack_deletable(node_base->deletable_list_node);
+    engine_remove_object_from_layer(node_base, node_base->layer);
+    engine_collections_untrack_deletable(node_base);
 
     return mp_const_none;
 }
@@ -216,7 +592,7 @@ mp_obj_t node_base_mark_destroy(mp_obj_t self_in){
     // Don't want to track a node for deletion twice
     if(node_base_is_deletable(node_base) == false){
         node_base_set_if_deletable(node_base, true);
-        node_base->deletable_list_node = engine_collections_track_deletable(node_base);
+        engine_collections_track_deletable(node_base);
     }
 
     return mp_const_none;
@@ -281,8 +657,15 @@ mp_obj_t node_base_add_child(mp_obj_t self_parent_in, mp_obj_t child_in){
     
     ENGINE_INFO_PRINTF("Node Base: Adding child... parent node type: %d, child node type: %d", parent_node_base->type, child_node_base->type);
 
-    child_node_base->location_in_parents_children = linked_list_add_obj(&parent_node_base->children_node_bases, child_node_base);
+    // A node can only have one parent, leave the old one first
+    if(child_node_base->parent_node_base != NULL){
+        engine_node_base_t *old_parent_node_base = child_node_base->parent_node_base;
+        linked_list_remove_node(&old_parent_node_base->children_node_bases, &child_node_base->parent_link);
+    }
+
+    linked_list_add_node(&parent_node_base->children_node_bases, &child_node_base->parent_link, child_node_base);
     child_node_base->parent_node_base = parent_node_base;
+    node_base_set_transform_changed(child_node_base);
 
     return mp_const_none;
 }
@@ -350,9 +733,9 @@ mp_obj_t node_base_remove_child(mp_obj_t self_parent_in, mp_obj_t child_in){
 
     // Check if the child's parent equals this node's memory location (bad idea?)
     if(child_node_base->parent_node_base == parent_node_base){
-        linked_list_del_list_node(&parent_node_base->children_node_bases, child_node_base->location_in_parents_children);
+        linked_list_remove_node(&parent_node_base->children_node_bases, &child_node_base->parent_link);
         child_node_base->parent_node_base = NULL;
-        child_node_base->location_in_parents_children = NULL;
+        node_base_set_transform_changed(child_node_base);
     }else{
         mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("Child node does not exist on this parent, cannot remove!"));
     }
@@ -379,233 +762,308 @@ mp_obj_t node_base_get_parent(mp_obj_t self_in){
 
 
 void node_base_set_layer(engine_node_base_t *node_base, uint8_t layer){
-    engine_remove_object_from_layer(node_base->object_list_node, node_base->layer);
+    engine_remove_object_from_layer(node_base, node_base->layer);
     node_base->layer = layer;
-    node_base->object_list_node = engine_add_object_to_layer(node_base, node_base->layer);
+    engine_add_object_to_layer(node_base, node_base->layer);
 }
 
 
-void node_base_inherit_2d(mp_obj_t child_node_base, engine_inheritable_2d_t *inheritable){
-    engine_node_base_t *node_base = child_node_base;
+// Reads rotation and opacity of the built-in nodes straight from their
+// structures (they are stored as floats or a Vector3) and hands back
+// their position, scale and rotation objects (MP_OBJ_NULL when there is
+// no object). Loading these as attributes would box a new float per
+// node. Returns `false` for node types that don't have a layout here,
+// those go through attribute lookup
+static bool node_base_get_local_2d_native(engine_node_base_t *node_base, mp_obj_t *position, mp_obj_t *scale, mp_obj_t *rotation, engine_inheritable_2d_t *local){
+    *scale = MP_OBJ_NULL;
+    *rotation = MP_OBJ_NULL;
+    local->rotation = 0.0f;
+    local->opacity = 1.0f;
+
+    switch(node_base->type){
+        case NODE_TYPE_EMPTY:
+        {
+            engine_empty_node_class_obj_t *node = node_base->node;
+            *position = node->position;
+            *rotation = node->rotation;
+            local->rotation = ((vector3_class_obj_t*)node->rotation)->z.value;
+        }
+        break;
+        case NODE_TYPE_CAMERA:
+        {
+            engine_camera_node_class_obj_t *node = node_base->node;
+            *position = node->position;
+            *rotation = node->rotation;
+            local->rotation = ((vector3_class_obj_t*)node->rotation)->z.value;
+            local->opacity = node->opacity;
+        }
+        break;
+        case NODE_TYPE_PHYSICS_RECTANGLE_2D:
+        case NODE_TYPE_PHYSICS_CIRCLE_2D:
+        {
+            engine_physics_node_base_t *node = node_base->node;
+            *position = node->position;
+            local->rotation = node->rotation;
+        }
+        break;
+        case NODE_TYPE_RECTANGLE_2D:
+        {
+            engine_rectangle_2d_node_class_obj_t *node = node_base->node;
+            *position = node->position;
+            *scale = node->scale;
+            local->rotation = node->rotation;
+            local->opacity = node->opacity;
+        }
+        break;
+        case NODE_TYPE_LINE_2D:
+        {
+            engine_line_2d_node_class_obj_t *node = node_base->node;
+            *position = node->position;
+            local->opacity = node->opacity;
+        }
+        break;
+        case NODE_TYPE_CIRCLE_2D:
+        {
+            engine_circle_2d_node_class_obj_t *node = node_base->node;
+            *position = node->position;
+            *scale = node->scale;
+            local->rotation = node->rotation;
+            local->opacity = node->opacity;
+        }
+        break;
+        case NODE_TYPE_SPRITE_2D:
+        {
+            engine_sprite_2d_node_class_obj_t *node = node_base->node;
+            *position = node->position;
+            *scale = node->scale;
+            local->rotation = node->rotation;
+            local->opacity = node->opacity;
+        }
+        break;
+        case NODE_TYPE_TEXT_2D:
+        {
+            engine_text_2d_node_class_obj_t *node = node_base->node;
+            *position = node->position;
+            *scale = node->scale;
+            local->rotation = node->rotation;
+            local->opacity = node->opacity;
+        }
+        break;
+        case NODE_TYPE_GUI_BUTTON_2D:
+        {
+            engine_gui_button_2d_node_class_obj_t *node = node_base->node;
+            *position = node->position;
+            *scale = node->scale;
+            local->rotation = node->rotation;
+            local->opacity = node->opacity;
+        }
+        break;
+        case NODE_TYPE_GUI_BITMAP_BUTTON_2D:
+        {
+            engine_gui_bitmap_button_2d_node_class_obj_t *node = node_base->node;
+            *position = node->position;
+            *scale = node->scale;
+            local->rotation = node->rotation;
+            local->opacity = node->opacity;
+        }
+        break;
+        case NODE_TYPE_TILE_MAP_2D:
+        {
+            engine_tile_map_2d_node_class_obj_t *node = node_base->node;
+            *position = node->position;
+            *scale = node->scale;
+            local->rotation = node->rotation;
+            local->opacity = node->opacity;
+        }
+        break;
+        default:
+            return false;
+    }
 
-    // Init structure
-    mp_obj_t child_position = mp_load_attr(node_base->attr_accessor, MP_QSTR_position);
-    mp_obj_t child_rotation = engine_mp_load_attr_maybe(node_base->attr_accessor, MP_QSTR_rotation);
-    mp_obj_t child_scale =    engine_mp_load_attr_maybe(node_base->attr_accessor, MP_QSTR_scale);
-
-    // Setup initial position (no nodes have 1D position)
-    if(mp_obj_is_type(child_position, &vector3_class_type)){
-        inheritable->px = ((vector3_class_obj_t*)child_position)->x.value;
-        inheritable->py = ((vector3_class_obj_t*)child_position)->y.value;
-    }else if(mp_obj_is_type(child_position, &vector2_class_type)){
-        inheritable->px = ((vector2_class_obj_t*)child_position)->x.value;
-        inheritable->py = ((vector2_class_obj_t*)child_position)->y.value;
-    }else{
-        mp_raise_msg_varg(&mp_type_RuntimeError, MP_ERROR_TEXT("NodeBase: Error: Do not know how to set initial inherit 2D position for this `position `object type!, got %s"), mp_obj_get_type_str(child_position));
-    }
-
-    // Setup initial rotation (no nodes have 2D rotation)
-    if(child_rotation == MP_OBJ_NULL){
-        inheritable->rotation = 0.0f;
-    }else if(mp_obj_is_type(child_rotation, &vector3_class_type)){
-        inheritable->rotation = ((vector3_class_obj_t*)child_rotation)->z.value;
-    }else if(mp_obj_is_float(child_rotation)){
-        inheritable->rotation = (float)mp_obj_get_float(child_rotation);
-    }else if(mp_obj_is_int(child_rotation)){
-        inheritable->rotation = (float)mp_obj_get_int(child_rotation);
-    }else{
-        mp_raise_msg_varg(&mp_type_RuntimeError, MP_ERROR_TEXT("NodeBase: Error: Do not know how to set initial inherit 2D rotation for this `rotation` object type!, got %s"), mp_obj_get_type_str(child_rotation));
-    }
-
-    // Setup initial scale (some nodes, like circles, have 1D scale)
-    if(child_scale == MP_OBJ_NULL){
-        inheritable->sx = 1.0f;
-        inheritable->sy = 1.0f;
-    }else if(mp_obj_is_type(child_scale, &vector3_class_type)){
-        inheritable->sx = ((vector3_class_obj_t*)child_scale)->x.value;
-        inheritable->sy = ((vector3_class_obj_t*)child_scale)->y.value;
-    }else if(mp_obj_is_type(child_scale, &vector2_class_type)){
-        inheritable->sx = ((vector2_class_obj_t*)child_scale)->x.value;
-        inheritable->sy = ((vector2_class_obj_t*)child_scale)->y.value;
-    }else if(mp_obj_is_float(child_scale)){
-        float scale = mp_obj_get_float(child_scale);
-        inheritable->sx = scale;
-        inheritable->sy = scale;
-    }else if(mp_obj_is_int(child_scale)){
-        float scale = (float)mp_obj_get_int(child_scale);
-        inheritable->sx = scale;
-        inheritable->sy = scale;
-    }else{
-        mp_raise_msg_varg(&mp_type_RuntimeError, MP_ERROR_TEXT("NodeBase: Error: Do not know how to set initial inherit 2D scale for this `scale `object type, got %s!"), mp_obj_get_type_str(child_scale));
+    return true;
+}
+
+
+// Fills 'local' with only this node's own 2D transform (no parents applied)
+// and 'objects' with the position, scale and rotation objects it came from
+static void node_base_get_local_2d(engine_node_base_t *node_base, engine_inheritable_2d_t *local, mp_obj_t objects[3]){
+    mp_obj_t position = MP_OBJ_NULL;
+    mp_obj_t scale = MP_OBJ_NULL;
+    mp_obj_t rotation = MP_OBJ_NULL;
+
+    if(node_base_get_local_2d_native(node_base, &position, &scale, &rotation, local) == false){
+        position = mp_load_attr(node_base->attr_accessor, MP_QSTR_position);
+        scale = engine_mp_load_attr_maybe(node_base->attr_accessor, MP_QSTR_scale);
+        rotation = engine_mp_load_attr_maybe(node_base->attr_accessor, MP_QSTR_rotation);
+
+        mp_obj_t opacity =  engine_mp_load_attr_maybe(node_base->attr_accessor, MP_QSTR_opacity);
+
+        // Setup rotation (no nodes have 2D rotation, use
+        // z-axis rotation of 3D nodes for 2D rotation)
+        if(rotation == MP_OBJ_NULL){
+            local->rotation = 0.0f;
+        }else if(mp_obj_is_type(rotation, &vector3_class_type)){
+            local->rotation = ((vector3_class_obj_t*)rotation)->z.value;
+        }else if(mp_obj_is_float(rotation)){
+            local->rotation = (float)mp_obj_get_float(rotation);
+        }else if(mp_obj_is_int(rotation)){
+            local->rotation = (float)mp_obj_get_int(rotation);
+        }else{
+            mp_raise_msg_varg(&mp_type_RuntimeError, MP_ERROR_TEXT("NodeBase: Error: Do not know how to get 2D rotation for this `rotation` object type!, got %s"), mp_obj_get_type_str(rotation));
+        }
+
+        // Setup opacity (most nodes use single float for opacity,
+        // except for things like physics and voxelspace)
+        local->opacity = 1.0f;
+        if(opacity != MP_OBJ_NULL){
+            local->opacity = mp_obj_get_float(opacity);
+        }
     }
 
-    // Setup initial opacity and `is camera child`
-    // flag (most nodes use single float for opacity,
-    // except for things like physics and voxelspace)
-    mp_obj_t child_opacity_obj = engine_mp_load_attr_maybe(node_base->attr_accessor, MP_QSTR_opacity);
-    inheritable->opacity = 1.0f;
-    if(child_opacity_obj != MP_OBJ_NULL){
-        inheritable->opacity = mp_obj_get_float(child_opacity_obj);
+    // Setup position (no nodes have 1D position, use
+    // projection of 3D position for 2D position)
+    if(mp_obj_is_type(position, &vector3_class_type)){
+        local->px = ((vector3_class_obj_t*)position)->x.value;
+        local->py = ((vector3_class_obj_t*)position)->y.value;
+    }else if(mp_obj_is_type(position, &vector2_class_type)){
+        local->px = ((vector2_class_obj_t*)position)->x.value;
+        local->py = ((vector2_class_obj_t*)position)->y.value;
+    }else{
+        mp_raise_msg_varg(&mp_type_RuntimeError, MP_ERROR_TEXT("NodeBase: Error: Do not know how to get 2D position for this `position `object type!, got %s"), mp_obj_get_type_str(position));
     }
-    
-    inheritable->is_camera_child = false;
 
-    // Before doing anything else, check if this child
-    // even has a parent (still needed to ensure struct
-    // is initialzed)
-    if(node_base->parent_node_base == NULL){
-        return;
+    // Setup scale (some nodes, like circles, have 1D scale)
+    if(scale == MP_OBJ_NULL){
+        local->sx = 1.0f;
+        local->sy = 1.0f;
+    }else if(mp_obj_is_type(scale, &vector3_class_type)){
+        local->sx = ((vector3_class_obj_t*)scale)->x.value;
+        local->sy = ((vector3_class_obj_t*)scale)->y.value;
+    }else if(mp_obj_is_type(scale, &vector2_class_type)){
+        local->sx = ((vector2_class_obj_t*)scale)->x.value;
+        local->sy = ((vector2_class_obj_t*)scale)->y.value;
+    }else if(mp_obj_is_float(scale)){
+        float uniform_scale = mp_obj_get_float(scale);
+        local->sx = uniform_scale;
+        local->sy = uniform_scale;
+    }else if(mp_obj_is_int(scale)){
+        float uniform_scale = (float)mp_obj_get_int(scale);
+        local->sx = uniform_scale;
+        local->sy = uniform_scale;
+    }else{
+        mp_raise_msg_varg(&mp_type_RuntimeError, MP_ERROR_TEXT("NodeBase: Error: Do not know how to get 2D scale for this `scale `object type, got %s!"), mp_obj_get_type_str(scale));
     }
 
-    // At this point, the `inheritable` structure only contains the
-    // childs attributes which are needed by the child anyways. Now,
-    // as we traverse the parents above it, if at any point one of
-    // the parents stops inheriting the below attributes, stop inheriting
-    // them from then on.
-    bool stop_inheriting_opacity = false;
-    bool stop_inheriting_scale = false;
-    bool stop_inheriting_position = false;
-    bool stop_inheriting_rotation = false;
+    local->is_camera_child = false;
 
-    // Start the traversal upwards until we get to a NULL parent
-    engine_node_base_t *current_node_base = node_base;
+    objects[0] = position;
+    objects[1] = scale;
+    objects[2] = rotation;
+}
 
-    while(true){
-        // Update which atributes to not inherit before getting the
-        // parent attributes. Only update if we haven't run into a
-        // child or parent of the child that stops inheriting. If we
-        // did, we want to always stop inheriting that attribute as
-        // we go further
-        if(stop_inheriting_opacity == false)  stop_inheriting_opacity  = !node_base_does_inherit_opacity(current_node_base);
-        if(stop_inheriting_scale == false)    stop_inheriting_scale    = !node_base_does_inherit_scale(current_node_base);
-        if(stop_inheriting_position == false) stop_inheriting_position = !node_base_does_inherit_position(current_node_base);
-        if(stop_inheriting_rotation == false) stop_inheriting_rotation = !node_base_does_inherit_rotation(current_node_base);
-
-        // If everything is not being inherited, stop the
-        // loop since there's no reason to keep going
-        if(stop_inheriting_opacity == true && stop_inheriting_scale == true && stop_inheriting_position == true && stop_inheriting_rotation == true){
-            break;
-        }
 
-        // Get the parent node base from the node we were just on.
-        // At this point, do update the attributes to not
-        engine_node_base_t *parent_node_base = current_node_base->parent_node_base;
+static bool node_base_inherited_2d_equal(engine_inheritable_2d_t *a, engine_inheritable_2d_t *b){
+    return a->px == b->px && a->py == b->py && a->rotation == b->rotation &&
+           a->sx == b->sx && a->sy == b->sy && a->opacity == b->opacity &&
+           a->is_camera_child == b->is_camera_child;
+}
 
-        // Stop traversal only if the parent of
-        // the current traversal node is NULL
-        if(parent_node_base == NULL){
-            break;
-        }
 
-        // Get this to stop translations for camera
-        // children due to camera transformation
-        if(parent_node_base->type == NODE_TYPE_CAMERA){
-            inheritable->is_camera_child = true;
+// Works out the world transform of a node from its own transform and
+// the cached world transform of its parent, which has to be up to date
+static void node_base_compute_inherited_2d(engine_node_base_t *node_base, engine_inheritable_2d_t *inheritable, mp_obj_t objects[3]){
+    // Start with only the child's attributes
+    node_base_get_local_2d(node_base, inheritable, objects);
 
-            // Do not care about the rest of the
-            // transformations the camera might
-            // have due to its parents
-            break;
-        }
+    engine_node_base_t *parent_node_base = node_base->parent_node_base;
 
-        // Setup temps that are re-used in multiple ways
-        float temp_parent_pos_x = 0.0f;
-        float temp_parent_pos_y = 0.0f;
-        float temp_parent_rot = 0.0f;
-        float temp_parent_scale_x = 1.0f;
-        float temp_parent_scale_y = 1.0f;
-        float temp_parent_opacity = 1.0f;
-
-        // Get position from parent
-        if(stop_inheriting_position == false){
-            mp_obj_t parent_position = mp_load_attr(parent_node_base->attr_accessor, MP_QSTR_position);
-
-            // Decode parent position (use projection of 3D position
-            // for respective 2D position that child will rotate around)
-            if(mp_obj_is_type(parent_position, &vector3_class_type)){
-                temp_parent_pos_x = ((vector3_class_obj_t*)parent_position)->x.value;
-                temp_parent_pos_y = ((vector3_class_obj_t*)parent_position)->y.value;
-            }else if(mp_obj_is_type(parent_position, &vector2_class_type)){
-                temp_parent_pos_x = ((vector2_class_obj_t*)parent_position)->x.value;
-                temp_parent_pos_y = ((vector2_class_obj_t*)parent_position)->y.value;
-            }else{
-                mp_raise_msg_varg(&mp_type_RuntimeError, MP_ERROR_TEXT("NodeBase: Error: Do not know how to get inherited 2D position for this `position `object type! got, %s"), mp_obj_get_type_str(parent_position));
-            }
-        }
+    if(parent_node_base == NULL){
+        return;
+    }
 
-        // Get rotation from parent
-        if(stop_inheriting_rotation == false){
-            mp_obj_t parent_rotation = engine_mp_load_attr_maybe(parent_node_base->attr_accessor, MP_QSTR_rotation);
-
-            // Decode parent rotation (use z-axis rotation of 3D node
-            // for rotation around parent for 2D child node)
-            if(parent_rotation == MP_OBJ_NULL){
-                temp_parent_rot = 0.0f;
-            }else if(mp_obj_is_type(parent_rotation, &vector3_class_type)){
-                temp_parent_rot = ((vector3_class_obj_t*)parent_rotation)->z.value;
-            }else if(mp_obj_is_float(parent_rotation)){
-                temp_parent_rot = mp_obj_get_float(parent_rotation);
-            }else if(mp_obj_is_int(parent_rotation)){
-                inheritable->rotation = (float)mp_obj_get_int(parent_rotation);
-            }else{
-                mp_raise_msg_varg(&mp_type_RuntimeError, MP_ERROR_TEXT("NodeBase: Error: Do not know how to get inherited 2D rotation for this `rotation `object type! got, %s"), mp_obj_get_type_str(parent_rotation));
-            }
-        }
+    // Children of cameras are not moved by the camera's transform
+    if(parent_node_base->type == NODE_TYPE_CAMERA){
+        inheritable->is_camera_child = true;
+        return;
+    }
 
-        // Get scale from parent
-        if(stop_inheriting_scale == false){
-            mp_obj_t parent_scale = engine_mp_load_attr_maybe(parent_node_base->attr_accessor, MP_QSTR_scale);
-
-            // Decode parent scale (use xy of 3D for 2D scale)
-            if(parent_scale == MP_OBJ_NULL){
-                temp_parent_scale_x = 1.0f;
-                temp_parent_scale_y = 1.0f;
-            }else if(mp_obj_is_type(parent_scale, &vector3_class_type)){
-                temp_parent_scale_x = ((vector3_class_obj_t*)parent_scale)->x.value;
-                temp_parent_scale_y = ((vector3_class_obj_t*)parent_scale)->y.value;
-            }else if(mp_obj_is_type(parent_scale, &vector2_class_type)){
-                temp_parent_scale_x = ((vector2_class_obj_t*)parent_scale)->x.value;
-                temp_parent_scale_y = ((vector2_class_obj_t*)parent_scale)->y.value;
-            }else if(mp_obj_is_float(parent_scale)){
-                float scale = mp_obj_get_float(parent_scale);
-                temp_parent_scale_x = scale;
-                temp_parent_scale_y = scale;
-            }else if(mp_obj_is_int(parent_scale)){
-                float scale = (float)mp_obj_get_int(parent_scale);
-                temp_parent_scale_x = scale;
-                temp_parent_scale_y = scale;
-            }else{
-                mp_raise_msg_varg(&mp_type_RuntimeError, MP_ERROR_TEXT("NodeBase: Error: Do not know how to get inherited 2D scale for this `scale `object type! got, %s"), mp_obj_get_type_str(parent_scale));
-            }
-        }
+    // The parent's world transform already has everything above it
+    // applied, leaving out whatever the parent itself doesn't inherit
+    engine_inheritable_2d_t *parent_inherited = &parent_node_base->inherited_2d;
+
+    bool inherit_position = node_base_does_inherit_position(node_base);
+    bool inherit_rotation = node_base_does_inherit_rotation(node_base);
+    bool inherit_scale = node_base_does_inherit_scale(node_base);
+    bool inherit_opacity = node_base_does_inherit_opacity(node_base);
+
+    float parent_pos_x =   inherit_position ? parent_inherited->px : 0.0f;
+    float parent_pos_y =   inherit_position ? parent_inherited->py : 0.0f;
+    float parent_rot =     inherit_rotation ? parent_inherited->rotation : 0.0f;
+    float parent_scale_x = inherit_scale    ? parent_inherited->sx : 1.0f;
+    float parent_scale_y = inherit_scale    ? parent_inherited->sy : 1.0f;
+    float parent_opacity = inherit_opacity  ? parent_inherited->opacity : 1.0f;
+
+    // Scale transformation due to parent scale
+    engine_math_scale_point(&inheritable->px, &inheritable->py, 0, 0, parent_scale_x, parent_scale_y);
+
+    inheritable->px += parent_pos_x;
+    inheritable->py += parent_pos_y;
+    inheritable->rotation += parent_rot;
+    inheritable->sx *= parent_scale_x;
+    inheritable->sy *= parent_scale_y;
+    inheritable->opacity *= parent_opacity;
+
+    // Rotate child around parent
+    engine_math_rotate_point(&inheritable->px, &inheritable->py, parent_pos_x, parent_pos_y, parent_rot);
+
+    // Nothing inherited, nothing from above the parent either
+    if(inherit_position || inherit_rotation || inherit_scale || inherit_opacity){
+        inheritable->is_camera_child = parent_inherited->is_camera_child;
+    }
+}
 
-        // Get opacity from parent
-        if(stop_inheriting_opacity == false){
-            mp_obj_t parent_opacity_obj = engine_mp_load_attr_maybe(parent_node_base->attr_accessor, MP_QSTR_opacity);
 
-            if(parent_opacity_obj != MP_OBJ_NULL){
-                temp_parent_opacity = mp_obj_get_float(parent_opacity_obj);
-            }
-        }
+// Makes sure the cached 'inherited_2d' transform is up to date. Nodes
+// stay clean until they or a parent are marked changed, so this only
+// does work for nodes that changed, walking up through dirty parents
+static void node_base_validate_inherited_2d(engine_node_base_t *node_base){
+    if(node_base_is_transform_dirty(node_base) == false){
+        return;
+    }
 
-        // Scale transformation due to parent scale
-        engine_math_scale_point(&inheritable->px, &inheritable->py, 0, 0, temp_parent_scale_x, temp_parent_scale_y);
+    // Children of cameras do not inherit anything from the
+    // camera so there's no need to validate it as a parent
+    engine_node_base_t *parent_node_base = node_base->parent_node_base;
+
+    if(parent_node_base != NULL && parent_node_base->type != NODE_TYPE_CAMERA){
+        node_base_validate_inherited_2d(parent_node_base);
+    }
 
-        inheritable->px += temp_parent_pos_x;
-        inheritable->py += temp_parent_pos_y;
-        inheritable->rotation += temp_parent_rot;
-        inheritable->sx *= temp_parent_scale_x;
-        inheritable->sy *= temp_parent_scale_y;
-        inheritable->opacity *= temp_parent_opacity;
+    engine_inheritable_2d_t inherited;
+    mp_obj_t objects[3];
+    node_base_compute_inherited_2d(node_base, &inherited, objects);
 
-        // Rotate child around parent
-        engine_math_rotate_point(&inheritable->px, &inheritable->py, temp_parent_pos_x, temp_parent_pos_y, temp_parent_rot);
+    // Objects may have been swapped out since
+    // the last time, watch the current ones
+    node_base_watch_2d(node_base, objects);
+    node_base_set_if_transform_dirty(node_base, false);
 
-        current_node_base = current_node_base->parent_node_base;
+    // Only count it as a change if anything did (the position
+    // may have been stored again with the same value)
+    if(node_base->inherited_2d_version == 0 || node_base_inherited_2d_equal(&inherited, &node_base->inherited_2d) == false){
+        node_base->inherited_2d = inherited;
+        node_base->inherited_2d_version++;
     }
 }
 
 
+void node_base_inherit_2d(mp_obj_t child_node_base, engine_inheritable_2d_t *inheritable){
+    engine_node_base_t *node_base = child_node_base;
+    node_base_validate_inherited_2d(node_base);
+    *inheritable = node_base->inherited_2d;
+}
+
+
 void node_base_set_attr_handler_default(mp_obj_t node_instance){
     if(default_instance_attr_func != NULL) MP_OBJ_TYPE_SET_SLOT((mp_obj_type_t*)((mp_obj_base_t*)node_instance)->type, attr, default_instance_attr_func, 5);
 }
@@ -683,7 +1141,17 @@ bool node_base_load_attr(engine_node_base_t *self_node_base, qstr attribute, mp_
             engine_inheritable_2d_t inherited;
             node_base_inherit_2d(self_node_base, &inherited);
 
-            destination[0] = vector2_class_new(&vector2_class_type, 2, 0, (mp_obj_t[]){mp_obj_new_float(inherited.px), mp_obj_new_float(inherited.py)});
+            // Reuse the same vector so that reading this
+            // every frame doesn't allocate anything
+            if(self_node_base->global_position == MP_OBJ_NULL){
+                self_node_base->global_position = vector2_class_new(&vector2_class_type, 0, 0, NULL);
+            }
+
+            vector2_class_obj_t *global_position = MP_OBJ_TO_PTR(self_node_base->global_position);
+            global_position->x.value = inherited.px;
+            global_position->y.value = inherited.py;
+
+            destination[0] = self_node_base->global_position;
 
             return true;
         }
@@ -703,6 +1171,22 @@ bool node_base_load_attr(engine_node_base_t *self_node_base, qstr attribute, mp_
             destination[0] = mp_obj_new_bool(node_base_does_inherit_rotation(self_node_base));
             return true;
         break;
+        case MP_QSTR_tick_policy:
+            destination[0] = mp_obj_new_int(self_node_base->tick_policy);
+            return true;
+        break;
+        case MP_QSTR_tick_interval:
+            destination[0] = mp_obj_new_int(self_node_base->tick_interval);
+            return true;
+        break;
+        case MP_QSTR_tick_distance:
+            destination[0] = mp_obj_new_float(self_node_base->tick_distance);
+            return true;
+        break;
+        case MP_QSTR_cache_as_bitmap:
+            destination[0] = mp_obj_new_bool(self_node_base->bitmap_cache != NULL);
+            return true;
+        break;
     }
 
     return false;
@@ -734,6 +1218,39 @@ bool node_base_store_attr(engine_node_base_t *self_node_base, qstr attribute, mp
             node_base_set_inherit_rotation(self_node_base, mp_obj_get_int(destination[1]));
             return true;
         break;
+        case MP_QSTR_tick_policy:
+        {
+            mp_int_t tick_policy = mp_obj_get_int(destination[1]);
+
+            if(tick_policy < NODE_BASE_TICK_ALWAYS || tick_policy > NODE_BASE_TICK_INTERVAL){
+                mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("NodeBase: ERROR: Unknown tick policy, use one of the `engine_nodes.TICK_*` values"));
+            }
+
+            self_node_base->tick_policy = tick_policy;
+            self_node_base->tick_dt_ms = 0.0f;
+            return true;
+        }
+        break;
+        case MP_QSTR_tick_interval:
+        {
+            mp_int_t tick_interval = mp_obj_get_int(destination[1]);
+
+            if(tick_interval < 1 || tick_interval > UINT8_MAX){
+                mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("NodeBase: ERROR: Tick interval must be from 1 to 255 frames"));
+            }
+
+            self_node_base->tick_interval = tick_interval;
+            return true;
+        }
+        break;
+        case MP_QSTR_tick_distance:
+            self_node_base->tick_distance = mp_obj_get_float(destination[1]);
+            return true;
+        break;
+        case MP_QSTR_cache_as_bitmap:
+            node_bitmap_cache_set_enabled(self_node_base, mp_obj_is_true(destination[1]));
+            return true;
+        break;
     }
 
     return false;
@@ -750,6 +1267,21 @@ void node_base_attr_handler(mp_obj_t self, qstr attr, mp_obj_t *dest,
     bool is_obj_instance = false;
     engine_node_base_t *node_base = node_base_get(self, &is_obj_instance);
 
+    // Storing any of these moves the node and its children, even
+    // when it ends up in the Python instance and not the node
+    if(dest[0] != MP_OBJ_NULL && dest[1] != MP_OBJ_NULL){
+        switch(attr){
+            case MP_QSTR_position:
+            case MP_QSTR_rotation:
+            case MP_QSTR_scale:
+            case MP_QSTR_opacity:
+            case MP_QSTR_start:
+            case MP_QSTR_end:
+                node_base_set_transform_changed(node_base);
+            break;
+        }
+    }
+
     // Pointer to function that we're going
     // to call in the inner loop
     attr_handler_func current_attr_function = NULL;
@@ -771,7 +1303,11 @@ void node_base_attr_handler(mp_obj_t self, qstr attr, mp_obj_t *dest,
         // If handled, stop
         if(attr_handled){
             // If this was a store operation, mark it as a success
-            if(is_store) dest[0] = MP_OBJ_NULL;
+            // and that the node may look different now
+            if(is_store){
+                dest[0] = MP_OBJ_NULL;
+                node_base_set_if_draw_dirty(node_base, true);
+            }
             return;
         }
     }
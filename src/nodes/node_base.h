@@ -13,21 +13,18 @@
 #define NODE_BASE_INHERIT_SCALE_BIT_INDEX 5
 #define NODE_BASE_INHERIT_POSITION_BIT_INDEX 6
 #define NODE_BASE_INHERIT_ROTATION_BIT_INDEX 7
+#define NODE_BASE_TRANSFORM_DIRTY_BIT_INDEX 8
+#define NODE_BASE_TICKING_BIT_INDEX 9
+#define NODE_BASE_ON_SCREEN_BIT_INDEX 10
+#define NODE_BASE_DRAW_DIRTY_BIT_INDEX 11
+#define NODE_BASE_BITMAP_CACHED_BIT_INDEX 12
+#define NODE_BASE_BITMAP_CACHE_DRAWING_BIT_INDEX 13
 
-typedef struct{
-    mp_obj_base_t base;                     // All nodes get defined by what is placed in this
-    linked_list_node *object_list_node;     // Pointer to where this node is stored in the layers of linked lists the engine tracks (used for easy linked list deletion)
-    linked_list_node *deletable_list_node;  // Pointer to delete linked list node so that node can remove itself from the list if gc'ed before node clear step
-    uint8_t layer;                          // The layer index of the linked list the 'object_list_node' lives in (used for easy deletion)
-    uint8_t meta_data;                      // Holds bits related to if this node is visible (not shown or shown but callbacks still called), disabled (callbacks not called but still shown), or just added
-    uint8_t type;                           // The type of this node (see 'node_types.h')
-    void *attr_accessor;                    // Used in conjunction with mp_get_attr
-    void *node;                             // Points to subclass if 'inherited' true otherwise to engine node struct
-    
-    linked_list children_node_bases;                // Linked list of child node_bases
-    void *parent_node_base;                         // If this is a child, pointer to parent node_base (can only have one parent)
-    linked_list_node *location_in_parents_children; // The location of this node in the parents linked list of children (used for easy deletion upon garbage collection of this node)
-}engine_node_base_t;
+// When the tick callback of a ticking node is called ('tick_policy')
+#define NODE_BASE_TICK_ALWAYS       0   // Every frame
+#define NODE_BASE_TICK_VISIBLE      1   // Only if the node was on screen for a camera the last time nodes were drawn
+#define NODE_BASE_TICK_NEAR_CAMERA  2   // Only if the node is within 'tick_distance' of a camera
+#define NODE_BASE_TICK_INTERVAL     3   // Every 'tick_interval' frames, nodes are spread out over those frames
 
 
 // Common data that 2D nodes inherit
@@ -45,6 +42,44 @@ typedef struct{
 }engine_inheritable_2d_t;
 
 
+typedef struct{
+    mp_obj_base_t base;                     // All nodes get defined by what is placed in this
+    uint8_t layer;                          // The layer index of the linked list the 'layer_link' lives in (used for easy deletion)
+    uint16_t meta_data;                     // Holds bits related to if this node is visible (not shown or shown but callbacks still called), disabled (callbacks not called but still shown), or just added
+    uint8_t type;                           // The type of this node (see 'node_types.h')
+    void *attr_accessor;                    // Used in conjunction with mp_get_attr
+    void *node;                             // Points to subclass if 'inherited' true otherwise to engine node struct
+
+    // Links for each list a node can be in, embedded so that joining
+    // and leaving lists doesn't allocate. The links of neighbouring
+    // nodes point here, past the first GC block of this node, and the
+    // GC only follows pointers to the start of blocks, so being in the
+    // same list as another node doesn't keep either alive
+    linked_list_node layer_link;            // Link in the engine object layer at 'layer'
+    linked_list_node deletable_link;        // Link in the deletable list when marked for destruction, so it can remove itself if gc'ed before node clear step
+    linked_list_node collection_link;       // Link in the camera, physics or gui collection (a node is only ever in the one that matches its type)
+    linked_list_node parent_link;           // Link in the parent's 'children_node_bases'
+    linked_list_node tick_link;             // Link in the tick list at 'layer' while ticking (see 'engine_set_object_ticking()')
+
+    linked_list children_node_bases;                // Linked list of child node_bases
+    void *parent_node_base;                         // If this is a child, pointer to parent node_base (can only have one parent)
+
+    engine_inheritable_2d_t inherited_2d;           // Cached world-space 2D transform (this node's transform with all parents applied), only valid while the transform dirty bit is clear
+    uint32_t inherited_2d_version;                  // Incremented every time 'inherited_2d' changes
+    mp_obj_t watched_2d[3];                         // Position, scale and rotation objects whose in-place changes mark this node changed, MP_OBJ_NULL if none
+
+    mp_obj_t global_position;                       // Vector2 handed out for 'global_position', made on first access and updated in place after
+
+    uint8_t tick_policy;                            // One of NODE_BASE_TICK_*
+    uint8_t tick_interval;                          // Frames between ticks for NODE_BASE_TICK_INTERVAL
+    uint8_t tick_phase;                             // Which of those frames this node ticks on, differs between nodes
+    float tick_distance;                            // Distance from a camera for NODE_BASE_TICK_NEAR_CAMERA
+    float tick_dt_ms;                               // Milliseconds passed since the last tick for NODE_BASE_TICK_INTERVAL
+
+    void *bitmap_cache;                             // 'node_bitmap_cache_t' while 'cache_as_bitmap' is on, NULL otherwise
+}engine_node_base_t;
+
+
 void node_base_init(engine_node_base_t *node_base, const mp_obj_type_t *mp_type, uint8_t node_type, uint8_t layer);
 
 bool node_base_is_visible(engine_node_base_t *node_base);
@@ -71,10 +106,45 @@ void node_base_set_inherit_position(engine_node_base_t *node_base, bool inherit_
 bool node_base_does_inherit_rotation(engine_node_base_t *node_base);
 void node_base_set_inherit_rotation(engine_node_base_t *node_base, bool inherit_rotation);
 
+// Set when 'inherited_2d' needs to be worked out again, see 'node_base_set_transform_changed'
+bool node_base_is_transform_dirty(engine_node_base_t *node_base);
+void node_base_set_if_transform_dirty(engine_node_base_t *node_base, bool is_transform_dirty);
+
+// Marks the cached world transform of the node and all of its children
+// as needing to be worked out again. Call after changing the position,
+// rotation, scale, opacity or parent of a node from C without going
+// through its attributes (those and the node's vectors already do)
+void node_base_set_transform_changed(engine_node_base_t *node_base);
+
+bool node_base_is_ticking(engine_node_base_t *node_base);
+void node_base_set_if_ticking(engine_node_base_t *node_base, bool is_ticking);
+
+// Set while drawing, true if any camera saw the node the last time nodes were drawn
+bool node_base_is_on_screen(engine_node_base_t *node_base);
+void node_base_set_if_on_screen(engine_node_base_t *node_base, bool is_on_screen);
+
+// Set when an attribute of the node is stored, cleared by the bitmap cache once it has seen it
+bool node_base_is_draw_dirty(engine_node_base_t *node_base);
+void node_base_set_if_draw_dirty(engine_node_base_t *node_base, bool is_draw_dirty);
+
+// Set while drawing, true if the node is in a subtree drawn from a bitmap cache (see 'node_bitmap_cache.h')
+bool node_base_is_bitmap_cached(engine_node_base_t *node_base);
+void node_base_set_if_bitmap_cached(engine_node_base_t *node_base, bool is_bitmap_cached);
+
+// Set while drawing, true if the node is in the subtree being drawn into a bitmap cache right now
+bool node_base_is_bitmap_cache_drawing(engine_node_base_t *node_base);
+void node_base_set_if_bitmap_cache_drawing(engine_node_base_t *node_base, bool is_bitmap_cache_drawing);
+
 // Given an object that may be a Python class instance or the node_base itself,
 // get the node_base from it. Returns `true` if instance and `false` if not
 engine_node_base_t *node_base_get(mp_obj_t object, bool *is_obj_instance);
 
+// Pointer to the float a built-in node keeps `attr` in (`opacity`,
+// `rotation` or `zoom`) so it can be written without boxing a float
+// object, `node_base` is set to the node it belongs to. Returns NULL if
+// `object` is not a node or the node doesn't keep `attr` as a float
+float *node_base_get_float_attr(mp_obj_t object, qstr attr, engine_node_base_t **node_base);
+
 mp_obj_t node_base_del(mp_obj_t self_in);
 static MP_DEFINE_CONST_FUN_OBJ_1(node_base_del_obj, node_base_del);
 
@@ -102,7 +172,9 @@ static MP_DEFINE_CONST_FUN_OBJ_2(node_base_remove_child_obj, node_base_remove_ch
 mp_obj_t node_base_get_parent(mp_obj_t self_in);
 static MP_DEFINE_CONST_FUN_OBJ_1(node_base_get_parent_obj, node_base_get_parent);
 
-// Fills 'inheritable' with data from parents and child
+// Fills 'inheritable' with data from parents and child. The result
+// is cached on the node and only recomputed when the node's own
+// transform or one of its parents' transforms changed
 void node_base_inherit_2d(mp_obj_t child_node_base, engine_inheritable_2d_t *inheritable);
 
 void node_base_set_attr_handler_default(mp_obj_t node_instance);
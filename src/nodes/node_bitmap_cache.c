@@ -0,0 +1,445 @@
+#include "node_bitmap_cache.h"
+
+#include "debug/debug_print.h"
+#include "nodes/node_types.h"
+#include "nodes/3D/camera_node.h"
+#include "nodes/2D/sprite_2d_node.h"
+#include "nodes/2D/rectangle_2d_node.h"
+#include "nodes/2D/circle_2d_node.h"
+#include "nodes/2D/line_2d_node.h"
+#include "nodes/2D/text_2d_node.h"
+#include "nodes/2D/gui_button_2d_node.h"
+#include "nodes/2D/gui_bitmap_button_2d_node.h"
+#include "nodes/2D/tile_map_2d_node.h"
+#include "display/engine_display_damage.h"
+#include "draw/engine_color.h"
+#include "math/vector2.h"
+#include "math/rectangle.h"
+#include "utility/engine_time.h"
+#include "engine_collections.h"
+#include "py/objarray.h"
+
+
+engine_node_base_t *node_bitmap_cache_drawing = NULL;
+
+// Every node with a cache (see 'node_bitmap_cache_t.link')
+static linked_list node_bitmap_cache_list = {0};
+
+// Camera whose viewport is moved while drawing into a cache and by how much,
+// kept so that it can be moved back if a draw callback raises part way
+static engine_node_base_t *node_bitmap_cache_moved_camera = NULL;
+static float node_bitmap_cache_moved_x = 0.0f;
+static float node_bitmap_cache_moved_y = 0.0f;
+
+// Counts frames, mixed in to make a stamp that never matches again
+static uint32_t node_bitmap_cache_frame = 0;
+
+static uint32_t node_bitmap_cache_hit_count = 0;
+static uint32_t node_bitmap_cache_miss_count = 0;
+
+
+void node_bitmap_cache_set_enabled(engine_node_base_t *node_base, bool enabled){
+    if(enabled && node_base->bitmap_cache == NULL){
+        node_bitmap_cache_t *cache = m_new0(node_bitmap_cache_t, 1);
+        cache->node_base = node_base;
+        linked_list_add_node(&node_bitmap_cache_list, &cache->link, cache);
+        node_base->bitmap_cache = cache;
+    }else if(enabled == false && node_base->bitmap_cache != NULL){
+        // Buffers are collected with it
+        node_bitmap_cache_t *cache = node_base->bitmap_cache;
+        linked_list_remove_node(&node_bitmap_cache_list, &cache->link);
+        node_base->bitmap_cache = NULL;
+    }
+}
+
+
+static void node_bitmap_cache_move_camera(engine_node_base_t *camera_node_base, float x, float y){
+    engine_camera_node_class_obj_t *camera = camera_node_base->node;
+    rectangle_class_obj_t *viewport = camera->viewport;
+
+    viewport->x += x;
+    viewport->y += y;
+}
+
+
+static uint32_t node_bitmap_cache_hash_color(uint32_t hash, mp_obj_t color){
+    uint16_t value = engine_color_class_color_value(color);
+    return engine_display_damage_hash(hash, &value, sizeof(uint16_t));
+}
+
+
+static uint32_t node_bitmap_cache_hash_vector2(uint32_t hash, mp_obj_t vector){
+    vector2_class_obj_t *vector2 = vector;
+    hash = engine_display_damage_hash(hash, &vector2->x.value, sizeof(float));
+    return engine_display_damage_hash(hash, &vector2->y.value, sizeof(float));
+}
+
+
+static uint32_t node_bitmap_cache_hash_bytes(uint32_t hash, mp_obj_t bytes){
+    if(bytes == mp_const_none){
+        return hash;
+    }
+
+    mp_obj_array_t *array = bytes;
+    return engine_display_damage_hash(hash, array->items, array->len);
+}
+
+
+// Mixes what can change how a node looks without one of its attributes
+// being stored (that sets the draw dirty bit) or its transform changing
+static uint32_t node_bitmap_cache_hash_node(uint32_t hash, engine_node_base_t *node_base){
+    switch(node_base->type){
+        case NODE_TYPE_SPRITE_2D:
+        {
+            // Not drawn on a hit, step it here instead of after drawing
+            sprite_2d_node_class_step_animation(node_base);
+
+            engine_sprite_2d_node_class_obj_t *sprite = node_base->node;
+            hash = engine_display_damage_hash(hash, &sprite->frame_current_x, sizeof(uint16_t));
+            hash = engine_display_damage_hash(hash, &sprite->frame_current_y, sizeof(uint16_t));
+        }
+        break;
+        case NODE_TYPE_RECTANGLE_2D:
+            hash = node_bitmap_cache_hash_color(hash, ((engine_rectangle_2d_node_class_obj_t*)node_base->node)->color);
+        break;
+        case NODE_TYPE_CIRCLE_2D:
+            hash = node_bitmap_cache_hash_color(hash, ((engine_circle_2d_node_class_obj_t*)node_base->node)->color);
+        break;
+        case NODE_TYPE_TEXT_2D:
+            hash = node_bitmap_cache_hash_color(hash, ((engine_text_2d_node_class_obj_t*)node_base->node)->color);
+        break;
+        case NODE_TYPE_LINE_2D:
+        {
+            engine_line_2d_node_class_obj_t *line = node_base->node;
+            hash = node_bitmap_cache_hash_color(hash, line->color);
+            hash = node_bitmap_cache_hash_vector2(hash, line->start);
+            hash = node_bitmap_cache_hash_vector2(hash, line->end);
+        }
+        break;
+        case NODE_TYPE_GUI_BUTTON_2D:
+        {
+            engine_gui_button_2d_node_class_obj_t *button = node_base->node;
+            hash = engine_display_damage_hash(hash, &button->focused, sizeof(bool));
+            hash = engine_display_damage_hash(hash, &button->pressed, sizeof(bool));
+        }
+        break;
+        case NODE_TYPE_GUI_BITMAP_BUTTON_2D:
+        {
+            engine_gui_bitmap_button_2d_node_class_obj_t *button = node_base->node;
+            hash = engine_display_damage_hash(hash, &button->focused, sizeof(bool));
+            hash = engine_display_damage_hash(hash, &button->pressed, sizeof(bool));
+        }
+        break;
+        case NODE_TYPE_TILE_MAP_2D:
+        {
+            // Tiles are usually changed in place, looking at them
+            // is still a lot cheaper than drawing the map
+            engine_tile_map_2d_node_class_obj_t *tile_map = node_base->node;
+            hash = node_bitmap_cache_hash_bytes(hash, tile_map->tiles);
+            hash = node_bitmap_cache_hash_bytes(hash, tile_map->flips);
+
+            uint32_t current_ms_time = millis();
+
+            for(uint8_t index=0; index<tile_map->animation_count; index++){
+                uint32_t step = current_ms_time / tile_map->animation_ranges[index].period_ms;
+                hash = engine_display_damage_hash(hash, &step, sizeof(uint32_t));
+            }
+        }
+        break;
+        case NODE_TYPE_VOXELSPACE:
+        case NODE_TYPE_VOXELSPACE_SPRITE:
+        case NODE_TYPE_MESH_3D:
+            // Depends on each camera's 3D view, always drawn again
+            hash = engine_display_damage_hash(hash, &node_bitmap_cache_frame, sizeof(uint32_t));
+        break;
+    }
+
+    return hash;
+}
+
+
+// Marks `node_base` and its children as drawn from a cache and
+// mixes everything about them that could change into `hash`
+static uint32_t node_bitmap_cache_stamp_subtree(engine_node_base_t *node_base, uint32_t hash){
+    node_base_set_if_bitmap_cached(node_base, true);
+
+    engine_inheritable_2d_t inherited;
+    node_base_inherit_2d(node_base, &inherited);
+
+    hash = engine_display_damage_hash(hash, &node_base, sizeof(engine_node_base_t*));
+    hash = engine_display_damage_hash(hash, &node_base->inherited_2d_version, sizeof(uint32_t));
+
+    if(node_base_is_draw_dirty(node_base)){
+        node_base_set_if_draw_dirty(node_base, false);
+        hash = engine_display_damage_hash(hash, &node_bitmap_cache_frame, sizeof(uint32_t));
+    }
+
+    hash = node_bitmap_cache_hash_node(hash, node_base);
+
+    linked_list_node *current_child_link_node = node_base->children_node_bases.start;
+
+    while(current_child_link_node != NULL){
+        hash = node_bitmap_cache_stamp_subtree(current_child_link_node->object, hash);
+        current_child_link_node = current_child_link_node->next;
+    }
+
+    return hash;
+}
+
+
+static void node_bitmap_cache_set_subtree_drawing(engine_node_base_t *node_base, bool drawing){
+    node_base_set_if_bitmap_cache_drawing(node_base, drawing);
+
+    linked_list_node *current_child_link_node = node_base->children_node_bases.start;
+
+    while(current_child_link_node != NULL){
+        node_bitmap_cache_set_subtree_drawing(current_child_link_node->object, drawing);
+        current_child_link_node = current_child_link_node->next;
+    }
+}
+
+
+static void node_bitmap_cache_set_subtree_on_screen(engine_node_base_t *node_base){
+    node_base_set_if_on_screen(node_base, true);
+
+    linked_list_node *current_child_link_node = node_base->children_node_bases.start;
+
+    while(current_child_link_node != NULL){
+        node_bitmap_cache_set_subtree_on_screen(current_child_link_node->object);
+        current_child_link_node = current_child_link_node->next;
+    }
+}
+
+
+// Finds the entry for `camera_node_base`, adding one if there isn't one yet
+static node_bitmap_cache_entry_t *node_bitmap_cache_get_entry(node_bitmap_cache_t *cache, engine_node_base_t *camera_node_base){
+    node_bitmap_cache_entry_t *entry = cache->entries;
+
+    while(entry != NULL){
+        if(entry->camera_node_base == camera_node_base){
+            return entry;
+        }
+
+        entry = entry->next;
+    }
+
+    entry = m_new0(node_bitmap_cache_entry_t, 1);
+    entry->camera_node_base = camera_node_base;
+    entry->next = cache->entries;
+    cache->entries = entry;
+
+    return entry;
+}
+
+
+// Drops the entries of cameras that were destroyed
+static void node_bitmap_cache_prune_entries(node_bitmap_cache_t *cache){
+    linked_list *camera_list = engine_collections_get_camera_list();
+    node_bitmap_cache_entry_t **link = &cache->entries;
+
+    while(*link != NULL){
+        bool found = false;
+        linked_list_node *current_camera_list_node = camera_list->start;
+
+        while(current_camera_list_node != NULL && found == false){
+            found = current_camera_list_node->object == (*link)->camera_node_base;
+            current_camera_list_node = current_camera_list_node->next;
+        }
+
+        if(found){
+            link = &(*link)->next;
+        }else{
+            *link = (*link)->next;
+        }
+    }
+}
+
+
+// The subtree's stamp mixed with everything about the camera that moves
+// or changes what it draws into
+static uint32_t node_bitmap_cache_get_camera_stamp(node_bitmap_cache_t *cache, engine_node_base_t *camera_node_base){
+    engine_camera_node_class_obj_t *camera = camera_node_base->node;
+    rectangle_class_obj_t *viewport = camera->viewport;
+
+    uint32_t stamp = cache->stamp;
+    stamp = engine_display_damage_hash(stamp, engine_camera_get_view_2d(camera_node_base), sizeof(engine_camera_view_2d_t));
+    stamp = engine_display_damage_hash(stamp, &viewport->x, sizeof(float));
+    stamp = engine_display_damage_hash(stamp, &viewport->y, sizeof(float));
+    stamp = engine_display_damage_hash(stamp, &viewport->width, sizeof(float));
+    stamp = engine_display_damage_hash(stamp, &viewport->height, sizeof(float));
+    stamp = engine_display_damage_hash(stamp, &camera->opacity, sizeof(float));
+    stamp = engine_display_damage_hash(stamp, &engine_display_target_width, sizeof(uint16_t));
+    stamp = engine_display_damage_hash(stamp, &engine_display_target_height, sizeof(uint16_t));
+
+    return stamp;
+}
+
+
+// Draws the subtree into the entry for the camera that's being drawn for
+static void node_bitmap_cache_render(node_bitmap_cache_entry_t *entry, engine_node_base_t *camera_node_base, void (*draw_layers)()){
+    // Going through the subtree without drawing
+    // finds the area of the target that it covers
+    engine_display_rect_t rect;
+    engine_display_damage_start_fingerprint();
+    draw_layers();
+    engine_display_damage_stop_fingerprint(&rect);
+
+    entry->rect = rect;
+
+    if(rect.x0 >= rect.x1 || rect.y0 >= rect.y1){
+        return;
+    }
+
+    uint16_t width = rect.x1 - rect.x0;
+    uint16_t height = rect.y1 - rect.y0;
+    uint32_t pixel_count = width * height;
+
+    if(entry->pixels_length < pixel_count){
+        entry->pixels = m_new(uint16_t, pixel_count);
+        entry->pixels_length = pixel_count;
+    }
+
+    // Everything lands 'rect's top-left closer to the origin
+    node_bitmap_cache_moved_camera = camera_node_base;
+    node_bitmap_cache_moved_x = -rect.x0;
+    node_bitmap_cache_moved_y = -rect.y0;
+    node_bitmap_cache_move_camera(camera_node_base, node_bitmap_cache_moved_x, node_bitmap_cache_moved_y);
+
+    engine_camera_render_offscreen(entry->pixels, width, height, NODE_BITMAP_CACHE_KEY_COLOR, &entry->depth, &entry->depth_length, draw_layers);
+
+    node_bitmap_cache_move_camera(camera_node_base, -node_bitmap_cache_moved_x, -node_bitmap_cache_moved_y);
+    node_bitmap_cache_moved_camera = NULL;
+}
+
+
+void node_bitmap_cache_draw(engine_node_base_t *node_base, void (*draw_layers)()){
+    node_bitmap_cache_t *cache = node_base->bitmap_cache;
+
+    if(cache == NULL || cache->active == false || node_bitmap_cache_drawing != NULL){
+        return;
+    }
+
+    linked_list_node *current_camera_list_node = engine_collections_get_camera_list()->start;
+
+    while(current_camera_list_node != NULL){
+        engine_node_base_t *camera_node_base = current_camera_list_node->object;
+        current_camera_list_node = current_camera_list_node->next;
+
+        if(engine_camera_is_drawing(camera_node_base) == false){
+            continue;
+        }
+
+        node_bitmap_cache_entry_t *entry = node_bitmap_cache_get_entry(cache, camera_node_base);
+        uint32_t stamp = node_bitmap_cache_get_camera_stamp(cache, camera_node_base);
+        bool hit = entry->valid && entry->stamp == stamp;
+        engine_display_rect_t *rect = &entry->rect;
+        bool has_pixels = rect->x0 < rect->x1 && rect->y0 < rect->y1;
+
+        // Finding out what would be drawn (for damage tracking or a
+        // render target), a hit is the cached area with its stamp
+        if(engine_display_damage_is_recording()){
+            if(hit){
+                if(has_pixels){
+                    engine_display_damage_record(rect->x0, rect->y0, rect->x1, rect->y1, stamp);
+                }
+                continue;
+            }
+
+            engine_node_base_t *previous_drawing_only = engine_camera_set_drawing_only(camera_node_base);
+            node_bitmap_cache_drawing = node_base;
+            node_bitmap_cache_set_subtree_drawing(node_base, true);
+
+            draw_layers();
+
+            node_bitmap_cache_set_subtree_drawing(node_base, false);
+            node_bitmap_cache_drawing = NULL;
+            engine_camera_set_drawing_only(previous_drawing_only);
+            continue;
+        }
+
+        if(hit){
+            node_bitmap_cache_hit_count++;
+        }else{
+            ENGINE_INFO_PRINTF("NodeBitmapCache: Drawing subtree into cache");
+            node_bitmap_cache_miss_count++;
+
+            engine_node_base_t *previous_drawing_only = engine_camera_set_drawing_only(camera_node_base);
+            node_bitmap_cache_drawing = node_base;
+            node_bitmap_cache_set_subtree_drawing(node_base, true);
+
+            entry->valid = false;
+            node_bitmap_cache_render(entry, camera_node_base, draw_layers);
+            entry->stamp = stamp;
+            entry->valid = true;
+
+            node_bitmap_cache_set_subtree_drawing(node_base, false);
+            node_bitmap_cache_drawing = NULL;
+            engine_camera_set_drawing_only(previous_drawing_only);
+
+            has_pixels = rect->x0 < rect->x1 && rect->y0 < rect->y1;
+        }
+
+        if(has_pixels){
+            engine_draw_copy_keyed(entry->pixels, rect->x0, rect->y0, rect->x1 - rect->x0, rect->y1 - rect->y0, NODE_BITMAP_CACHE_KEY_COLOR);
+
+            // Drawing the subtree marks what a camera sees, a copy
+            // doesn't, count all of it as seen for ticking
+            if(cache->on_screen == false){
+                cache->on_screen = true;
+                node_bitmap_cache_set_subtree_on_screen(node_base);
+            }
+        }
+    }
+}
+
+
+uint32_t node_bitmap_cache_get_hit_count(){
+    return node_bitmap_cache_hit_count;
+}
+
+
+uint32_t node_bitmap_cache_get_miss_count(){
+    return node_bitmap_cache_miss_count;
+}
+
+
+void node_bitmap_cache_start_frame(){
+    node_bitmap_cache_frame++;
+    node_bitmap_cache_hit_count = 0;
+    node_bitmap_cache_miss_count = 0;
+
+    node_bitmap_cache_drawing = NULL;
+    engine_camera_set_drawing_only(NULL);
+
+    if(node_bitmap_cache_moved_camera != NULL){
+        node_bitmap_cache_move_camera(node_bitmap_cache_moved_camera, -node_bitmap_cache_moved_x, -node_bitmap_cache_moved_y);
+        node_bitmap_cache_moved_camera = NULL;
+    }
+
+    linked_list_node *current_cache_list_node = node_bitmap_cache_list.start;
+
+    while(current_cache_list_node != NULL){
+        node_bitmap_cache_t *cache = current_cache_list_node->object;
+        current_cache_list_node = current_cache_list_node->next;
+
+        // Caches inside of another cached subtree are drawn as
+        // part of it, only the outermost one keeps anything
+        cache->active = true;
+        engine_node_base_t *parent_node_base = cache->node_base->parent_node_base;
+
+        while(parent_node_base != NULL && cache->active){
+            cache->active = parent_node_base->bitmap_cache == NULL;
+            parent_node_base = parent_node_base->parent_node_base;
+        }
+
+        cache->on_screen = false;
+
+        if(cache->active == false){
+            cache->entries = NULL;
+            continue;
+        }
+
+        cache->stamp = node_bitmap_cache_stamp_subtree(cache->node_base, ENGINE_DISPLAY_DAMAGE_HASH_START);
+        node_bitmap_cache_prune_entries(cache);
+    }
+}
@@ -0,0 +1,83 @@
+#ifndef NODE_BITMAP_CACHE_H
+#define NODE_BITMAP_CACHE_H
+
+#include "py/obj.h"
+#include "nodes/node_base.h"
+#include "display/engine_display_common.h"
+#include "draw/engine_display_draw.h"
+
+// Nodes with `cache_as_bitmap` set are drawn together with all of their
+// children into a private buffer, which is then copied to the screen in
+// place of drawing them. Once per frame the subtree is checked for
+// changes using what nodes already track: the version of each node's
+// cached world transform, a dirty bit set whenever one of its attributes
+// is stored and a few values that change without a store (colors,
+// animation frames, button states). The buffer is only drawn again if
+// any of that or the camera's view changed. Changes made in place to
+// objects that aren't checked (like the pixels of a TextureResource)
+// are not seen, store the attribute again to have the subtree redrawn
+
+// Pixels in the buffer that nothing was drawn to, skipped when copying.
+// Opacity in a cached subtree blends against this (nearly black)
+#define NODE_BITMAP_CACHE_KEY_COLOR ENGINE_NO_TRANSPARENCY_COLOR
+
+
+// What the subtree looks like to one camera
+typedef struct node_bitmap_cache_entry_t{
+    engine_node_base_t *camera_node_base;           // Camera the subtree was drawn for
+    uint16_t *pixels;                               // 'rect' sized, NODE_BITMAP_CACHE_KEY_COLOR where nothing was drawn
+    uint16_t *depth;                                // Same size as 'pixels', only made if the scene uses depth
+    uint32_t pixels_length;                         // Pixels 'pixels' can hold, only grown
+    uint32_t depth_length;                          // Pixels 'depth' can hold, only grown
+    engine_display_rect_t rect;                     // Area of the camera's draw target the subtree covers
+    uint32_t stamp;                                 // Subtree 'stamp' mixed with the camera's view when drawn
+    bool valid;                                     // False until drawn into once
+    struct node_bitmap_cache_entry_t *next;
+}node_bitmap_cache_entry_t;
+
+
+typedef struct{
+    linked_list_node link;                          // Link in the list of every node with a cache
+    engine_node_base_t *node_base;                  // Node the cache is for
+    node_bitmap_cache_entry_t *entries;             // One per camera the subtree was drawn for
+    uint32_t stamp;                                 // Changes whenever anything in the subtree that is drawn does
+    bool active;                                    // False if inside of another cached subtree, that one draws this one
+    bool on_screen;                                 // Copied to any camera this frame
+}node_bitmap_cache_t;
+
+
+// Subtree being drawn into a cache right now, NULL otherwise
+extern engine_node_base_t *node_bitmap_cache_drawing;
+
+// Turns caching on or off for the subtree under `node_base`
+void node_bitmap_cache_set_enabled(engine_node_base_t *node_base, bool enabled);
+
+// True if drawing all layers should skip `node_base` and leave it to
+// `node_bitmap_cache_draw`: it's in a subtree drawn from a cache, or a
+// subtree is being drawn into a cache and the node isn't part of it
+static inline bool node_bitmap_cache_skips(engine_node_base_t *node_base){
+    if(node_bitmap_cache_drawing != NULL){
+        return node_base_is_bitmap_cache_drawing(node_base) == false;
+    }
+
+    return node_base_is_bitmap_cached(node_base);
+}
+
+// Draws the subtree under `node_base` for each camera, from its cache
+// if nothing changed. Does nothing unless `node_base` is the root of a
+// cached subtree. `draw_layers` draws every node, while it runs only the
+// nodes of this subtree are drawn (see `node_bitmap_cache_skips`)
+void node_bitmap_cache_draw(engine_node_base_t *node_base, void (*draw_layers)());
+
+// Times a cache was copied instead of drawing its subtree (hits) or had
+// to be drawn again (misses) the last time nodes were drawn
+uint32_t node_bitmap_cache_get_hit_count();
+uint32_t node_bitmap_cache_get_miss_count();
+
+// Call before drawing each frame, after the bitmap cache bits of every
+// node were cleared. Marks the nodes of cached subtrees and works out
+// if anything in them changed. Also resets the counts above and puts
+// back what a draw callback that raised last frame may have left changed
+void node_bitmap_cache_start_frame();
+
+#endif  // NODE_BITMAP_CACHE_H
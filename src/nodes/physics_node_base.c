@@ -2,6 +2,7 @@
 #include "math/vector2.h"
 #include "math/engine_math.h"
 #include "draw/engine_color.h"
+#include "engine_object_layers.h"
 
 
 // https://github.com/RandyGaul/ImpulseEngine/blob/8d5f4d9113876f91a53cfb967879406e975263d1/Body.h#L35-L39
@@ -113,20 +114,24 @@ bool physics_node_base_load_attr(engine_node_base_t *self_node_base, qstr attrib
             destination[0] = mp_obj_new_float(self->rotation);
             return true;
         break;
+        case MP_QSTR_density:
+            destination[0] = mp_obj_new_float(self->density);
+            return true;
+        break;
         case MP_QSTR_friction:
-            destination[0] = self->friction;
+            destination[0] = mp_obj_new_float(self->friction);
             return true;
         break;
         case MP_QSTR_bounciness:
-            destination[0] = self->bounciness;
+            destination[0] = mp_obj_new_float(self->bounciness);
             return true;
         break;
         case MP_QSTR_dynamic:
-            destination[0] = self->dynamic;
+            destination[0] = mp_obj_new_bool(self->dynamic);
             return true;
         break;
         case MP_QSTR_solid:
-            destination[0] = self->solid;
+            destination[0] = mp_obj_new_bool(self->solid);
             return true;
         break;
         case MP_QSTR_gravity_scale:
@@ -134,7 +139,7 @@ bool physics_node_base_load_attr(engine_node_base_t *self_node_base, qstr attrib
             return true;
         break;
         case MP_QSTR_outline:
-            destination[0] = self->outline;
+            destination[0] = mp_obj_new_bool(self->outline);
             return true;
         break;
         case MP_QSTR_outline_color:
@@ -200,6 +205,7 @@ bool physics_node_base_store_attr(engine_node_base_t *self_node_base, qstr attri
     switch(attribute){
         case MP_QSTR_tick:
             self->tick_cb = destination[1];
+            engine_set_object_ticking(self_node_base, self->tick_cb != mp_const_none);
             return true;
         break;
         case MP_QSTR_on_collide:
@@ -227,19 +233,19 @@ bool physics_node_base_store_attr(engine_node_base_t *self_node_base, qstr attri
             return true;
         break;
         case MP_QSTR_friction:
-            self->friction = destination[1];
+            self->friction = mp_obj_get_float(destination[1]);
             return true;
         break;
         case MP_QSTR_bounciness:
-            self->bounciness = destination[1];
+            self->bounciness = mp_obj_get_float(destination[1]);
             return true;
         break;
         case MP_QSTR_dynamic:
-            self->dynamic = destination[1];
+            self->dynamic = mp_obj_is_true(destination[1]);
             return true;
         break;
         case MP_QSTR_solid:
-            self->solid = destination[1];
+            self->solid = mp_obj_is_true(destination[1]);
             return true;
         break;
         case MP_QSTR_gravity_scale:
@@ -247,7 +253,7 @@ bool physics_node_base_store_attr(engine_node_base_t *self_node_base, qstr attri
             return true;
         break;
         case MP_QSTR_outline:
-            self->outline = destination[1];
+            self->outline = mp_obj_is_true(destination[1]);
             return true;
         break;
         case MP_QSTR_outline_color:
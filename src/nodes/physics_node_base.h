@@ -12,25 +12,25 @@ typedef struct{
 
     float rotation;                      // float (Current rotation angle)
 
-    mp_obj_t density;                       // How dense the node is
+    float density;                          // How dense the node is
 
-    mp_obj_t friction;
+    float friction;
 
-    mp_obj_t bounciness;                    // Restitution or elasticity
+    float bounciness;                       // Restitution or elasticity
 
-    mp_obj_t dynamic;                       // Flag indicating if node is dynamic and moving around due to physics or static
-    mp_obj_t solid;                         // May want collision callbacks to happen without impeding objects, set to false
+    bool dynamic;                           // Flag indicating if node is dynamic and moving around due to physics or static
+    bool solid;                             // May want collision callbacks to happen without impeding objects, set to false
 
     mp_obj_t gravity_scale;                 // Vector2 allowing scaling affects of gravity. Set to 0,0 for no gravity
 
-    mp_obj_t outline;
+    bool outline;
     mp_obj_t outline_color;
 
     uint32_t collision_mask;
     bool was_colliding; // Used for calling `on_separate_cb` internally
     bool colliding;     // Used internally and exposed to users
 
-    uint8_t physics_id;
+    uint16_t physics_id;
 
     float mass;
     float inverse_mass;
@@ -47,7 +47,7 @@ typedef struct{
     mp_obj_t tick_cb;
     mp_obj_t on_collide_cb;
     mp_obj_t on_separate_cb;
-    linked_list_node *physics_list_node;    // All physics 2d nodes get added to a list that is easy to traverse
+    mp_obj_t collision_contact;             // CollisionContact2D passed to 'on_collide_cb', made on first collision and reused after
 }engine_physics_node_base_t;
 
 void physics_node_base_apply_impulse_base(engine_physics_node_base_t *physics_node_base, float impulse_x, float impulse_y, float position_x, float position_y);
@@ -11,6 +11,7 @@ mp_obj_t collision_contact_2d_class_new(const mp_obj_type_t *type, size_t n_args
     if(n_args == 0){
         self->position = vector2_class_new(&vector2_class_type, 0, 0, NULL);
         self->normal = vector2_class_new(&vector2_class_type, 0, 0, NULL);
+        self->node = mp_const_none;
     }else if(n_args == 5){
         mp_obj_t parameters[2];
         parameters[0] = args[0];
@@ -30,10 +31,42 @@ mp_obj_t collision_contact_2d_class_new(const mp_obj_type_t *type, size_t n_args
 }
 
 
+// The user could have set `position` or `normal` to something
+// other than a Vector2, make sure they can be written to
+static vector2_class_obj_t *collision_contact_2d_ensure_vector2(mp_obj_t *vector){
+    if(!mp_obj_is_type(*vector, &vector2_class_type)){
+        *vector = vector2_class_new(&vector2_class_type, 0, 0, NULL);
+    }
+
+    return MP_OBJ_TO_PTR(*vector);
+}
+
+
+mp_obj_t collision_contact_2d_get_reusable(engine_physics_node_base_t *physics_node_base, float position_x, float position_y, float normal_x, float normal_y, mp_obj_t node){
+    if(physics_node_base->collision_contact == MP_OBJ_NULL){
+        physics_node_base->collision_contact = collision_contact_2d_class_new(&collision_contact_2d_class_type, 0, 0, NULL);
+    }
+
+    collision_contact_2d_class_obj_t *contact = MP_OBJ_TO_PTR(physics_node_base->collision_contact);
+
+    vector2_class_obj_t *position = collision_contact_2d_ensure_vector2((mp_obj_t*)&contact->position);
+    position->x.value = position_x;
+    position->y.value = position_y;
+
+    vector2_class_obj_t *normal = collision_contact_2d_ensure_vector2((mp_obj_t*)&contact->normal);
+    normal->x.value = normal_x;
+    normal->y.value = normal_y;
+
+    contact->node = node;
+
+    return physics_node_base->collision_contact;
+}
+
+
 /* --- doc ---
    NAME: CollisionContact2D
    ID: CollisionContact2D
-   DESC: Object that contains information about a collision
+   DESC: Object that contains information about a collision. The contact passed to a node's `on_collide` callback is reused (updated in place) for that node's next collision, copy the values out of it to keep them
    ATTR: [type={ref_link:Vector2}] [name=position]  [value={ref_link:Vector2} TODO: implement filling this out upon collision of polygons, not easy...]
    ATTR: [type={ref_link:Vector2}] [name=normal]    [value={ref_link:Vector2}]
    ATTR: [type=object]             [name=node]      [value=object (the other node in the collision)]
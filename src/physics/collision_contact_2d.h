@@ -5,6 +5,7 @@
 #include "utility/linked_list.h"
 #include "nodes/node_base.h"
 #include "math/vector2.h"
+#include "nodes/physics_node_base.h"
 
 typedef struct{
     mp_obj_base_t base;
@@ -17,4 +18,9 @@ extern const mp_obj_type_t collision_contact_2d_class_type;
 
 mp_obj_t collision_contact_2d_class_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args);
 
+// Gets the contact `physics_node_base` keeps for passing to its `on_collide`
+// callback, filled out with this collision. The same contact is reused
+// for every collision of that node so that none are allocated per frame
+mp_obj_t collision_contact_2d_get_reusable(engine_physics_node_base_t *physics_node_base, float position_x, float position_y, float normal_x, float normal_y, mp_obj_t node);
+
 #endif  // COLLISION_CONTACT_2D_H
@@ -4,7 +4,6 @@
 #include "nodes/2D/physics_circle_2d_node.h"
 #include "math/vector2.h"
 #include "math/engine_math.h"
-#include "utility/engine_bit_collection.h"
 #include "collision_contact_2d.h"
 #include "nodes/node_types.h"
 #include "py/obj.h"
@@ -12,14 +11,11 @@
 #include "physics/engine_physics_ids.h"
 #include "physics/engine_physics_collision.h"
 #include "utility/engine_time.h"
+#include "utility/engine_mp.h"
 #include "engine.h"
 #include "engine_collections.h"
 #include "engine_physics_module.h"
-
-// Bit array/collection to track nodes that have collided. In the `init` function
-// this is sized so that the output indices from a simple paring function can fit
-// (https://math.stackexchange.com/a/531914)
-engine_bit_collection_t collided_physics_nodes;
+#include "engine_physics_broadphase.h"
 
 const float slop = 0.1f;   // usually 0.01 to 0.1
 
@@ -28,15 +24,23 @@ const float slop = 0.1f;   // usually 0.01 to 0.1
 float time_accumulator = 0.0f;
 uint32_t frame_start_ms = 0;
 
+// Number of pairs that made it to narrowphase checking
+// during the last physics update
+uint32_t pairs_tested = 0;
+
 
 void engine_physics_init(){
     ENGINE_INFO_PRINTF("EnginePhysics: Starting...")
     engine_physics_ids_init();
-    engine_bit_collection_create(&collided_physics_nodes, engine_physics_ids_get_pair_index(PHYSICS_ID_MAX, PHYSICS_ID_MAX));
     frame_start_ms = millis();
 }
 
 
+uint32_t engine_physics_get_pairs_tested(){
+    return pairs_tested;
+}
+
+
 void engine_physics_apply_impulses(float dt, float alpha){
     vector2_class_obj_t *gravity = engine_physics_get_gravity();
 
@@ -47,13 +51,16 @@ void engine_physics_apply_impulses(float dt, float alpha){
         engine_node_base_t *node_base = physics_link_node->object;
         engine_physics_node_base_t *physics_node_base = node_base->node;
 
-        bool physics_node_dynamic = mp_obj_get_int(physics_node_base->dynamic);
+        bool physics_node_dynamic = physics_node_base->dynamic;
 
         if(physics_node_dynamic){
             vector2_class_obj_t *physics_node_velocity = physics_node_base->velocity;
             vector2_class_obj_t *physics_node_position = physics_node_base->position;
             vector2_class_obj_t *physics_node_gravity_scale = physics_node_base->gravity_scale;
 
+            float previous_x = physics_node_position->x.value;
+            float previous_y = physics_node_position->y.value;
+
             // Position correction
             physics_node_position->x.value += physics_node_base->total_position_correction_x;
             physics_node_position->y.value += physics_node_base->total_position_correction_y;
@@ -72,6 +79,11 @@ void engine_physics_apply_impulses(float dt, float alpha){
             physics_node_position->y.value += physics_node_velocity->y.value;
 
             physics_node_base->rotation += physics_node_base->angular_velocity;
+
+            // Written directly, let the node and its children know
+            if(physics_node_position->x.value != previous_x || physics_node_position->y.value != previous_y || physics_node_base->angular_velocity != 0.0f){
+                node_base_set_transform_changed(node_base);
+            }
         }
 
         // If the node was colliding last tick but isn't now, call the on_separate_cb callback
@@ -85,21 +97,9 @@ void engine_physics_apply_impulses(float dt, float alpha){
 
 
 bool engine_physics_collision_checked_before(engine_physics_node_base_t *physics_node_base_a, engine_physics_node_base_t *physics_node_base_b){
-    // Sort so that id_max*a_id + b_id comes out
-    // the same no matter which node is `a` or `b`
-    // Get the perfect hash code (can be perfect
-    // since the range is limited)
-    uint32_t pair_index = 0;
-
-    if(physics_node_base_a->physics_id > physics_node_base_b->physics_id){
-        pair_index = engine_physics_ids_get_pair_index(physics_node_base_b->physics_id, physics_node_base_a->physics_id);
-    }else{
-        pair_index = engine_physics_ids_get_pair_index(physics_node_base_a->physics_id, physics_node_base_b->physics_id);
-    }
-
-    bool checked_before = engine_bit_collection_get(&collided_physics_nodes, pair_index);   // Get if checked before
-    engine_bit_collection_set(&collided_physics_nodes, pair_index);                         // Set that it has/will be checked no matter what
-    return checked_before;
+    // Only pairs that made it past the broadphase get here, the set
+    // this is tracked in grows with those instead of all possible pairs
+    return engine_physics_ids_check_pair(physics_node_base_a->physics_id, physics_node_base_b->physics_id);
 }
 
 
@@ -120,6 +120,8 @@ void engine_physics_collide_types(engine_node_base_t *node_base_a, engine_node_b
         return;
     }
 
+    pairs_tested++;
+
     physics_contact_t contact;
     engine_physics_setup_contact(&contact);
 
@@ -174,15 +176,15 @@ void engine_physics_collide_types(engine_node_base_t *node_base_a, engine_node_b
         physics_node_base_a->colliding = true;
         physics_node_base_b->colliding = true;
 
-        bool physics_node_a_dynamic = mp_obj_get_int(physics_node_base_a->dynamic);
-        bool physics_node_b_dynamic = mp_obj_get_int(physics_node_base_b->dynamic);
+        bool physics_node_a_dynamic = physics_node_base_a->dynamic;
+        bool physics_node_b_dynamic = physics_node_base_b->dynamic;
 
-        bool physics_node_a_solid = mp_obj_get_int(physics_node_base_a->solid);
-        bool physics_node_b_solid = mp_obj_get_int(physics_node_base_b->solid);
+        bool physics_node_a_solid = physics_node_base_a->solid;
+        bool physics_node_b_solid = physics_node_base_b->solid;
 
         // Calculate restitution/bounciness
-        float physics_node_a_bounciness = mp_obj_get_float(physics_node_base_a->bounciness);
-        float physics_node_b_bounciness = mp_obj_get_float(physics_node_base_b->bounciness);
+        float physics_node_a_bounciness = physics_node_base_a->bounciness;
+        float physics_node_b_bounciness = physics_node_base_b->bounciness;
         // float bounciness = (physics_node_a_bounciness+physics_node_b_bounciness) * 0.5f; // Restitution: https://github.com/victorfisac/Physac/blob/29d9fc06860b54571a02402fff6fa8572d19bd12/src/physac.h#L1664
         float bounciness = sqrtf(physics_node_a_bounciness*physics_node_b_bounciness);
 
@@ -288,8 +290,8 @@ void engine_physics_collide_types(engine_node_base_t *node_base_a, engine_node_b
 
 
         // Friction: https://code.tutsplus.com/how-to-create-a-custom-2d-physics-engine-friction-scene-and-jump-table--gamedev-7756t#:~:text=in%20our%20collision%20resolver
-        float a_friction = mp_obj_get_float(physics_node_base_a->friction);
-        float b_friction = mp_obj_get_float(physics_node_base_b->friction);
+        float a_friction = physics_node_base_a->friction;
+        float b_friction = physics_node_base_b->friction;
         float mu = sqrtf(a_friction + b_friction);
 
         contact.relative_velocity_x = physics_node_b_velocity->x.value - physics_node_a_velocity->x.value;
@@ -326,29 +328,21 @@ void engine_physics_collide_types(engine_node_base_t *node_base_a, engine_node_b
             }
         }
 
-        mp_obj_t collision_contact_data[5];
-        collision_contact_data[0] = mp_obj_new_float(contact.collision_contact_x);
-        collision_contact_data[1] = mp_obj_new_float(contact.collision_contact_y);
-        collision_contact_data[2] = mp_obj_new_float(contact.collision_normal_x);
-        collision_contact_data[3] = mp_obj_new_float(contact.collision_normal_y);
-
         mp_obj_t exec[3];
 
         // Call A callback
         if(physics_node_base_a->on_collide_cb != mp_const_none){
-            collision_contact_data[4] = node_base_b->attr_accessor;
             exec[0] = physics_node_base_a->on_collide_cb;
             exec[1] = node_base_a->attr_accessor;
-            exec[2] = collision_contact_2d_class_new(&collision_contact_2d_class_type, 5, 0, collision_contact_data);
+            exec[2] = collision_contact_2d_get_reusable(physics_node_base_a, contact.collision_contact_x, contact.collision_contact_y, contact.collision_normal_x, contact.collision_normal_y, node_base_b->attr_accessor);
             mp_call_method_n_kw(1, 0, exec);
         }
 
         // Call B callback
         if(physics_node_base_b->on_collide_cb != mp_const_none){
-            collision_contact_data[4] = node_base_a->attr_accessor;
             exec[0] = physics_node_base_b->on_collide_cb;
             exec[1] = node_base_b->attr_accessor;
-            exec[2] = collision_contact_2d_class_new(&collision_contact_2d_class_type, 5, 0, collision_contact_data);
+            exec[2] = collision_contact_2d_get_reusable(physics_node_base_b, contact.collision_contact_x, contact.collision_contact_y, contact.collision_normal_x, contact.collision_normal_y, node_base_a->attr_accessor);
             mp_call_method_n_kw(1, 0, exec);
         }
     }
@@ -356,37 +350,21 @@ void engine_physics_collide_types(engine_node_base_t *node_base_a, engine_node_b
 
 
 void engine_physics_update(float dt){
-    // Loop through all nodes and test for collision against
-    // all other nodes (not optimized checking of if nodes are
-    // even possibly close to each other)
-    linked_list *physics_list = engine_collections_get_physics_list();
-    linked_list_node *physics_link_node_a = physics_list->start;
-    while(physics_link_node_a != NULL){
-        // Now check 'a' against all nodes 'b'
-        linked_list_node *physics_link_node_b = physics_list->start;
-
-        while(physics_link_node_b != NULL){
-            // Make sure we are not checking against ourselves
-            if(physics_link_node_a->object != physics_link_node_b->object){
-                engine_physics_collide_types(physics_link_node_a->object, physics_link_node_b->object);
-            }
-
-            physics_link_node_b = physics_link_node_b->next;
-        }
+    pairs_tested = 0;
 
-        // Now that `a` was compared to all `b`,
-        // move onto the next `a` and do it again
-        physics_link_node_a = physics_link_node_a->next;
-    }
+    // Only pairs of nodes with overlapping bounding
+    // boxes are passed on for collision checking
+    engine_physics_broadphase_find_pairs(engine_physics_collide_types);
 
-    // After everything physics related is done, reset the bit array
-    // used for tracking which pairs of nodes had already collided
-    engine_bit_collection_erase(&collided_physics_nodes);
+    // After everything physics related is done, forget
+    // which pairs of nodes had already been checked
+    engine_physics_ids_clear_pairs();
 }
 
 
 void engine_physics_physics_tick(float dt_s){
     mp_obj_t exec[3];
+    mp_obj_t dt_obj = engine_mp_float_shared_ms(dt_s);
 
     // Loop through all nodes and call their physics_tick callbacks
     linked_list *physics_list = engine_collections_get_physics_list();
@@ -398,7 +376,7 @@ void engine_physics_physics_tick(float dt_s){
         if(physics_node_base->physics_tick_cb != mp_const_none){
             exec[0] = physics_node_base->physics_tick_cb;
             exec[1] = node_base->attr_accessor;
-            exec[2] = mp_obj_new_float(dt_s);
+            exec[2] = dt_obj;
             mp_call_method_n_kw(1, 0, exec);
         }
 
@@ -5,19 +5,15 @@
 #include "nodes/node_base.h"
 #include "math/vector2.h"
 
-// This should be called when a new physics node is
-// created and the result assigned to the node
-uint8_t engine_physics_take_available_id();
-
-// This should be called when a physics node is being deleted/collected
-// and the assigned ID given back to the ID pool for the future
-void engine_physics_give_back_id(uint8_t id);
-
 // Creates array of IDs for physics nodes and
 // creates a bit collection for tracking which
 // nodes already collided each frame
 void engine_physics_init();
 
+// Returns how many pairs of nodes were passed to the narrowphase
+// (the separating axis checks) during the last physics update
+uint32_t engine_physics_get_pairs_tested();
+
 void engine_physics_physics_tick(float dt_s);
 void engine_physics_tick();
 
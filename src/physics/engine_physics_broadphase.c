@@ -0,0 +1,340 @@
+#include "engine_physics_broadphase.h"
+#include "debug/debug_print.h"
+#include "nodes/node_types.h"
+#include "nodes/physics_node_base.h"
+#include "nodes/2D/physics_rectangle_2d_node.h"
+#include "nodes/2D/physics_circle_2d_node.h"
+#include "engine_collections.h"
+#include "py/runtime.h"
+#include <stdlib.h>
+#include <math.h>
+
+
+// Axis-aligned bounding box around a physics node in world space
+typedef struct{
+    engine_node_base_t *node_base;
+    float min_x;
+    float min_y;
+    float max_x;
+    float max_y;
+    uint16_t list_index;    // Index of the node in the physics list (used to keep pairs ordered like the brute force path)
+    bool oversized;         // Set when the grid would need to place this box in too many cells
+}engine_physics_aabb_t;
+
+
+// One entry per grid cell that a box touches
+typedef struct{
+    uint32_t cell_hash;
+    uint16_t aabb_index;
+}engine_physics_cell_entry_t;
+
+
+uint8_t broadphase_mode = ENGINE_PHYSICS_BROADPHASE_SWEEP;
+float broadphase_cell_size = 32.0f;
+
+// These arrays live on the C heap and are only grown, never
+// shrunk, so that a steady number of bodies does not cause
+// any allocations after the first few physics ticks
+engine_physics_aabb_t *broadphase_aabbs = NULL;
+uint32_t broadphase_aabbs_capacity = 0;
+
+engine_physics_cell_entry_t *broadphase_cells = NULL;
+uint32_t broadphase_cells_capacity = 0;
+
+uint16_t *broadphase_oversized = NULL;
+uint32_t broadphase_oversized_capacity = 0;
+
+
+static void *engine_physics_broadphase_grow(void *array, uint32_t *capacity, uint32_t needed, size_t element_size){
+    if(needed <= *capacity){
+        return array;
+    }
+
+    uint32_t new_capacity = (*capacity == 0) ? 32 : *capacity;
+    while(new_capacity < needed){
+        new_capacity *= 2;
+    }
+
+    void *grown = realloc(array, new_capacity * element_size);
+
+    if(grown == NULL){
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("EnginePhysics: ERROR: Ran out of memory growing broadphase arrays"));
+    }
+
+    *capacity = new_capacity;
+    return grown;
+}
+
+
+void engine_physics_broadphase_set_mode(uint8_t mode){
+    if(mode > ENGINE_PHYSICS_BROADPHASE_GRID){
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("EnginePhysics: ERROR: Unknown broadphase mode"));
+    }
+
+    broadphase_mode = mode;
+}
+
+
+uint8_t engine_physics_broadphase_get_mode(){
+    return broadphase_mode;
+}
+
+
+void engine_physics_broadphase_set_cell_size(float cell_size){
+    if(cell_size <= 0.0f){
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("EnginePhysics: ERROR: Broadphase cell size must be greater than zero"));
+    }
+
+    broadphase_cell_size = cell_size;
+}
+
+
+float engine_physics_broadphase_get_cell_size(){
+    return broadphase_cell_size;
+}
+
+
+void engine_physics_broadphase_reset(){
+    free(broadphase_aabbs);
+    free(broadphase_cells);
+    free(broadphase_oversized);
+
+    broadphase_aabbs = NULL;
+    broadphase_cells = NULL;
+    broadphase_oversized = NULL;
+
+    broadphase_aabbs_capacity = 0;
+    broadphase_cells_capacity = 0;
+    broadphase_oversized_capacity = 0;
+
+    broadphase_mode = ENGINE_PHYSICS_BROADPHASE_SWEEP;
+    broadphase_cell_size = 32.0f;
+}
+
+
+// Fits a box around the same world space shape that
+// `engine_physics_setup_abs_rectangle/circle` builds
+static void engine_physics_broadphase_compute_aabb(engine_node_base_t *node_base, engine_physics_aabb_t *aabb){
+    engine_physics_node_base_t *physics_node_base = node_base->node;
+
+    engine_inheritable_2d_t inherited;
+    node_base_inherit_2d(node_base, &inherited);
+
+    float extent_x = 0.0f;
+    float extent_y = 0.0f;
+
+    if(node_base->type == NODE_TYPE_PHYSICS_RECTANGLE_2D){
+        engine_physics_rectangle_2d_node_class_obj_t *rectangle = physics_node_base->unique_data;
+
+        float half_width = fabsf(mp_obj_get_float(rectangle->width) * inherited.sx * 0.5f);
+        float half_height = fabsf(mp_obj_get_float(rectangle->height) * inherited.sy * 0.5f);
+
+        // Extents of the rotated rectangle along each axis
+        float cos_rotation = fabsf(cosf(inherited.rotation));
+        float sin_rotation = fabsf(sinf(inherited.rotation));
+
+        extent_x = half_width * cos_rotation + half_height * sin_rotation;
+        extent_y = half_width * sin_rotation + half_height * cos_rotation;
+    }else{
+        engine_physics_circle_2d_node_class_obj_t *circle = physics_node_base->unique_data;
+
+        float scale_radius_by = (inherited.sx < inherited.sy) ? inherited.sx : inherited.sy;
+
+        extent_x = fabsf(mp_obj_get_float(circle->radius) * scale_radius_by);
+        extent_y = extent_x;
+    }
+
+    aabb->node_base = node_base;
+    aabb->min_x = inherited.px - extent_x;
+    aabb->max_x = inherited.px + extent_x;
+    aabb->min_y = inherited.py - extent_y;
+    aabb->max_y = inherited.py + extent_y;
+    aabb->oversized = false;
+}
+
+
+static inline bool engine_physics_broadphase_overlap(engine_physics_aabb_t *a, engine_physics_aabb_t *b){
+    return a->min_x <= b->max_x && a->max_x >= b->min_x &&
+           a->min_y <= b->max_y && a->max_y >= b->min_y;
+}
+
+
+static inline void engine_physics_broadphase_emit(engine_physics_aabb_t *a, engine_physics_aabb_t *b, engine_physics_pair_cb pair_cb){
+    if(a->list_index < b->list_index){
+        pair_cb(a->node_base, b->node_base);
+    }else{
+        pair_cb(b->node_base, a->node_base);
+    }
+}
+
+
+static int engine_physics_broadphase_compare_min_x(const void *a, const void *b){
+    float a_min_x = ((const engine_physics_aabb_t*)a)->min_x;
+    float b_min_x = ((const engine_physics_aabb_t*)b)->min_x;
+    return (a_min_x > b_min_x) - (a_min_x < b_min_x);
+}
+
+
+static int engine_physics_broadphase_compare_cells(const void *a, const void *b){
+    const engine_physics_cell_entry_t *cell_a = a;
+    const engine_physics_cell_entry_t *cell_b = b;
+
+    if(cell_a->cell_hash != cell_b->cell_hash){
+        return (cell_a->cell_hash > cell_b->cell_hash) ? 1 : -1;
+    }
+
+    return (int)cell_a->aabb_index - (int)cell_b->aabb_index;
+}
+
+
+static void engine_physics_broadphase_brute_force(engine_physics_pair_cb pair_cb){
+    // Test each node against every node after it in the list
+    linked_list *physics_list = engine_collections_get_physics_list();
+    linked_list_node *physics_link_node_a = physics_list->start;
+    while(physics_link_node_a != NULL){
+        linked_list_node *physics_link_node_b = physics_link_node_a->next;
+
+        while(physics_link_node_b != NULL){
+            pair_cb(physics_link_node_a->object, physics_link_node_b->object);
+            physics_link_node_b = physics_link_node_b->next;
+        }
+
+        physics_link_node_a = physics_link_node_a->next;
+    }
+}
+
+
+static void engine_physics_broadphase_sweep(uint32_t aabb_count, engine_physics_pair_cb pair_cb){
+    qsort(broadphase_aabbs, aabb_count, sizeof(engine_physics_aabb_t), engine_physics_broadphase_compare_min_x);
+
+    for(uint32_t i=0; i<aabb_count; i++){
+        engine_physics_aabb_t *a = &broadphase_aabbs[i];
+
+        // Boxes are sorted by their left edge, once a box starts
+        // past the right edge of `a` no other boxes can overlap it
+        for(uint32_t j=i+1; j<aabb_count; j++){
+            engine_physics_aabb_t *b = &broadphase_aabbs[j];
+
+            if(b->min_x > a->max_x){
+                break;
+            }
+
+            if(a->min_y <= b->max_y && a->max_y >= b->min_y){
+                engine_physics_broadphase_emit(a, b, pair_cb);
+            }
+        }
+    }
+}
+
+
+static void engine_physics_broadphase_grid(uint32_t aabb_count, engine_physics_pair_cb pair_cb){
+    float inverse_cell_size = 1.0f / broadphase_cell_size;
+
+    uint32_t cell_count = 0;
+    uint32_t oversized_count = 0;
+
+    for(uint32_t i=0; i<aabb_count; i++){
+        engine_physics_aabb_t *aabb = &broadphase_aabbs[i];
+
+        int32_t cell_min_x = (int32_t)floorf(aabb->min_x * inverse_cell_size);
+        int32_t cell_min_y = (int32_t)floorf(aabb->min_y * inverse_cell_size);
+        int32_t cell_max_x = (int32_t)floorf(aabb->max_x * inverse_cell_size);
+        int32_t cell_max_y = (int32_t)floorf(aabb->max_y * inverse_cell_size);
+
+        int32_t covered_cells = (cell_max_x - cell_min_x + 1) * (cell_max_y - cell_min_y + 1);
+
+        // Large bodies would flood the grid, test those against everything instead
+        if(covered_cells > ENGINE_PHYSICS_BROADPHASE_GRID_MAX_CELLS_PER_BODY || covered_cells <= 0){
+            broadphase_oversized = engine_physics_broadphase_grow(broadphase_oversized, &broadphase_oversized_capacity, oversized_count+1, sizeof(uint16_t));
+            broadphase_oversized[oversized_count++] = i;
+            aabb->oversized = true;
+            continue;
+        }
+
+        broadphase_cells = engine_physics_broadphase_grow(broadphase_cells, &broadphase_cells_capacity, cell_count+covered_cells, sizeof(engine_physics_cell_entry_t));
+
+        for(int32_t cell_y=cell_min_y; cell_y<=cell_max_y; cell_y++){
+            for(int32_t cell_x=cell_min_x; cell_x<=cell_max_x; cell_x++){
+                // https://matthias-research.github.io/pages/publications/tetraederCollision.pdf
+                broadphase_cells[cell_count].cell_hash = ((uint32_t)cell_x * 73856093u) ^ ((uint32_t)cell_y * 19349663u);
+                broadphase_cells[cell_count].aabb_index = i;
+                cell_count++;
+            }
+        }
+    }
+
+    // Sort so that boxes in the same cell end up next to each other
+    qsort(broadphase_cells, cell_count, sizeof(engine_physics_cell_entry_t), engine_physics_broadphase_compare_cells);
+
+    uint32_t run_start = 0;
+    while(run_start < cell_count){
+        uint32_t run_end = run_start + 1;
+        while(run_end < cell_count && broadphase_cells[run_end].cell_hash == broadphase_cells[run_start].cell_hash){
+            run_end++;
+        }
+
+        // Bodies sharing more than one cell will be emitted more than once,
+        // the pair tracking in `engine_physics_collide_types` skips repeats
+        for(uint32_t i=run_start; i<run_end; i++){
+            engine_physics_aabb_t *a = &broadphase_aabbs[broadphase_cells[i].aabb_index];
+
+            for(uint32_t j=i+1; j<run_end; j++){
+                engine_physics_aabb_t *b = &broadphase_aabbs[broadphase_cells[j].aabb_index];
+
+                if(engine_physics_broadphase_overlap(a, b)){
+                    engine_physics_broadphase_emit(a, b, pair_cb);
+                }
+            }
+        }
+
+        run_start = run_end;
+    }
+
+    for(uint32_t i=0; i<oversized_count; i++){
+        uint16_t oversized_index = broadphase_oversized[i];
+        engine_physics_aabb_t *a = &broadphase_aabbs[oversized_index];
+
+        for(uint32_t j=0; j<aabb_count; j++){
+            engine_physics_aabb_t *b = &broadphase_aabbs[j];
+
+            // Pairs of oversized bodies only need to be tested once
+            if(j == oversized_index || (b->oversized && j < oversized_index)){
+                continue;
+            }
+
+            if(engine_physics_broadphase_overlap(a, b)){
+                engine_physics_broadphase_emit(a, b, pair_cb);
+            }
+        }
+    }
+}
+
+
+void engine_physics_broadphase_find_pairs(engine_physics_pair_cb pair_cb){
+    if(broadphase_mode == ENGINE_PHYSICS_BROADPHASE_NONE){
+        engine_physics_broadphase_brute_force(pair_cb);
+        return;
+    }
+
+    // Gather the boxes of every physics node
+    linked_list *physics_list = engine_collections_get_physics_list();
+    linked_list_node *physics_link_node = physics_list->start;
+
+    uint32_t aabb_count = 0;
+
+    while(physics_link_node != NULL){
+        broadphase_aabbs = engine_physics_broadphase_grow(broadphase_aabbs, &broadphase_aabbs_capacity, aabb_count+1, sizeof(engine_physics_aabb_t));
+
+        engine_physics_broadphase_compute_aabb(physics_link_node->object, &broadphase_aabbs[aabb_count]);
+        broadphase_aabbs[aabb_count].list_index = aabb_count;
+        aabb_count++;
+
+        physics_link_node = physics_link_node->next;
+    }
+
+    if(broadphase_mode == ENGINE_PHYSICS_BROADPHASE_SWEEP){
+        engine_physics_broadphase_sweep(aabb_count, pair_cb);
+    }else{
+        engine_physics_broadphase_grid(aabb_count, pair_cb);
+    }
+}
@@ -0,0 +1,41 @@
+#ifndef ENGINE_PHYSICS_BROADPHASE_H
+#define ENGINE_PHYSICS_BROADPHASE_H
+
+#include <stdint.h>
+#include "nodes/node_base.h"
+
+// Test every physics node against every other physics node
+#define ENGINE_PHYSICS_BROADPHASE_NONE  0
+
+// Sort nodes by the left edge of their bounding boxes and
+// only test nodes whose boxes overlap along x then y
+#define ENGINE_PHYSICS_BROADPHASE_SWEEP 1
+
+// Bin nodes into a uniform grid of cells and only test
+// nodes that share a cell and have overlapping boxes
+#define ENGINE_PHYSICS_BROADPHASE_GRID  2
+
+// Bodies that would be placed in more than this many grid
+// cells are instead tested against every other body
+#define ENGINE_PHYSICS_BROADPHASE_GRID_MAX_CELLS_PER_BODY 16
+
+
+// Callback that each candidate pair is passed to. `a` always
+// comes before `b` in the physics list
+typedef void (*engine_physics_pair_cb)(engine_node_base_t *node_base_a, engine_node_base_t *node_base_b);
+
+void engine_physics_broadphase_set_mode(uint8_t mode);
+uint8_t engine_physics_broadphase_get_mode();
+
+void engine_physics_broadphase_set_cell_size(float cell_size);
+float engine_physics_broadphase_get_cell_size();
+
+// Finds all pairs of physics nodes that could be colliding and
+// passes each of them to `pair_cb` for narrowphase checking
+void engine_physics_broadphase_find_pairs(engine_physics_pair_cb pair_cb);
+
+// Frees the arrays the broadphase grows while running
+// and goes back to the default mode and cell size
+void engine_physics_broadphase_reset();
+
+#endif  // ENGINE_PHYSICS_BROADPHASE_H
@@ -32,7 +32,7 @@ void engine_physics_setup_abs_rectangle(engine_node_base_t *node_base, physics_a
     abs_rect->rotation = inherited.rotation;
 
     engine_physics_rectangle_2d_node_calculate(physics_rect, inherited.sx, inherited.sy, abs_rect->vertices_x, abs_rect->vertices_y, abs_rect->normals_x, abs_rect->normals_y, abs_rect->rotation);
-    abs_rect->dynamic = mp_obj_get_int(physics_rect->dynamic);
+    abs_rect->dynamic = physics_rect->dynamic;
 }
 
 
@@ -55,7 +55,7 @@ void engine_physics_setup_abs_circle(engine_node_base_t *node_base, physics_abs_
     }
 
     abs_circle->radius = mp_obj_get_float(circle->radius) * scale_radius_by;
-    abs_circle->dynamic = mp_obj_get_int(physics_circle->dynamic);
+    abs_circle->dynamic = physics_circle->dynamic;
 }
 
 
@@ -78,8 +78,8 @@ void engine_physics_cancel_dynamics(engine_physics_node_base_t *physics_node_bas
     vector2_class_obj_t *physics_node_a_velocity = physics_node_base_a->velocity;
     vector2_class_obj_t *physics_node_b_velocity = physics_node_base_b->velocity;
 
-    bool physics_node_a_dynamic = mp_obj_get_int(physics_node_base_a->dynamic);
-    bool physics_node_b_dynamic = mp_obj_get_int(physics_node_base_b->dynamic);
+    bool physics_node_a_dynamic = physics_node_base_a->dynamic;
+    bool physics_node_b_dynamic = physics_node_base_b->dynamic;
 
     // If either node is not dynamic, set any velocities to zero no matter what set to
     if(!physics_node_a_dynamic){
@@ -1,37 +1,173 @@
 #include "engine_physics_ids.h"
+#include "debug/debug_print.h"
 #include "py/obj.h"
 #include "py/runtime.h"
+#include <stdlib.h>
+#include <string.h>
 
-// Buffer of available physics IDs. Filled with values
-// 1 -> `PHYSICS_ID_MAX` on physics `init`. 
-uint8_t available_physics_ids[PHYSICS_ID_MAX];
-uint8_t next_available_physics_id_index = 0;
+
+// Stack of IDs that were given back, reused before making new
+// ones. Lives on the C heap and only grows, same as the number
+// of nodes that existed at once
+uint16_t *available_physics_ids = NULL;
+uint32_t available_physics_ids_count = 0;
+uint32_t available_physics_ids_capacity = 0;
+
+// The next never used ID, IDs start at 1
+uint32_t next_new_physics_id = 1;
+
+
+// One slot of the checked pairs hash set. A slot is only in use
+// if its `generation` matches `physics_pairs_generation`, which
+// is how all pairs are forgotten without touching any slots
+typedef struct{
+    uint32_t pair_index;
+    uint32_t generation;
+}engine_physics_pair_slot_t;
+
+engine_physics_pair_slot_t *physics_pairs = NULL;
+uint32_t physics_pairs_capacity = 0;                // Always a power of two
+uint32_t physics_pairs_count = 0;                   // Slots in use this generation
+uint32_t physics_pairs_generation = 1;
 
 
 void engine_physics_ids_init(){
-    for(uint8_t idx=0; idx<PHYSICS_ID_MAX; idx++){
-        available_physics_ids[idx] = idx+1;
-    }
+    available_physics_ids_count = 0;
+    next_new_physics_id = 1;
+
+    free(physics_pairs);
+    physics_pairs = NULL;
+    physics_pairs_capacity = 0;
+    physics_pairs_count = 0;
+    physics_pairs_generation = 1;
 }
 
 
-uint8_t engine_physics_ids_take_available(){
-    if(next_available_physics_id_index >= PHYSICS_ID_MAX){
+uint16_t engine_physics_ids_take_available(){
+    if(available_physics_ids_count > 0){
+        available_physics_ids_count--;
+        return available_physics_ids[available_physics_ids_count];
+    }
+
+    if(next_new_physics_id > PHYSICS_ID_MAX){
         mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("EnginePhysics: ERROR: Ran out of IDs to give physics nodes..."));
     }
 
-    uint8_t id = available_physics_ids[next_available_physics_id_index];
-    next_available_physics_id_index++;
+    uint16_t id = (uint16_t)next_new_physics_id;
+    next_new_physics_id++;
     return id;
 }
 
 
-void engine_physics_ids_give_back(uint8_t id){
-    next_available_physics_id_index--;
-    available_physics_ids[next_available_physics_id_index] = id;
+void engine_physics_ids_give_back(uint16_t id){
+    // Called from finalizers, can't raise
+    if(available_physics_ids_count == available_physics_ids_capacity){
+        uint32_t new_capacity = (available_physics_ids_capacity == 0) ? 32 : available_physics_ids_capacity * 2;
+        uint16_t *grown = realloc(available_physics_ids, new_capacity * sizeof(uint16_t));
+
+        if(grown == NULL){
+            ENGINE_ERROR_PRINTF("EnginePhysics: Could not grow the available ID stack, ID %d will not be reused", id);
+            return;
+        }
+
+        available_physics_ids = grown;
+        available_physics_ids_capacity = new_capacity;
+    }
+
+    available_physics_ids[available_physics_ids_count] = id;
+    available_physics_ids_count++;
+}
+
+
+uint32_t engine_physics_ids_get_pair_index(uint16_t a_id, uint16_t b_id){
+    if(a_id > b_id){
+        return ((uint32_t)b_id << 16) | a_id;
+    }
+
+    return ((uint32_t)a_id << 16) | b_id;
+}
+
+
+static inline uint32_t engine_physics_ids_hash_pair(uint32_t pair_index){
+    // https://github.com/skeeto/hash-prospector (lowbias32)
+    pair_index ^= pair_index >> 16;
+    pair_index *= 0x7feb352d;
+    pair_index ^= pair_index >> 15;
+    pair_index *= 0x846ca68b;
+    pair_index ^= pair_index >> 16;
+    return pair_index;
+}
+
+
+// Places `pair_index` into `slots`, returns true if it was already there
+static bool engine_physics_ids_insert_pair(engine_physics_pair_slot_t *slots, uint32_t capacity, uint32_t pair_index){
+    uint32_t mask = capacity - 1;
+    uint32_t slot_index = engine_physics_ids_hash_pair(pair_index) & mask;
+
+    // Linear probing, there is always a free slot since
+    // the set is grown before it gets more than half full
+    while(slots[slot_index].generation == physics_pairs_generation){
+        if(slots[slot_index].pair_index == pair_index){
+            return true;
+        }
+
+        slot_index = (slot_index + 1) & mask;
+    }
+
+    slots[slot_index].pair_index = pair_index;
+    slots[slot_index].generation = physics_pairs_generation;
+    return false;
+}
+
+
+static void engine_physics_ids_grow_pairs(){
+    uint32_t new_capacity = (physics_pairs_capacity == 0) ? PHYSICS_PAIRS_START_CAPACITY : physics_pairs_capacity * 2;
+    engine_physics_pair_slot_t *grown = calloc(new_capacity, sizeof(engine_physics_pair_slot_t));
+
+    if(grown == NULL){
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("EnginePhysics: ERROR: Ran out of memory growing collision pair set"));
+    }
+
+    // Only the pairs from this generation are worth keeping
+    for(uint32_t slot_index=0; slot_index<physics_pairs_capacity; slot_index++){
+        if(physics_pairs[slot_index].generation == physics_pairs_generation){
+            engine_physics_ids_insert_pair(grown, new_capacity, physics_pairs[slot_index].pair_index);
+        }
+    }
+
+    free(physics_pairs);
+    physics_pairs = grown;
+    physics_pairs_capacity = new_capacity;
 }
 
 
-uint32_t engine_physics_ids_get_pair_index(uint8_t a_id, uint8_t b_id){
-    return PHYSICS_ID_MAX * (uint32_t)a_id + (uint32_t)b_id;
-}
\ No newline at end of file
+bool engine_physics_ids_check_pair(uint16_t a_id, uint16_t b_id){
+    if((physics_pairs_count + 1) * 2 > physics_pairs_capacity){
+        engine_physics_ids_grow_pairs();
+    }
+
+    bool checked_before = engine_physics_ids_insert_pair(physics_pairs, physics_pairs_capacity, engine_physics_ids_get_pair_index(a_id, b_id));
+
+    if(checked_before == false){
+        physics_pairs_count++;
+    }
+
+    return checked_before;
+}
+
+
+void engine_physics_ids_clear_pairs(){
+    physics_pairs_count = 0;
+    physics_pairs_generation++;
+
+    // Slots are zeroed when made, generation 0 is never used so that
+    // new slots are empty. After wrapping around old slots could look
+    // like they are in use, clear them that one time
+    if(physics_pairs_generation == 0){
+        if(physics_pairs != NULL){
+            memset(physics_pairs, 0, physics_pairs_capacity * sizeof(engine_physics_pair_slot_t));
+        }
+
+        physics_pairs_generation = 1;
+    }
+}
@@ -1,26 +1,37 @@
 #ifndef ENGINE_PHYSICS_IDS
 #define ENGINE_PHYSICS_IDS
 
-#include "utility/engine_bit_collection.h"
+#include <stdint.h>
+#include <stdbool.h>
 
-// The maximum number of physics nodes that can exist in a scene is restricted
-// by the number of IDs available to give those nodes. The number of IDs is
-// limited so that IDs can be used with a simple paring function to index in
-// a large bit array to check if collisions between objects have already occurred
-#define PHYSICS_ID_MAX 180
+// Every physics node gets a unique ID so that pairs of nodes can be
+// tracked while colliding. IDs that are given back are reused before
+// new ones are made, so IDs stay as small as the number of nodes
+#define PHYSICS_ID_MAX UINT16_MAX
 
-// Fill `available_physics_ids` with IDs from `1` -> `PHYSICS_ID_MAX`
-// through indices `0` -> `PHYSICS_ID_MAX-1`
+// Pairs that were checked in a physics update are stored in a hash
+// set that starts with this many slots and doubles when half full
+#define PHYSICS_PAIRS_START_CAPACITY 64
+
+// Gets the ID pool and pair set ready for use
 void engine_physics_ids_init();
 
 // Get the next available ID (probably needed for new objects)
-uint8_t engine_physics_ids_take_available();
+uint16_t engine_physics_ids_take_available();
 
 // Give back an ID to the ID pool (probably had a node get deleted)
-void engine_physics_ids_give_back(uint8_t id);
+void engine_physics_ids_give_back(uint16_t id);
+
+// Get a unique key for a pair of IDs, the same no matter the order of the IDs
+uint32_t engine_physics_ids_get_pair_index(uint16_t a_id, uint16_t b_id);
+
+// Returns true if the pair was already checked since the last
+// `engine_physics_ids_clear_pairs()`, and marks it as checked
+bool engine_physics_ids_check_pair(uint16_t a_id, uint16_t b_id);
 
-// Get a unique ID/index for a pair of IDS (used for checking if already collided in a bit collection)
-// Uses a simple pairing function (https://math.stackexchange.com/a/531914)
-uint32_t engine_physics_ids_get_pair_index(uint8_t a_id, uint8_t b_id);
+// Forgets all checked pairs. Doesn't touch the pair set, only
+// moves on to a new generation, so costs the same no matter
+// how many pairs were checked
+void engine_physics_ids_clear_pairs();
 
-#endif  // ENGINE_PHYSICS_IDS
\ No newline at end of file
+#endif  // ENGINE_PHYSICS_IDS
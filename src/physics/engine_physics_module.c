@@ -5,6 +5,7 @@
 #include "nodes/node_base.h"
 #include "display/engine_display_common.h"
 #include "physics/engine_physics.h"
+#include "physics/engine_physics_broadphase.h"
 #include "physics/collision_contact_2d.h"
 
 
@@ -54,6 +55,52 @@ mp_obj_t engine_physics_get_gravity(){
 MP_DEFINE_CONST_FUN_OBJ_0(engine_physics_get_gravity_obj, engine_physics_get_gravity);
 
 
+/* --- doc ---
+   NAME: set_broadphase
+   ID: set_broadphase
+   DESC: Sets how pairs of physics nodes that could be colliding are found before the exact (and slower) collision checks are done. `BROADPHASE_SWEEP` (default) sorts nodes along x and only checks nodes whose bounding boxes overlap, `BROADPHASE_GRID` bins nodes into cells of `cell_size` pixels and only checks nodes sharing a cell, and `BROADPHASE_NONE` checks every node against every other node
+   PARAM: [type=enum/int]   [name=mode]         [value=enum/int (see BROADPHASE_* constants)]
+   PARAM: [type=float]      [name=cell_size]    [value=any greater than 0 (optional, only used by `BROADPHASE_GRID`, defaults to 32)]
+   RETURN: None
+*/
+static mp_obj_t engine_physics_set_broadphase(size_t n_args, const mp_obj_t *args){
+    ENGINE_INFO_PRINTF("EnginePhysics: Setting broadphase");
+    engine_physics_broadphase_set_mode(mp_obj_get_int(args[0]));
+
+    if(n_args == 2){
+        engine_physics_broadphase_set_cell_size(mp_obj_get_float(args[1]));
+    }
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(engine_physics_set_broadphase_obj, 1, 2, engine_physics_set_broadphase);
+
+
+/* --- doc ---
+   NAME: get_broadphase
+   ID: get_broadphase
+   DESC: Gets the mode used for finding pairs of physics nodes that could be colliding
+   RETURN: enum/int
+*/
+static mp_obj_t engine_physics_get_broadphase(){
+    ENGINE_INFO_PRINTF("EnginePhysics: Getting broadphase");
+    return mp_obj_new_int(engine_physics_broadphase_get_mode());
+}
+MP_DEFINE_CONST_FUN_OBJ_0(engine_physics_get_broadphase_obj, engine_physics_get_broadphase);
+
+
+/* --- doc ---
+   NAME: get_pairs_tested
+   ID: get_pairs_tested
+   DESC: Gets how many pairs of physics nodes went through exact collision checks during the last physics update. Useful for seeing how much work the broadphase is saving
+   RETURN: int
+*/
+static mp_obj_t engine_physics_get_pairs_tested_wrapper(){
+    return mp_obj_new_int(engine_physics_get_pairs_tested());
+}
+MP_DEFINE_CONST_FUN_OBJ_0(engine_physics_get_pairs_tested_obj, engine_physics_get_pairs_tested_wrapper);
+
+
 static mp_obj_t engine_physics_module_init(){
     engine_main_raise_if_not_initialized();
     return mp_const_none;
@@ -67,6 +114,12 @@ MP_DEFINE_CONST_FUN_OBJ_0(engine_physics_module_init_obj, engine_physics_module_
    DESC: Module for controlling physics and for common physics collision shapes
    ATTR: [type=function] [name={ref_link:set_gravity}]                     [value=function]
    ATTR: [type=function] [name={ref_link:get_gravity}]                     [value=function]
+   ATTR: [type=function] [name={ref_link:set_broadphase}]                  [value=function]
+   ATTR: [type=function] [name={ref_link:get_broadphase}]                  [value=function]
+   ATTR: [type=function] [name={ref_link:get_pairs_tested}]                [value=function]
+   ATTR: [type=enum/int] [name=BROADPHASE_NONE]                            [value=0]
+   ATTR: [type=enum/int] [name=BROADPHASE_SWEEP]                           [value=1]
+   ATTR: [type=enum/int] [name=BROADPHASE_GRID]                            [value=2]
 */
 static const mp_rom_map_elem_t engine_physics_globals_table[] = {
     { MP_OBJ_NEW_QSTR(MP_QSTR___name__), MP_OBJ_NEW_QSTR(MP_QSTR_engine_physics) },
@@ -74,6 +127,12 @@ static const mp_rom_map_elem_t engine_physics_globals_table[] = {
     { MP_OBJ_NEW_QSTR(MP_QSTR_CollisionContact2D), (mp_obj_t)&collision_contact_2d_class_type},
     { MP_OBJ_NEW_QSTR(MP_QSTR_set_gravity), (mp_obj_t)&engine_physics_set_gravity_obj },
     { MP_OBJ_NEW_QSTR(MP_QSTR_get_gravity), (mp_obj_t)&engine_physics_get_gravity_obj },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_set_broadphase), (mp_obj_t)&engine_physics_set_broadphase_obj },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_get_broadphase), (mp_obj_t)&engine_physics_get_broadphase_obj },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_get_pairs_tested), (mp_obj_t)&engine_physics_get_pairs_tested_obj },
+    { MP_ROM_QSTR(MP_QSTR_BROADPHASE_NONE), MP_ROM_INT(ENGINE_PHYSICS_BROADPHASE_NONE) },
+    { MP_ROM_QSTR(MP_QSTR_BROADPHASE_SWEEP), MP_ROM_INT(ENGINE_PHYSICS_BROADPHASE_SWEEP) },
+    { MP_ROM_QSTR(MP_QSTR_BROADPHASE_GRID), MP_ROM_INT(ENGINE_PHYSICS_BROADPHASE_GRID) },
 };
 
 // Module init
@@ -343,6 +343,7 @@ void create_blank_from_params(texture_resource_class_obj_t *self, mp_obj_t width
 
     self->width = blank_width;
     self->height = blank_height;
+    self->in_ram = true;
     self->data = data;
     self->colors = colors;
     self->bit_depth = blank_bit_depth;
@@ -587,6 +588,7 @@ mp_obj_t texture_resource_class_new(const mp_obj_type_t *type, size_t n_args, si
 
     texture_resource_class_obj_t *self = mp_obj_malloc_with_finaliser(texture_resource_class_obj_t, &texture_resource_class_type);
     self->base.type = &texture_resource_class_type;
+    self->revision = 0;
 
     switch(n_args){
         case 1: // File path
@@ -20,6 +20,7 @@ typedef struct texture_resource_class_obj_t{
     mp_obj_t colors;
     mp_obj_t data;
     bool in_ram;
+    uint32_t revision;      // Bumped when a camera renders into the texture, part of damage signatures
 
     // Used by 16 xrgb or argb formats to move masked bits
     // all the way to the right for mapping
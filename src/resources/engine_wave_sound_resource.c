@@ -28,7 +28,7 @@ mp_obj_t wave_sound_resource_class_new(const mp_obj_type_t *type, size_t n_args,
     self->channel = NULL;
     self->play_counter_max = 0;
     self->play_counter = 0;
-    self->last_sample = 0.0f;
+    self->last_sample = 0;
 
     // Wave parsing: https://truelogic.org/wordpress/2015/09/04/parsing-a-wav-file-in-c/
     //               https://www.aelius.com/njh/wavemetatools/doc/riffmci.pdf
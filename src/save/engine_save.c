@@ -21,9 +21,17 @@
             indices (size)    |      data       |                                                 desc.
       0 ~ 3   (4 bytes)       |THSV             |    Unique string: 4 bytes indicating this is a Thumby Color save file
       4 ~ 5   (2  bytes)      |UINT_16          |          Version: 2 bytes indicating the version of this save file (can be changed in the firmware if needed)
-      6 ~ 7   (2  bytes)      |UINT_16          | Key/offset count: 2 bytes key count for when string keys are hashed and reduced to an index into the subsequent offset table. Higher key count means more flash taken up (256*4=1000) but less searching during collisions and vice versa
-      8 ~ offset_end          |UINT_32 array    |   Bucket offsets: Depending on previous 2 bytes, if key_count=128 and offset_size=4 bytes (always true) then 128*4=512 bytes of offset bytes
-      offset_end ~ bucket_end |Variable         |          Buckets: Bucket offsets are seek positions to starts of buckets in this part of the data. Each bucket consists of type,offset,data_length,key_length,key pairs
+      6 ~ 7   (2  bytes)      |UINT_16          |     Bucket count: 2 bytes count of buckets that string keys are hashed and reduced to an index into. Higher bucket count means more flash taken up (64*4=256 bytes) but shorter chains to search and vice versa
+      8 ~ 11  (4  bytes)      |UINT_32          |    Garbage bytes: 4 bytes count of how much of the file is taken up by records that were replaced or deleted. The file is compacted once too much of it is garbage
+      12 ~ offset_end         |UINT_32 array    |   Bucket offsets: Depending on the bucket count, if bucket_count=64 and offset_size=4 bytes (always true) then 64*4=256 bytes of offset bytes. Each is the seek position of the newest record in that bucket (0 for none)
+      offset_end ~ file_end   |Variable         |          Records: Only ever appended to the end of the file, never changed after. Each record is previous,key_length,key,data_length,type,data where previous is the seek position of the next older record in the same bucket (0 for none). A record with type `SAVE_NONE` means the key was deleted
+
+    Saving appends a record and points its bucket at it, loading follows the chain
+    from the bucket of the key until the newest record with that key is found.
+
+    Version 0 files (only the unique string and version followed by key_length,key,
+    data_length,type,data entries that were rewritten in place) are migrated to the
+    current format when their location is set
 */
 
 #define SAVE_LOCATION_LENGTH_MAX 384
@@ -34,6 +42,16 @@
 
 #define TABLE_SIZE TABLE_THUMBY_CLR_SCREEN_LEN + TABLE_VERSION_LEN
 
+#define SAVE_BUCKET_COUNT 64
+#define SAVE_HEADER_GARBAGE_OFFSET 8
+#define SAVE_HEADER_BUCKETS_OFFSET 12
+
+// Compact once there's at least this many bytes of garbage and it is at least half of the file
+#define SAVE_COMPACT_MIN_GARBAGE 2048
+
+// previous + key_length + data_length + type
+#define SAVE_RECORD_OVERHEAD (4 + 2 + 4 + 1)
+
 mp_obj_str_t current_location = {
     .base.type = &mp_type_str,
     .hash = 0,
@@ -275,8 +293,44 @@ void engine_saving_write_entry(uint8_t file_index, mp_obj_t entry, const byte* e
 }
 
 
-void engine_saving_get_meta_table(uint8_t file_index, uint16_t *version){
-    // Read entire table from save file into ram
+// Record lookups need a key to find and compact needs one to compare
+// while the other is in the file, C heap, only grown
+byte *key_buffer = NULL;
+uint32_t key_buffer_len = 0;
+
+// Newest record of each key found so far in a bucket while compacting
+typedef struct{
+    uint32_t key_hash;
+    uint32_t offset;
+    uint16_t key_len;
+}engine_saving_seen_record_t;
+
+engine_saving_seen_record_t *seen_records = NULL;
+uint32_t seen_records_count = 0;
+uint32_t seen_records_capacity = 0;
+
+
+// https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function (FNV-1a). Not
+// using qstr hashing since that depends on the MicroPython build and this is stored in files
+uint32_t engine_saving_hash_key(const byte *key, size_t key_len){
+    uint32_t hash = 2166136261u;
+
+    for(size_t index=0; index<key_len; index++){
+        hash ^= key[index];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+
+uint32_t engine_saving_get_bucket_seek_offset(uint16_t bucket_count, const byte *key, size_t key_len){
+    return SAVE_HEADER_BUCKETS_OFFSET + (engine_saving_hash_key(key, key_len) % bucket_count) * 4;
+}
+
+
+void engine_saving_get_meta_table(uint8_t file_index, uint16_t *version, uint16_t *bucket_count, uint32_t *garbage){
+    // Read start of table from save file into ram
     engine_file_read(file_index, buffer, TABLE_SIZE);
 
     // Make sure this is still a correct save file
@@ -286,94 +340,262 @@ void engine_saving_get_meta_table(uint8_t file_index, uint16_t *version){
 
     // Fill in info
     memcpy(version, buffer+TABLE_THUMBY_CLR_SCREEN_LEN, TABLE_VERSION_LEN);
+
+    // Version 0 files have nothing else in the table
+    *bucket_count = 0;
+    *garbage = 0;
+
+    if(*version >= 1){
+        *bucket_count = engine_file_get_u16(file_index);
+        *garbage = engine_file_get_u32(file_index);
+
+        if(*bucket_count == 0){
+            mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("EngineSave: ERROR: save file has no buckets, it may be corrupted!"));
+        }
+    }
 }
 
 
-void engine_saving_save_meta_table(uint8_t file_index, uint16_t save_version){
+void engine_saving_save_meta_table(uint8_t file_index, uint32_t *bucket_offsets, uint32_t garbage){
+    uint16_t save_version = SAVE_VERSION;
+    uint16_t bucket_count = SAVE_BUCKET_COUNT;
+
     engine_file_write(file_index, THUMBY_CLR_SCREEN, TABLE_THUMBY_CLR_SCREEN_LEN);
     engine_file_write(file_index, &save_version, TABLE_VERSION_LEN);
+    engine_file_write(file_index, &bucket_count, 2);
+    engine_file_write(file_index, &garbage, 4);
+    engine_file_write(file_index, bucket_offsets, SAVE_BUCKET_COUNT * 4);
 }
 
 
-uint16_t engine_saving_seek_compare_string_in_file(uint8_t file_index, const byte *str, size_t str_len, bool *entry_name_found){
-    // Go through the name from the file and the passed
-    // name char by char. If at any point the name does
-    // not match, break out of the parsing loop below
-    uint16_t str_index = 0;
-    char entry_name_char = ' ';
+// Points the bucket at the record that was just appended and stores
+// the new garbage count (the only parts of the file that get rewritten)
+void engine_saving_update_meta_table(uint8_t file_index, uint32_t bucket_seek_offset, uint32_t record_offset, uint32_t garbage){
+    engine_file_seek(file_index, bucket_seek_offset, MP_SEEK_SET);
+    engine_file_write(file_index, &record_offset, 4);
+
+    engine_file_seek(file_index, SAVE_HEADER_GARBAGE_OFFSET, MP_SEEK_SET);
+    engine_file_write(file_index, &garbage, 4);
+}
+
 
-    while(engine_file_read(0, &entry_name_char, 1) != 0 && str_index < str_len){
-        if(entry_name_char == str[str_index]){
-            str_index++;
-        }else{
-            *entry_name_found = false;
-            break;
+// Reads `key_len` bytes from the file into `key_buffer`
+byte *engine_saving_read_key(uint8_t file_index, uint16_t key_len){
+    if(key_len > key_buffer_len){
+        byte *grown = realloc(key_buffer, key_len);
+
+        if(grown == NULL){
+            mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("EngineSave: ERROR: Ran out of memory reading entry name!"));
         }
 
-        if(str_index == str_len){
-            *entry_name_found = true;
-            break;
+        key_buffer = grown;
+        key_buffer_len = key_len;
+    }
+
+    engine_file_read(file_index, key_buffer, key_len);
+    return key_buffer;
+}
+
+
+// Compares the next `key_len` bytes in the file against `key`
+bool engine_saving_compare_key_in_file(uint8_t file_index, const byte *key, size_t key_len){
+    size_t compared = 0;
+
+    while(compared < key_len){
+        uint32_t amount = min(BUFFER_LENGTH_MAX, key_len - compared);
+
+        if(engine_file_read(file_index, buffer, amount) != amount || memcmp(buffer, key + compared, amount) != 0){
+            return false;
         }
+
+        compared += amount;
     }
 
-    return str_index;
+    return true;
 }
 
 
-bool engine_saving_seek_copy_to_entry_in_file(uint8_t from_file_index, uint8_t to_file_index, const byte *entry_name, size_t entry_name_len, uint32_t *out_data_len, uint8_t *out_data_type, bool copy){
-    bool entry_name_found = false;
+// Follows the chain of records starting at `record_offset` until the newest
+// one with `key` is found. If found, the file is left at the start of its data
+bool engine_saving_find_record(uint8_t file_index, uint32_t record_offset, const byte *key, size_t key_len, uint32_t *out_data_len, uint8_t *out_data_type){
+    while(record_offset != 0){
+        engine_file_seek(file_index, record_offset, MP_SEEK_SET);
 
-    while(entry_name_found == false){
-        // Parsing entry names starts by getting name length
-        uint16_t entry_name_len = 0;
-        engine_file_read(from_file_index, &entry_name_len, 2);
+        uint32_t previous_offset = engine_file_get_u32(file_index);
+        uint16_t record_key_len = engine_file_get_u16(file_index);
 
-        // If len still zero after reading, must be at end of file,
-        // stop reading
-        if(entry_name_len == 0){
-            break;
+        if(record_key_len == key_len && engine_saving_compare_key_in_file(file_index, key, key_len)){
+            *out_data_len = engine_file_get_u32(file_index);
+            *out_data_type = engine_file_get_u8(file_index);
+            return true;
         }
 
-        // Seek and find string from where we are currently in
-        // the reading file
-        uint16_t entry_name_index = engine_saving_seek_compare_string_in_file(from_file_index, entry_name, entry_name_len, &entry_name_found);
+        record_offset = previous_offset;
+    }
 
-        // If the name was found or not, skip to end of entry_name
-        // and get the entry_data_len so we can skip or copy it
-        uint32_t entry_data_len = 0;
-        if(entry_name_found == false) engine_file_seek(from_file_index, (entry_name_len-1)-entry_name_index, MP_SEEK_CUR);
-        engine_file_read(from_file_index, &entry_data_len, 4);
+    return false;
+}
+
+
+// Appends a record for `entry` (or a deleted record if `entry` is
+// `MP_OBJ_NULL`) to the end of the file, returns where it starts
+uint32_t engine_saving_append_record(uint8_t file_index, uint32_t previous_offset, const byte *entry_name, size_t entry_name_len, mp_obj_t entry){
+    uint32_t record_offset = engine_file_seek(file_index, 0, MP_SEEK_END);
+
+    engine_file_write(file_index, &previous_offset, 4);
 
-        // Read the data type but don't do anything with it
+    if(entry == MP_OBJ_NULL){
+        uint32_t entry_data_len = 0;
         uint8_t entry_data_type = SAVE_NONE;
-        engine_file_read(from_file_index, &entry_data_type, 1);
-
-        // If we found the entry name, skip past old data
-        // If did not find name, skip data and keep looking
-        // for the entry
-        if(entry_name_found){
-            // Seek past old data in reading file so it doesn't get
-            // copied later
-            if(copy) engine_file_seek(from_file_index, entry_data_len, MP_SEEK_CUR);
-            if(out_data_len != NULL) *out_data_len = entry_data_len;
-            if(out_data_type != NULL) *out_data_type = entry_data_type;
-
-            // Found and replaced, break out
-            break;
-        }else{
-            // entry_name_len + entry_name + entry_data_len + entry_data_type -> data
-            uint32_t entry_entire_tag_length = 2+entry_name_len+4+1;
-
-            if(copy){
-                engine_file_seek(from_file_index, -(entry_entire_tag_length), MP_SEEK_CUR);
-                engine_file_copy_amount_from_to(from_file_index, to_file_index, entry_entire_tag_length+entry_data_len, buffer, BUFFER_LENGTH_MAX);
-            }else{
-                engine_file_seek(from_file_index, entry_data_len, MP_SEEK_CUR);
+
+        engine_file_write(file_index, &entry_name_len, 2);
+        engine_file_write(file_index, entry_name, entry_name_len);
+        engine_file_write(file_index, &entry_data_len, 4);
+        engine_file_write(file_index, &entry_data_type, 1);
+    }else{
+        engine_saving_write_entry(file_index, entry, entry_name, entry_name_len);
+    }
+
+    return record_offset;
+}
+
+
+// Copies a record whose data is next in the reading file to the writing file
+void engine_saving_copy_record(uint32_t *bucket_offsets, const byte *entry_name, uint16_t entry_name_len, uint32_t entry_data_len, uint8_t entry_data_type){
+    uint32_t bucket = engine_saving_hash_key(entry_name, entry_name_len) % SAVE_BUCKET_COUNT;
+    uint32_t record_offset = engine_file_position(1);
+
+    engine_file_write(1, &bucket_offsets[bucket], 4);
+    engine_file_write(1, &entry_name_len, 2);
+    engine_file_write(1, entry_name, entry_name_len);
+    engine_file_write(1, &entry_data_len, 4);
+    engine_file_write(1, &entry_data_type, 1);
+    engine_file_copy_amount_from_to(0, 1, entry_data_len, buffer, BUFFER_LENGTH_MAX);
+
+    bucket_offsets[bucket] = record_offset;
+}
+
+
+// Checks if a newer record with the same key was already seen while
+// compacting the current bucket, if not, remembers this one
+bool engine_saving_check_seen_record(uint32_t record_offset, const byte *key, uint16_t key_len){
+    uint32_t key_hash = engine_saving_hash_key(key, key_len);
+
+    for(uint32_t index=0; index<seen_records_count; index++){
+        engine_saving_seen_record_t *seen = &seen_records[index];
+
+        if(seen->key_hash == key_hash && seen->key_len == key_len){
+            // Skip to the key of the record (after previous and key_length)
+            engine_file_seek(0, seen->offset + 4 + 2, MP_SEEK_SET);
+
+            if(engine_saving_compare_key_in_file(0, key, key_len)){
+                return true;
             }
         }
     }
 
-    return entry_name_found;
+    if(seen_records_count >= seen_records_capacity){
+        uint32_t new_capacity = (seen_records_capacity == 0) ? 16 : seen_records_capacity * 2;
+        engine_saving_seen_record_t *grown = realloc(seen_records, new_capacity * sizeof(engine_saving_seen_record_t));
+
+        if(grown == NULL){
+            mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("EngineSave: ERROR: Ran out of memory compacting save file!"));
+        }
+
+        seen_records = grown;
+        seen_records_capacity = new_capacity;
+    }
+
+    seen_records[seen_records_count] = (engine_saving_seen_record_t){key_hash, record_offset, key_len};
+    seen_records_count++;
+
+    return false;
+}
+
+
+// Rewrites the save file with only the newest record of each key that isn't
+// deleted. Also used to migrate older versions of save files to this one
+void engine_saving_rewrite(){
+    ENGINE_INFO_PRINTF("EngineSave: Compacting save file");
+
+    engine_saving_start_read_write();
+
+    uint16_t version = 0;
+    uint16_t bucket_count = 0;
+    uint32_t garbage = 0;
+    engine_saving_get_meta_table(0, &version, &bucket_count, &garbage);
+
+    // Filled in as records are copied and written again at the end
+    uint32_t bucket_offsets[SAVE_BUCKET_COUNT] = {0};
+    engine_saving_save_meta_table(1, bucket_offsets, 0);
+
+    if(version == 0){
+        // Every entry in a version 0 file is the only one with its key
+        uint32_t entry_offset = TABLE_SIZE;
+
+        while(entry_offset < reading_file_size){
+            engine_file_seek(0, entry_offset, MP_SEEK_SET);
+
+            // Zero length name means the end of the file
+            uint16_t entry_name_len = engine_file_get_u16(0);
+            if(entry_name_len == 0){
+                break;
+            }
+
+            byte *entry_name = engine_saving_read_key(0, entry_name_len);
+            uint32_t entry_data_len = engine_file_get_u32(0);
+            uint8_t entry_data_type = engine_file_get_u8(0);
+
+            engine_saving_copy_record(bucket_offsets, entry_name, entry_name_len, entry_data_len, entry_data_type);
+
+            entry_offset += 2 + entry_name_len + 4 + 1 + entry_data_len;
+        }
+    }else{
+        // Chains go from newest to oldest, the first record
+        // found for each key is the one to keep
+        for(uint16_t bucket=0; bucket<bucket_count; bucket++){
+            uint32_t record_offset = engine_file_seek_get_u32(0, SAVE_HEADER_BUCKETS_OFFSET + bucket * 4);
+            seen_records_count = 0;
+
+            while(record_offset != 0){
+                engine_file_seek(0, record_offset, MP_SEEK_SET);
+
+                uint32_t previous_offset = engine_file_get_u32(0);
+                uint16_t entry_name_len = engine_file_get_u16(0);
+                byte *entry_name = engine_saving_read_key(0, entry_name_len);
+                uint32_t entry_data_len = engine_file_get_u32(0);
+                uint8_t entry_data_type = engine_file_get_u8(0);
+
+                if(engine_saving_check_seen_record(record_offset, entry_name, entry_name_len) == false && entry_data_type != SAVE_NONE){
+                    engine_file_seek(0, record_offset + SAVE_RECORD_OVERHEAD + entry_name_len, MP_SEEK_SET);
+                    engine_saving_copy_record(bucket_offsets, entry_name, entry_name_len, entry_data_len, entry_data_type);
+                }
+
+                record_offset = previous_offset;
+            }
+        }
+    }
+
+    engine_file_seek(1, 0, MP_SEEK_SET);
+    engine_saving_save_meta_table(1, bucket_offsets, 0);
+
+    engine_saving_stop_read_write();
+
+    free(key_buffer);
+    key_buffer = NULL;
+    key_buffer_len = 0;
+
+    free(seen_records);
+    seen_records = NULL;
+    seen_records_count = 0;
+    seen_records_capacity = 0;
+}
+
+
+void engine_saving_compact_if_needed(uint32_t garbage, uint32_t file_size){
+    if(garbage >= SAVE_COMPACT_MIN_GARBAGE && garbage * 2 >= file_size){
+        engine_saving_rewrite();
+    }
 }
 
 
@@ -398,19 +620,31 @@ void engine_saving_set_file_location(const byte *location, size_t location_len){
         // Looks likes the file already exists, check that it has the
         // unique sting at the start or error if it does not
         engine_file_open_read(0, &current_location);
-        uint8_t read_len = engine_file_read(0, buffer, TABLE_THUMBY_CLR_SCREEN_LEN);
+        uint8_t read_len = engine_file_read(0, buffer, TABLE_SIZE);
 
-        if(read_len != TABLE_THUMBY_CLR_SCREEN_LEN || strncmp(buffer, THUMBY_CLR_SCREEN, TABLE_THUMBY_CLR_SCREEN_LEN) != 0){
+        if(read_len != TABLE_SIZE || strncmp(buffer, THUMBY_CLR_SCREEN, TABLE_THUMBY_CLR_SCREEN_LEN) != 0){
             mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("EngineSave: ERROR: file at location is not a save file!"));
         }
 
         engine_file_close(0);
+
+        uint16_t version = 0;
+        memcpy(&version, buffer+TABLE_THUMBY_CLR_SCREEN_LEN, TABLE_VERSION_LEN);
+
+        if(version > SAVE_VERSION){
+            mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("EngineSave: ERROR: save file is from a newer version of the firmware!"));
+        }else if(version < SAVE_VERSION){
+            // Migrate the older format to the current one
+            engine_saving_rewrite();
+        }
     }else{
         // The file we are going to read from does not exist already.
         // Create it and write the initial table and special data to it
+        uint32_t bucket_offsets[SAVE_BUCKET_COUNT] = {0};
+
         engine_file_makedirs(engine_file_dirname(&current_location));
         engine_file_open_create_write(0, &current_location);
-        engine_saving_save_meta_table(0, SAVE_VERSION);
+        engine_saving_save_meta_table(0, bucket_offsets, 0);
         engine_file_close(0);
     }
 }
@@ -424,25 +658,38 @@ void engine_saving_del_set_location(){
 
 
 void engine_saving_save_entry(const byte* entry_name, size_t entry_name_len, mp_obj_t entry){
-    // STEP #1: Open files and get table info and copy to new file
-    // NOTE: read and write file cursors are at: 0 0
-    engine_saving_start_read_write();
+    // Errors if the type can't be saved, do this before
+    // anything is written so the file doesn't get a partial record
+    engine_saving_get_entry_data_len(entry);
+
+    // STEP #1: Open file and get table info
+    engine_file_open_read_write(0, &current_location);
 
     uint16_t version = 0;
-    engine_saving_get_meta_table(0, &version);
-    engine_saving_save_meta_table(1, version);
+    uint16_t bucket_count = 0;
+    uint32_t garbage = 0;
+    engine_saving_get_meta_table(0, &version, &bucket_count, &garbage);
 
-    // STEP #2: Go through all keys in file until we find this
-    // entry's key str/name
-    engine_saving_seek_copy_to_entry_in_file(0, 1, entry_name, entry_name_len, NULL, NULL, true);
+    // STEP #2: Find the newest record with this key (if any), it becomes garbage
+    uint32_t bucket_seek_offset = engine_saving_get_bucket_seek_offset(bucket_count, entry_name, entry_name_len);
+    uint32_t bucket_record_offset = engine_file_seek_get_u32(0, bucket_seek_offset);
 
-    // STEP #3: Save the entry
-    engine_saving_write_entry(1, entry, entry_name, entry_name_len);
+    uint32_t old_data_len = 0;
+    uint8_t old_data_type = SAVE_NONE;
 
-    // STEP #4: Copy the rest of the file
-    engine_file_copy_from_to_until(0, 1, reading_file_size, buffer, BUFFER_LENGTH_MAX);
+    // Deleted records were already counted when they were added
+    if(engine_saving_find_record(0, bucket_record_offset, entry_name, entry_name_len, &old_data_len, &old_data_type) && old_data_type != SAVE_NONE){
+        garbage += SAVE_RECORD_OVERHEAD + entry_name_len + old_data_len;
+    }
 
-    engine_saving_stop_read_write();
+    // STEP #3: Append the entry and make it the newest in its bucket
+    uint32_t record_offset = engine_saving_append_record(0, bucket_record_offset, entry_name, entry_name_len, entry);
+    uint32_t file_size = engine_file_position(0);
+    engine_saving_update_meta_table(0, bucket_seek_offset, record_offset, garbage);
+
+    engine_file_close(0);
+
+    engine_saving_compact_if_needed(garbage, file_size);
 }
 
 
@@ -454,13 +701,17 @@ mp_obj_t engine_saving_load_entry(const byte* entry_name, size_t entry_name_len)
     engine_saving_start_read();
 
     uint16_t version = 0;
-    engine_saving_get_meta_table(0, &version);
+    uint16_t bucket_count = 0;
+    uint32_t garbage = 0;
+    engine_saving_get_meta_table(0, &version, &bucket_count, &garbage);
 
     uint32_t entry_data_len = 0;
     uint8_t entry_data_type = SAVE_NONE;
 
-    // STEP #2: Search for entry and restore
-    if(engine_saving_seek_copy_to_entry_in_file(0, 1, entry_name, entry_name_len, &entry_data_len, &entry_data_type, false)){
+    // STEP #2: Search the key's bucket for the entry and restore
+    uint32_t bucket_record_offset = engine_file_seek_get_u32(0, engine_saving_get_bucket_seek_offset(bucket_count, entry_name, entry_name_len));
+
+    if(engine_saving_find_record(0, bucket_record_offset, entry_name, entry_name_len, &entry_data_len, &entry_data_type) && entry_data_type != SAVE_NONE){
         entry = engine_saving_read_entry(0, entry_data_len, entry_data_type);
     }
 
@@ -471,20 +722,38 @@ mp_obj_t engine_saving_load_entry(const byte* entry_name, size_t entry_name_len)
 
 
 void engine_saving_delete_entry(const byte *entry_name, size_t entry_name_len){
-    // STEP #1: Open files and get table info and copy to new file
-    // NOTE: read and write file cursors are at: 0 0
-    engine_saving_start_read_write();
+    // STEP #1: Open file and get table info
+    engine_file_open_read_write(0, &current_location);
 
     uint16_t version = 0;
-    engine_saving_get_meta_table(0, &version);
-    engine_saving_save_meta_table(1, version);
+    uint16_t bucket_count = 0;
+    uint32_t garbage = 0;
+    engine_saving_get_meta_table(0, &version, &bucket_count, &garbage);
 
-    // STEP #2: Go through all keys in file until we find this
-    // entry's key str/name
-    engine_saving_seek_copy_to_entry_in_file(0, 1, entry_name, entry_name_len, NULL, NULL, true);
+    // STEP #2: Find the newest record with this key, nothing to do if
+    // there isn't one or it was already deleted
+    uint32_t bucket_seek_offset = engine_saving_get_bucket_seek_offset(bucket_count, entry_name, entry_name_len);
+    uint32_t bucket_record_offset = engine_file_seek_get_u32(0, bucket_seek_offset);
 
-    // STEP #3: Copy the rest of the file
-    engine_file_copy_from_to_until(0, 1, reading_file_size, buffer, BUFFER_LENGTH_MAX);
+    uint32_t old_data_len = 0;
+    uint8_t old_data_type = SAVE_NONE;
 
-    engine_saving_stop_read_write();
-}
\ No newline at end of file
+    if(engine_saving_find_record(0, bucket_record_offset, entry_name, entry_name_len, &old_data_len, &old_data_type) == false || old_data_type == SAVE_NONE){
+        engine_file_close(0);
+        return;
+    }
+
+    // STEP #3: Append a deleted record, both it and
+    // the record it hides are garbage now
+    uint32_t record_offset = engine_saving_append_record(0, bucket_record_offset, entry_name, entry_name_len, MP_OBJ_NULL);
+    uint32_t file_size = engine_file_position(0);
+
+    garbage += SAVE_RECORD_OVERHEAD + entry_name_len + old_data_len;
+    garbage += SAVE_RECORD_OVERHEAD + entry_name_len;
+
+    engine_saving_update_meta_table(0, bucket_seek_offset, record_offset, garbage);
+
+    engine_file_close(0);
+
+    engine_saving_compact_if_needed(garbage, file_size);
+}
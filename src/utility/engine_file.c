@@ -99,6 +99,18 @@ void engine_file_open_create_write(uint8_t file_index, mp_obj_str_t *filename){
 }
 
 
+void engine_file_open_read_write(uint8_t file_index, mp_obj_str_t *filename){
+    mp_obj_t file_open_args[2] = {
+        engine_file_to_system_path(filename),
+        mp_obj_new_str("r+b", 3)    // Existing file, writes go where the cursor is (no qstr since '+' can't be in one)
+    };
+
+    // To avoid these non-exposed file pointers from being collected, set in register pointer space
+    MP_STATE_VM(files[file_index]) = mp_vfs_open(2, &file_open_args[0], (mp_map_t*)&mp_const_empty_map);
+    file_streams[file_index] = mp_get_stream(MP_STATE_VM(files[file_index]));
+}
+
+
 void engine_file_close(uint8_t file_index){
     mp_stream_close(MP_STATE_VM(files[file_index]));
 }
@@ -20,6 +20,10 @@ mp_obj_str_t* engine_file_dirname(mp_obj_str_t *path);
 void engine_file_open_read(uint8_t file_index, mp_obj_str_t *filename);
 void engine_file_open_create_write(uint8_t file_index, mp_obj_str_t *filename);
 
+// Opens an existing file for reading and writing in place
+// anywhere in it (seek to the end to append)
+void engine_file_open_read_write(uint8_t file_index, mp_obj_str_t *filename);
+
 // Close the file opened by 'engine_file_open(...)' (need to close
 // files on same thread in sequence with open, cannot be used across
 // the engine handle multiple files at the same time)
@@ -2,6 +2,58 @@
 #include "debug/debug_print.h"
 
 
+// Outside of the GC heap so these are never collected and since
+// floats are immutable they can be shared between all users. Indexed
+// by whole milliseconds, each is filled in the first time it's needed
+static mp_obj_float_t shared_floats_ms[ENGINE_MP_SHARED_FLOAT_MAX_MS+1];
+static mp_obj_float_t shared_floats_seconds[ENGINE_MP_SHARED_FLOAT_MAX_MS+1];
+
+// Times that aren't whole milliseconds (like a fixed physics step
+// from the fps limit) are rare, the first few are kept for good
+static mp_obj_float_t shared_floats_other[ENGINE_MP_SHARED_FLOAT_OTHER_COUNT];
+static uint8_t shared_float_other_count = 0;
+
+
+static mp_obj_t engine_mp_float_shared(mp_obj_float_t *shared_floats, float ms, float value){
+    if(ms >= 0.0f && ms <= ENGINE_MP_SHARED_FLOAT_MAX_MS && ms == (float)(uint32_t)ms){
+        mp_obj_float_t *shared_float = &shared_floats[(uint32_t)ms];
+
+        if(shared_float->base.type == NULL){
+            shared_float->base.type = &mp_type_float;
+            shared_float->value = value;
+        }
+
+        return MP_OBJ_FROM_PTR(shared_float);
+    }
+
+    for(uint8_t ifx=0; ifx<shared_float_other_count; ifx++){
+        if(shared_floats_other[ifx].value == value){
+            return MP_OBJ_FROM_PTR(&shared_floats_other[ifx]);
+        }
+    }
+
+    if(shared_float_other_count < ENGINE_MP_SHARED_FLOAT_OTHER_COUNT){
+        mp_obj_float_t *shared_float = &shared_floats_other[shared_float_other_count];
+        shared_float->base.type = &mp_type_float;
+        shared_float->value = value;
+        shared_float_other_count++;
+        return MP_OBJ_FROM_PTR(shared_float);
+    }
+
+    return mp_obj_new_float(value);
+}
+
+
+mp_obj_t engine_mp_float_shared_ms(float ms){
+    return engine_mp_float_shared(shared_floats_ms, ms, ms);
+}
+
+
+mp_obj_t engine_mp_float_shared_seconds(float ms){
+    return engine_mp_float_shared(shared_floats_seconds, ms, ms * 0.001f);
+}
+
+
 mp_obj_t engine_mp_load_attr_maybe(mp_obj_t base, qstr attr){
     mp_obj_t dest[2];
     mp_load_method_maybe(base, attr, dest);
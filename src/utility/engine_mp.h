@@ -19,6 +19,22 @@ typedef struct _mp_obj_framebuf_t {
     uint8_t format;
 } mp_obj_framebuf_t;
 
+// Longest time in whole milliseconds that `engine_mp_float_shared_*()`
+// keeps a float object for (frames taking longer allocate their `dt`)
+#define ENGINE_MP_SHARED_FLOAT_MAX_MS 250
+
+// How many times that aren't whole milliseconds get a kept float object
+#define ENGINE_MP_SHARED_FLOAT_OTHER_COUNT 4
+
+// Gets a float object for a time of `ms` milliseconds without allocating
+// from the GC heap. Meant for values passed to Python every frame like
+// `dt`, which come from `millis_diff` as whole milliseconds: every time
+// from 0 to ENGINE_MP_SHARED_FLOAT_MAX_MS has its own static object
+mp_obj_t engine_mp_float_shared_ms(float ms);
+
+// Same as `engine_mp_float_shared_ms()` but the object is in seconds
+mp_obj_t engine_mp_float_shared_seconds(float ms);
+
 // Mimics `mp_load_attr` but for cases where the attribute may not exist. Returns `MP_OBJ_NULL` if not found (nothing like this is exposed to user code)
 mp_obj_t engine_mp_load_attr_maybe(mp_obj_t base, qstr attr);
 
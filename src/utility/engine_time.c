@@ -14,6 +14,7 @@
     #include "pico.h"
     #include "hardware/timer.h"
     #include "pico/time.h"
+    #include "hardware/clocks.h"
 
     /* DWT (Data Watchpoint and Trace) registers, only exists on ARM Cortex with a DWT unit */
     #define KIN1_DWT_CONTROL             (*((volatile uint32_t*)0xE0001000))
@@ -112,26 +113,51 @@ uint32_t millis_add(uint32_t millis, int32_t delta) {
 }
 
 
-void cycles_start(){
-    #ifdef __unix__
-        // Not implemented
-    #else
+// Precise ticks at the last `cycles_start()`
+uint32_t cycles_started_at = 0;
+
+
+void engine_time_precise_init(){
+    #if defined(__arm__)
         // https://mcuoneclipse.com/2017/01/30/cycle-counting-on-arm-cortex-m-with-dwt/
         KIN1_InitCycleCounter(); /* enable DWT hardware */
-        KIN1_ResetCycleCounter(); /* reset cycle counter */
         KIN1_EnableCycleCounter(); /* start counting */
     #endif
 }
 
 
-uint32_t cycles_stop(){
-    #ifdef __unix__
-        // Not implemented
-        return 0;
+uint32_t engine_time_precise_ticks(){
+    #if defined(__EMSCRIPTEN__)
+        gettimeofday(&tv, NULL);
+        return tv.tv_sec * 1000000000LL + tv.tv_usec * 1000LL;
+    #elif defined(__unix__)
+        // Monotonic so that the clock being adjusted doesn't affect timings
+        struct timespec precise_tp;
+        clock_gettime(CLOCK_MONOTONIC, &precise_tp);
+        return precise_tp.tv_sec * 1000000000LL + precise_tp.tv_nsec;
+    #elif defined(__arm__)
+        return KIN1_GetCycleCounter();
+    #endif
+}
+
+
+float engine_time_precise_ticks_per_us(){
+    #if defined(__arm__)
+        return (float)clock_get_hz(clk_sys) / 1000000.0f;
     #else
-        // https://mcuoneclipse.com/2017/01/30/cycle-counting-on-arm-cortex-m-with-dwt/
-        uint32_t cycles = KIN1_GetCycleCounter(); /* get cycle counter */
-        KIN1_DisableCycleCounter(); /* disable counting if not used any more */
-        return cycles;
+        return 1000.0f;
     #endif
-}
\ No newline at end of file
+}
+
+
+// The counter is left running so that other
+// things using it are not reset or stopped
+void cycles_start(){
+    engine_time_precise_init();
+    cycles_started_at = engine_time_precise_ticks();
+}
+
+
+uint32_t cycles_stop(){
+    return engine_time_precise_ticks() - cycles_started_at;
+}
@@ -14,7 +14,17 @@ uint32_t millis();
 int32_t millis_diff(uint32_t end, uint32_t start);
 uint32_t millis_add(uint32_t millis, int32_t delta);
 
+// Starts/stops counting cycles (nanoseconds on Unix)
 void cycles_start();
 uint32_t cycles_stop();
 
+// Free running counter for timing short stretches of code. Counts
+// CPU cycles (DWT) on the device and nanoseconds on Unix. Wraps, so
+// only the difference between two readings means anything
+void engine_time_precise_init();
+uint32_t engine_time_precise_ticks();
+
+// How many precise ticks happen in one microsecond
+float engine_time_precise_ticks_per_us();
+
 #endif  // ENGINE_TIME_H
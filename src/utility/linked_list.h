@@ -7,6 +7,10 @@
 #include "debug/debug_print.h"
 
 
+// Links can either be allocated by the list ('linked_list_add_obj') or
+// be owned by the caller, usually embedded in the object that is being
+// tracked ('linked_list_add_node'), so that joining and leaving a list
+// doesn't allocate. 'object' is NULL while a link is not in a list
 typedef struct linked_list_node{
     void *object;
     struct linked_list_node *next;
@@ -28,5 +32,18 @@ linked_list_node *linked_list_add_obj(linked_list *list, void *obj);
 void linked_list_del_list_node(linked_list *list, linked_list_node *node);
 void linked_list_clear(linked_list *list);
 
+// Marks a caller owned link as not being in any list
+void linked_list_node_init(linked_list_node *node);
+
+// Returns true if the caller owned link is currently in a list
+bool linked_list_node_is_linked(linked_list_node *node);
+
+// Links a caller owned 'node' holding 'obj' to the end of 'list'
+void linked_list_add_node(linked_list *list, linked_list_node *node, void *obj);
+
+// Unlinks a caller owned 'node' from 'list' without freeing
+// it. Does nothing if 'node' isn't in a list
+void linked_list_remove_node(linked_list *list, linked_list_node *node);
+
 
 #endif  // LINKED_LIST_H
@@ -4,4 +4,4 @@
 #define ENGINE_VER_PATCH 0
 
 // Version for save files
-#define SAVE_VERSION 0
\ No newline at end of file
+#define SAVE_VERSION 1
\ No newline at end of file